@@ -0,0 +1,560 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <getopt.h>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <regex>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include <streampu.hpp>
+using namespace spu;
+using namespace spu::runtime;
+using json = nlohmann::json;
+
+#ifndef SPU_BENCH_VERSION
+#define SPU_BENCH_VERSION "unknown"
+#endif
+
+// a benchmark case builds its modules (and its sequence or pipeline) only when it is selected: 'setup' returns the
+// function that runs 'n_iterations' times the measured operation, 'items_per_iteration' is the number of items (tasks
+// or frames) processed in one iteration, it is used to compute the throughput
+struct bench_case
+{
+    std::string name;
+    std::string item_name;
+    double items_per_iteration;
+    std::function<std::function<void(const size_t n_iterations)>()> setup;
+};
+
+struct bench_result
+{
+    std::string name;
+    std::string item_name;
+    size_t iterations;
+    size_t repetitions;
+    double real_time; // in ns per iteration
+    double cpu_time;  // in ns per iteration
+    double items_per_second;
+};
+
+static double
+cpu_time_now()
+{
+    return (double)std::clock() / (double)CLOCKS_PER_SEC;
+}
+
+// same approach as Google Benchmark: the number of iterations is increased until the measure lasts at least
+// 'min_time' seconds, then the measure is repeated 'repetitions' times and the median is kept
+static bench_result
+run_case(const bench_case& bc, const double min_time, const size_t repetitions)
+{
+    auto run = bc.setup();
+    auto measure = [&run](const size_t n_iterations, double& real_time, double& cpu_time)
+    {
+        const double c_start = cpu_time_now();
+        auto t_start = std::chrono::steady_clock::now();
+        run(n_iterations);
+        std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - t_start;
+        real_time = (double)duration.count() * 1e-9;
+        cpu_time = cpu_time_now() - c_start;
+    };
+
+    size_t n_iterations = 1;
+    double real_time = 0., cpu_time = 0.;
+    while (true)
+    {
+        measure(n_iterations, real_time, cpu_time);
+        if (real_time >= min_time || n_iterations >= (size_t)1e9) break;
+        const double multiplier = real_time > 0. ? std::min(10., 1.4 * min_time / real_time) : 10.;
+        n_iterations = std::max(n_iterations + 1, (size_t)((double)n_iterations * multiplier));
+    }
+
+    std::vector<std::pair<double, double>> measures(1, std::make_pair(real_time, cpu_time));
+    for (size_t r = 1; r < repetitions; r++)
+    {
+        measure(n_iterations, real_time, cpu_time);
+        measures.push_back(std::make_pair(real_time, cpu_time));
+    }
+    std::sort(measures.begin(), measures.end());
+    const auto& median = measures[measures.size() / 2];
+
+    bench_result res;
+    res.name = bc.name;
+    res.item_name = bc.item_name;
+    res.iterations = n_iterations;
+    res.repetitions = repetitions;
+    res.real_time = median.first * 1e9 / (double)n_iterations;
+    res.cpu_time = median.second * 1e9 / (double)n_iterations;
+    res.items_per_second = bc.items_per_iteration * (double)n_iterations / median.first;
+    return res;
+}
+
+static std::shared_ptr<module::Stateless>
+create_nop(const bool in_out, const bool fwd, const size_t data_length)
+{
+    std::shared_ptr<module::Stateless> nop(new module::Stateless());
+    nop->set_name("Nop");
+    nop->set_short_name("Nop");
+    auto& tsk = nop->create_task("nop");
+    if (in_out)
+    {
+        nop->create_socket_in<uint8_t>(tsk, "in", data_length);
+        nop->create_socket_out<uint8_t>(tsk, "out", data_length);
+    }
+    if (fwd) nop->create_socket_fwd<uint8_t>(tsk, "fwd", data_length);
+    nop->create_codelet(tsk,
+                        [](module::Module& /*m*/, runtime::Task& /*t*/, const size_t /*frame_id*/) -> int
+                        { return runtime::status_t::SUCCESS; });
+    return nop;
+}
+
+// a task without socket (except the status) that does nothing: measures the cost of 'Task::exec' with and without
+// the checks and the statistics
+static void
+add_empty_cases(std::vector<bench_case>& cases)
+{
+    for (auto fast : { true, false })
+        for (auto stats : { false, true })
+            cases.push_back({ "task/empty/fast:" + std::to_string(fast) + "/stats:" + std::to_string(stats),
+                              "tasks",
+                              1.,
+                              [fast, stats]() -> std::function<void(const size_t)>
+                              {
+                                  auto nop = create_nop(false, false, 1);
+                                  (*nop)("nop").set_fast(fast);
+                                  (*nop)("nop").set_stats(stats);
+                                  return [nop](const size_t n_iterations)
+                                  {
+                                      auto& t = (*nop)("nop");
+                                      for (size_t i = 0; i < n_iterations; i++)
+                                          t.exec();
+                                  };
+                              } });
+}
+
+// a task that does nothing with 'in'/'out' sockets or with one 'fwd' socket, executed on 'n_frames' frames per
+// call with 1 frame per wave or in a single wave: measures the cost of the sockets and of the waves splitting
+static void
+add_socket_cases(std::vector<bench_case>& cases, const size_t data_length, const std::vector<size_t>& frames_sweep)
+{
+    for (auto fwd : { false, true })
+        for (auto n_frames : frames_sweep)
+        {
+            std::vector<size_t> waves = { 1 };
+            if (n_frames > 1) waves.push_back(n_frames);
+            for (auto n_frames_per_wave : waves)
+                cases.push_back(
+                  { std::string("task/") + (fwd ? "sockets:fwd" : "sockets:in_out") + "/frames:" +
+                      std::to_string(n_frames) + "/wave:" + std::to_string(n_frames_per_wave),
+                    "frames",
+                    (double)n_frames,
+                    [fwd, n_frames, n_frames_per_wave, data_length]() -> std::function<void(const size_t)>
+                    {
+                        auto nop = create_nop(!fwd, fwd, data_length);
+                        nop->set_n_frames(n_frames);
+                        nop->set_n_frames_per_wave(n_frames_per_wave);
+                        std::shared_ptr<std::vector<uint8_t>> data(new std::vector<uint8_t>(data_length * n_frames));
+                        (*nop)[fwd ? "nop::fwd" : "nop::in"] = *data;
+                        (*nop)("nop").set_fast(true);
+                        (*nop)("nop").set_stats(false);
+                        return [nop, data](const size_t n_iterations)
+                        {
+                            auto& t = (*nop)("nop");
+                            for (size_t i = 0; i < n_iterations; i++)
+                                t.exec();
+                        };
+                    } });
+        }
+}
+
+// the runtime object is declared last to be destroyed before the modules it refers to
+template<class R>
+struct chain_context
+{
+    std::unique_ptr<module::Initializer<uint8_t>> initializer;
+    std::vector<std::unique_ptr<module::Module>> modules;
+    std::unique_ptr<module::Finalizer<uint8_t>> finalizer;
+    std::unique_ptr<R> runtime;
+};
+
+template<class R>
+static void
+disable_stats_and_checks(R& runtime)
+{
+    for (auto& mod : runtime.template get_modules<module::Module>(false))
+        for (auto& tsk : mod->tasks)
+        {
+            tsk->set_stats(false);
+            tsk->set_fast(true);
+        }
+}
+
+// a chain of 'n_tasks' incrementers between an initializer and a finalizer executed by a sequence: measures the
+// cost of the sequence traversal
+static void
+add_chain_cases(std::vector<bench_case>& cases, const size_t data_length, const std::vector<size_t>& chain_sweep)
+{
+    for (auto n_tasks : chain_sweep)
+        for (auto fwd : { false, true })
+            cases.push_back(
+              { "sequence/chain/tasks:" + std::to_string(n_tasks) + (fwd ? "/sockets:fwd" : "/sockets:in_out"),
+                "tasks",
+                (double)(n_tasks + 2),
+                [n_tasks, fwd, data_length]() -> std::function<void(const size_t)>
+                {
+                    std::shared_ptr<chain_context<runtime::Sequence>> ctx(new chain_context<runtime::Sequence>());
+                    ctx->initializer.reset(new module::Initializer<uint8_t>(data_length));
+                    ctx->finalizer.reset(new module::Finalizer<uint8_t>(data_length));
+
+                    const std::string in = fwd ? "incrementf::fwd" : "increment::in";
+                    const std::string out = fwd ? "incrementf::fwd" : "increment::out";
+                    runtime::Socket* prev = &(*ctx->initializer)["initialize::out"];
+                    for (size_t s = 0; s < n_tasks; s++)
+                    {
+                        auto inc = new module::Incrementer<uint8_t>(data_length, 0);
+                        inc->set_custom_name("Inc" + std::to_string(s));
+                        ctx->modules.push_back(std::unique_ptr<module::Module>(inc));
+                        (*inc)[in] = *prev;
+                        prev = &(*inc)[out];
+                    }
+                    (*ctx->finalizer)["finalize::in"] = *prev;
+
+                    ctx->runtime.reset(new runtime::Sequence((*ctx->initializer)("initialize")));
+                    disable_stats_and_checks(*ctx->runtime);
+                    return [ctx](const size_t n_iterations)
+                    {
+                        size_t counter = 0;
+                        ctx->runtime->exec([&counter, n_iterations]() { return ++counter >= n_iterations; });
+                    };
+                } });
+}
+
+// a pool of 'n_threads' threads that do nothing, woken up by 'run' and waited by 'wait' like at the start and at
+// the end of each 'Sequence::exec': measures the round-trip through the barrier of the pool
+static void
+add_thread_pool_cases(std::vector<bench_case>& cases, const std::vector<size_t>& threads_sweep)
+{
+    for (auto n_threads : threads_sweep)
+        cases.push_back({ "thread_pool/run_wait/threads:" + std::to_string(n_threads),
+                          "round-trips",
+                          1.,
+                          [n_threads]() -> std::function<void(const size_t)>
+                          {
+                              std::shared_ptr<tools::Thread_pool_standard> pool(
+                                new tools::Thread_pool_standard(n_threads));
+                              pool->init(); // threads are spawned here
+                              return [pool](const size_t n_iterations)
+                              {
+                                  std::function<void(const size_t)> func_exec = [](const size_t /*tid*/) {};
+                                  for (size_t i = 0; i < n_iterations; i++)
+                                  {
+                                      pool->run(func_exec, true);
+                                      pool->wait();
+                                  }
+                                  pool->unset_func_exec();
+                              };
+                          } });
+}
+
+// a pipeline of 'n_stages' stages with one thread per stage: an initializer, 'n_stages - 2' relayers and a finalizer,
+// measures the cost of the adaptors; in the 'work' cases the relayers wait 'work_ns' nanoseconds per frame like a
+// 'Sleeper' would do (a 'Sleeper' has no data socket and can't be a stage on its own)
+static void
+add_pipeline_cases(std::vector<bench_case>& cases,
+                   const size_t data_length,
+                   const size_t buffer_size,
+                   const size_t max_stages,
+                   const size_t work_ns)
+{
+    for (size_t n_stages = 2; n_stages <= max_stages; n_stages++)
+        for (auto ns : { (size_t)0, work_ns })
+        {
+            if ((n_stages == 2 || work_ns == 0) && ns != 0) continue;
+            cases.push_back(
+              { "pipeline/stages:" + std::to_string(n_stages) + "/work_ns:" + std::to_string(ns),
+                "frames",
+                1.,
+                [n_stages, ns, data_length, buffer_size]() -> std::function<void(const size_t)>
+                {
+                    std::shared_ptr<chain_context<runtime::Pipeline>> ctx(new chain_context<runtime::Pipeline>());
+                    ctx->initializer.reset(new module::Initializer<uint8_t>(data_length));
+                    ctx->finalizer.reset(new module::Finalizer<uint8_t>(data_length));
+
+                    std::vector<std::pair<std::vector<runtime::Task*>, std::vector<runtime::Task*>>> sep_stages;
+                    sep_stages.push_back(
+                      { { &(*ctx->initializer)("initialize") }, { &(*ctx->initializer)("initialize") } });
+                    runtime::Socket* prev = &(*ctx->initializer)["initialize::out"];
+                    for (size_t s = 0; s < n_stages - 2; s++)
+                    {
+                        auto rly = new module::Relayer<uint8_t>(data_length, ns);
+                        rly->set_custom_name("Relayer" + std::to_string(s));
+                        ctx->modules.push_back(std::unique_ptr<module::Module>(rly));
+                        (*rly)["relay::in"] = *prev;
+                        prev = &(*rly)["relay::out"];
+                        sep_stages.push_back({ { &(*rly)("relay") }, { &(*rly)("relay") } });
+                    }
+                    (*ctx->finalizer)["finalize::in"] = *prev;
+                    sep_stages.push_back(
+                      { { &(*ctx->finalizer)("finalize") }, { &(*ctx->finalizer)("finalize") } });
+
+                    ctx->runtime.reset(new runtime::Pipeline((*ctx->initializer)("initialize"),
+                                                             sep_stages,
+                                                             std::vector<size_t>(n_stages, 1),
+                                                             std::vector<size_t>(n_stages - 1, buffer_size),
+                                                             std::vector<bool>(n_stages - 1, false)));
+                    disable_stats_and_checks(*ctx->runtime);
+                    return [ctx](const size_t n_iterations)
+                    {
+                        std::atomic<size_t> counter(0);
+                        ctx->runtime->exec([&counter, n_iterations]() { return ++counter >= n_iterations; });
+                    };
+                } });
+        }
+}
+
+int
+main(int argc, char** argv)
+{
+    tools::Signal_handler::init();
+
+    option longopts[] = { { "filter", required_argument, NULL, 'f' },
+                          { "min-time", required_argument, NULL, 'm' },
+                          { "repetitions", required_argument, NULL, 'r' },
+                          { "data-length", required_argument, NULL, 'd' },
+                          { "max-frames", required_argument, NULL, 'F' },
+                          { "max-tasks", required_argument, NULL, 'T' },
+                          { "max-stages", required_argument, NULL, 'N' },
+                          { "max-threads", required_argument, NULL, 'P' },
+                          { "buffer-size", required_argument, NULL, 'u' },
+                          { "work-ns", required_argument, NULL, 'w' },
+                          { "json-filepath", required_argument, NULL, 'j' },
+                          { "list", no_argument, NULL, 'l' },
+                          { "help", no_argument, NULL, 'h' },
+                          { 0 } };
+
+    std::string filter = ".*";
+    double min_time = 0.1;
+    size_t repetitions = 3;
+    size_t data_length = 1;
+    size_t max_frames = 64;
+    size_t max_tasks = 1000;
+    size_t max_stages = 4;
+    size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    size_t buffer_size = 16;
+    size_t work_ns = 1000;
+    std::string json_filepath;
+    bool list_only = false;
+
+    while (1)
+    {
+        const int opt = getopt_long(argc, argv, "f:m:r:d:F:T:N:P:u:w:j:lh", longopts, 0);
+        if (opt == -1) break;
+        switch (opt)
+        {
+            case 'f':
+                filter = std::string(optarg);
+                break;
+            case 'm':
+                min_time = atof(optarg);
+                break;
+            case 'r':
+                repetitions = std::max(1, atoi(optarg));
+                break;
+            case 'd':
+                data_length = atoi(optarg);
+                break;
+            case 'F':
+                max_frames = atoi(optarg);
+                break;
+            case 'T':
+                max_tasks = atoi(optarg);
+                break;
+            case 'N':
+                max_stages = atoi(optarg);
+                break;
+            case 'P':
+                max_threads = atoi(optarg);
+                break;
+            case 'u':
+                buffer_size = atoi(optarg);
+                break;
+            case 'w':
+                work_ns = atoi(optarg);
+                break;
+            case 'j':
+                json_filepath = std::string(optarg);
+                break;
+            case 'l':
+                list_only = true;
+                break;
+            case 'h':
+                std::cout << "usage: " << argv[0] << " [options]" << std::endl;
+                std::cout << std::endl;
+                std::cout << "  -f, --filter          "
+                          << "Regular expression to select the benchmarks to run                    "
+                          << "[\"" << filter << "\"]" << std::endl;
+                std::cout << "  -m, --min-time        "
+                          << "Minimum duration of one measure (in seconds)                          "
+                          << "[" << min_time << "]" << std::endl;
+                std::cout << "  -r, --repetitions     "
+                          << "Number of measures per benchmark (the median is reported)             "
+                          << "[" << repetitions << "]" << std::endl;
+                std::cout << "  -d, --data-length     "
+                          << "Number of bytes in the sockets                                        "
+                          << "[" << data_length << "]" << std::endl;
+                std::cout << "  -F, --max-frames      "
+                          << "Maximum number of frames in the waves sweep (powers of 4)             "
+                          << "[" << max_frames << "]" << std::endl;
+                std::cout << "  -T, --max-tasks       "
+                          << "Maximum number of tasks in the chains sweep (powers of 10)            "
+                          << "[" << max_tasks << "]" << std::endl;
+                std::cout << "  -N, --max-stages      "
+                          << "Maximum number of stages in the pipelines sweep                       "
+                          << "[" << max_stages << "]" << std::endl;
+                std::cout << "  -P, --max-threads     "
+                          << "Maximum number of threads in the pools sweep (powers of 2)            "
+                          << "[" << max_threads << "]" << std::endl;
+                std::cout << "  -u, --buffer-size     "
+                          << "Size of the buffers between the pipeline stages                       "
+                          << "[" << buffer_size << "]" << std::endl;
+                std::cout << "  -w, --work-ns         "
+                          << "Time spent per frame by the relayers of the 'work' pipelines (in ns)  "
+                          << "[" << work_ns << "]" << std::endl;
+                std::cout << "  -j, --json-filepath   "
+                          << "Path to the JSON output file ('-' for the standard output)            "
+                          << "[" << (json_filepath.empty() ? "empty" : "\"" + json_filepath + "\"") << "]"
+                          << std::endl;
+                std::cout << "  -l, --list            "
+                          << "Only list the benchmarks                                              "
+                          << "[false]" << std::endl;
+                std::cout << "  -h, --help            "
+                          << "This help                                                             "
+                          << "[false]" << std::endl;
+                exit(0);
+                break;
+            default:
+                break;
+        }
+    }
+
+    // when the JSON goes to the standard output, the human readable report goes to the standard error
+    std::ostream& out = json_filepath == "-" ? std::cerr : std::cout;
+
+    out << "##################################################" << std::endl;
+    out << "# Benchmark: Dispatch overhead of the runtime    #" << std::endl;
+    out << "##################################################" << std::endl;
+    out << "#" << std::endl;
+
+    out << "# Command line arguments:" << std::endl;
+    out << "#   - filter         = \"" << filter << "\"" << std::endl;
+    out << "#   - min_time       = " << min_time << " s" << std::endl;
+    out << "#   - repetitions    = " << repetitions << std::endl;
+    out << "#   - data_length    = " << data_length << std::endl;
+    out << "#   - max_frames     = " << max_frames << std::endl;
+    out << "#   - max_tasks      = " << max_tasks << std::endl;
+    out << "#   - max_stages     = " << max_stages << std::endl;
+    out << "#   - max_threads    = " << max_threads << std::endl;
+    out << "#   - buffer_size    = " << buffer_size << std::endl;
+    out << "#   - work_ns        = " << work_ns << std::endl;
+    out << "#   - json_filepath  = " << (json_filepath.empty() ? "[empty]" : json_filepath.c_str()) << std::endl;
+    out << "#" << std::endl;
+
+    std::vector<size_t> frames_sweep, chain_sweep, threads_sweep;
+    for (size_t f = 1; f <= max_frames; f *= 4)
+        frames_sweep.push_back(f);
+    for (size_t t = 1; t <= max_tasks; t *= 10)
+        chain_sweep.push_back(t);
+    for (size_t p = 1; p <= max_threads; p *= 2)
+        threads_sweep.push_back(p);
+
+    std::vector<bench_case> cases;
+    add_empty_cases(cases);
+    add_socket_cases(cases, data_length, frames_sweep);
+    add_chain_cases(cases, data_length, chain_sweep);
+    add_thread_pool_cases(cases, threads_sweep);
+    add_pipeline_cases(cases, data_length, buffer_size, max_stages, work_ns);
+
+    const std::regex re(filter);
+    std::vector<bench_case> selected;
+    for (auto& bc : cases)
+        if (std::regex_search(bc.name, re)) selected.push_back(bc);
+
+    size_t name_width = 9;
+    for (auto& bc : selected)
+        name_width = std::max(name_width, bc.name.size());
+
+    if (list_only)
+    {
+        for (auto& bc : selected)
+            std::cout << bc.name << std::endl;
+        return 0;
+    }
+
+    out << "# " << std::left << std::setw(name_width) << "Benchmark" << std::right << std::setw(14) << "Time (ns)"
+        << std::setw(14) << "CPU (ns)" << std::setw(14) << "Iterations" << std::setw(18) << "Items/s" << std::endl;
+
+    std::vector<bench_result> results;
+    for (auto& bc : selected)
+    {
+        results.push_back(run_case(bc, min_time, repetitions));
+        auto& res = results.back();
+        out << "# " << std::left << std::setw(name_width) << res.name << std::right << std::fixed
+            << std::setprecision(1) << std::setw(14) << res.real_time << std::setw(14) << res.cpu_time
+            << std::setw(14) << res.iterations << std::setw(15) << std::setprecision(3) << res.items_per_second / 1e6
+            << " M" << res.item_name.substr(0, 1) << std::defaultfloat << std::endl;
+    }
+
+    if (!json_filepath.empty())
+    {
+        // follow the layout of the Google Benchmark JSON reports to be able to use the same comparison tools
+        char hostname[256] = "";
+        gethostname(hostname, sizeof(hostname) - 1);
+        std::time_t now = std::time(nullptr);
+        char date[64] = "";
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", std::localtime(&now));
+
+        json report;
+        report["context"] = { { "date", date },
+                              { "host_name", hostname },
+                              { "executable", argv[0] },
+                              { "num_cpus", std::thread::hardware_concurrency() },
+                              { "streampu_version", SPU_BENCH_VERSION },
+                              { "min_time", min_time },
+                              { "repetitions", repetitions },
+                              { "data_length", data_length },
+                              { "buffer_size", buffer_size },
+                              { "work_ns", work_ns } };
+        report["benchmarks"] = json::array();
+        for (auto& res : results)
+            report["benchmarks"].push_back({ { "name", res.name },
+                                             { "run_name", res.name },
+                                             { "run_type", "iteration" },
+                                             { "iterations", res.iterations },
+                                             { "repetitions", res.repetitions },
+                                             { "real_time", res.real_time },
+                                             { "cpu_time", res.cpu_time },
+                                             { "time_unit", "ns" },
+                                             { "items_per_second", res.items_per_second },
+                                             { "item_name", res.item_name } });
+
+        if (json_filepath == "-")
+            std::cout << report.dump(2) << std::endl;
+        else
+        {
+            std::ofstream file(json_filepath);
+            file << report.dump(2) << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -5,6 +5,7 @@
 #ifndef MODULE_HPP_
 #define MODULE_HPP_
 
+#include <array>
 #include <cstddef>
 #include <functional>
 #include <memory>
@@ -13,6 +14,7 @@
 #include <vector>
 
 #include "Runtime/Socket/Socket.hpp"
+#include "Runtime/Task/Codelet_typed.hpp"
 #include "Runtime/Task/Task.hpp"
 #include "Tools/Interface/Interface_clone.hpp"
 #include "Tools/Interface/Interface_get_set_n_frames.hpp"
@@ -259,6 +261,11 @@ class Module
 
     void create_codelet(runtime::Task& task,
                         std::function<int(Module& m, runtime::Task& t, const size_t frame_id)> codelet);
+    // typed codelet: 'codelet' is called as 'codelet(m, t, data_0, ..., data_n, frame_id)' where 'data_i' is a 'T_i*'
+    // pointer on the socket 'sids[i]' (the 'T_i' of an input socket has to be 'const'), the types are checked here
+    // instead of at each call
+    template<typename... T, class F>
+    void create_codelet(runtime::Task& task, const std::array<size_t, sizeof...(T)>& sids, const F& codelet);
     void create_cdl(runtime::Task& task,
                     std::function<int(Module& m, runtime::Task& t, const size_t frame_id)> codelet);
 
@@ -2,8 +2,11 @@
 #include <cassert>
 #include <exception>
 #include <sstream>
+#include <typeindex>
+#include <typeinfo>
 
 #include "Module/Module.hpp"
+#include "Tools/Exception/exception.hpp"
 
 namespace spu
 {
@@ -188,5 +191,40 @@ Module::is_single_wave() const
     return this->single_wave;
 }
 
+template<typename... T, class F>
+void
+Module::create_codelet(runtime::Task& task, const std::array<size_t, sizeof...(T)>& sids, const F& codelet)
+{
+    const std::array<std::type_index, sizeof...(T)> datatypes = { { typeid(typename std::remove_const<T>::type)... } };
+    const std::array<const char*, sizeof...(T)> names = { { typeid(T).name()... } };
+    const std::array<bool, sizeof...(T)> is_const = { { std::is_const<T>::value... } };
+
+    for (size_t i = 0; i < sizeof...(T); i++)
+    {
+        if (sids[i] >= task.sockets.size())
+        {
+            std::stringstream message;
+            message << "'sids[i]' has to be smaller than 'task.sockets.size()' ('sids[i]' = " << sids[i]
+                    << ", 'task.sockets.size()' = " << task.sockets.size() << ", 'i' = " << i << ").";
+            throw tools::out_of_range(__FILE__, __LINE__, __func__, message.str());
+        }
+
+        auto& s = *task.sockets[sids[i]];
+        if (s.get_datatype() != datatypes[i] || (s.get_type() == runtime::socket_t::SIN && !is_const[i]))
+        {
+            std::stringstream message;
+            message << "The 'T' type does not match the socket (an input socket requires a 'const' type) ("
+                    << "'T' = " << names[i] << ", "
+                    << "'datatype' = " << s.get_datatype_string() << ", "
+                    << "'name' = " << s.get_name() << ", "
+                    << "'task.name' = " << task.get_name() << ", "
+                    << "'i' = " << i << ").";
+            throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+        }
+    }
+
+    this->create_codelet(task, runtime::Codelet_typed<F, T...>(codelet, sids));
+}
+
 }
 }
@@ -6,11 +6,14 @@
 #define ADAPTOR_M_TO_N_HPP_
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <typeindex>
 #include <vector>
 
@@ -19,6 +22,8 @@
 #include "Runtime/Socket/Socket.hpp"
 #include "Runtime/Task/Task.hpp"
 #include "Tools/Interface/Interface_waiting.hpp"
+#include "Tools/System/memory.hpp"
+#include "Tools/Thread/Thread_parking/Thread_parking.hpp"
 
 namespace spu
 {
@@ -31,7 +36,38 @@ class Adaptor_m_to_n
 {
     friend runtime::Sequence; // Sequence is friend to enable the no copy mode (0 copy)
 
+  public:
+    // adaptive depth: number of claims between two adaptations of the depth of a sub-buffer
+    static constexpr size_t depth_window = 64;
+
   protected:
+    // adaptive depth: statistics of a sub-buffer over the current window, only written by its pusher
+    struct depth_push_stats_t
+    {
+        std::atomic<size_t> depth;
+        size_t n_claims = 0;
+        size_t n_stalls = 0; // claims that had to wait because the depth was reached
+        double sum_dt = 0.;  // sum (and sum of squares) of the durations between two claims
+        double sum_dt2 = 0.;
+        std::chrono::steady_clock::time_point t_last;
+        std::vector<uint32_t> occupancy; // histogram of the number of filled slots at claim time
+        // snapshot of the (cumulative) puller statistics at the beginning of the window
+        uint64_t pull_n_claims = 0;
+        uint64_t pull_n_stalls = 0;
+        double pull_sum_dt = 0.;
+        double pull_sum_dt2 = 0.;
+    };
+
+    // adaptive depth: cumulative statistics of a sub-buffer, only written by its puller and read by its pusher
+    struct depth_pull_stats_t
+    {
+        std::atomic<uint64_t> n_claims;
+        std::atomic<uint64_t> n_stalls; // claims that had to wait because the sub-buffer was empty
+        std::atomic<double> sum_dt;
+        std::atomic<double> sum_dt2;
+        std::chrono::steady_clock::time_point t_last;
+    };
+
     std::vector<size_t> n_elmts;
     std::vector<size_t> n_bytes;
     const std::vector<std::type_index> datatype;
@@ -40,10 +76,16 @@ class Adaptor_m_to_n
 
     std::shared_ptr<std::vector<std::vector<std::vector<int8_t*>>>> buffer;
     std::vector<int8_t*> buffer_to_free;
+    // hwloc objects of each puller (ex: "PU_3"), the slots of a sub-buffer are allocated on whole pages bound to the
+    // NUMA node of its puller (nothing is done when empty or when StreamPU is not linked with hwloc)
+    std::vector<std::string> pull_placement;
+    // size in bytes of the slots (and of the reorder window buffers) allocated on the NUMA node of a puller
+    std::map<int8_t*, size_t> placed_slots;
 
-    std::shared_ptr<std::vector<uint32_t>> first;
-    std::shared_ptr<std::vector<uint32_t>> last;
-    std::shared_ptr<std::vector<std::atomic<uint32_t>>> counter;
+    // one entry per sub-buffer (sized in 'alloc_buffers()'), each entry is padded to its own cache line
+    std::shared_ptr<tools::cache_aligned_vector<uint32_t>> first;
+    std::shared_ptr<tools::cache_aligned_vector<uint32_t>> last;
+    std::shared_ptr<tools::cache_aligned_vector<std::atomic<uint32_t>>> counter;
 
     std::shared_ptr<std::atomic<bool>> waiting_canceled;
 
@@ -51,11 +93,62 @@ class Adaptor_m_to_n
     bool no_copy_push;
 
     const bool active_waiting;
+    const bool lock_free;
+    const size_t spin_budget;
+    const size_t batch_size;
+
+    // adaptive depth: the buffers are allocated for 'depth_max' slots ('buffer_size') and the number of slots that the
+    // pusher can fill (the depth) evolves between 'depth_min' and 'depth_max'
+    const size_t depth_init;
+    const size_t depth_min;
+    const size_t depth_max;
+    std::shared_ptr<tools::cache_aligned_vector<depth_push_stats_t>> depth_push_stats;
+    std::shared_ptr<tools::cache_aligned_vector<depth_pull_stats_t>> depth_pull_stats;
+
+    // work-stealing mode: the pullers are not bound to their sub-buffers anymore and pull the frames from any
+    // non-empty sub-buffer (the frames order is not preserved)
+    const bool work_stealing;
+
+    // sequence number of the frame in each slot (one per slot of each sub-buffer), written by the pusher before the
+    // slot is published. The pusher takes the sequence number of the frame pulled by its 'tag_source' (the input
+    // adaptor of the same thread) or numbers the frames in the round-robin order when it has no source
+    std::shared_ptr<std::vector<uint64_t>> tags;
+    const Adaptor_m_to_n* tag_source;
+    uint64_t n_pushed;
+    uint64_t cur_pull_tag;
+    // metadata of the frames of each slot ('n_frames' per slot), copied from the push task and to the pull task when
+    // the frame metadata are enabled on these tasks
+    std::shared_ptr<std::vector<runtime::frame_meta_t>> metas;
+
+    // reorder mode (a single puller): the pulled frames are moved in a window of 'reorder_window' entries (the buffers
+    // are swapped, not copied) and emitted in the order of their sequence numbers. When the window is full and the
+    // next frame is still missing, the oldest frame of the window is emitted and the missing frames will be late (they
+    // are emitted as soon as they are pulled and counted in 'n_late_frames', this counter is never reset)
+    const size_t reorder_window;
+    std::vector<std::vector<int8_t*>> window_buffers;
+    std::vector<int8_t*> window_to_free;
+    std::vector<uint64_t> window_tags;
+    std::vector<runtime::frame_meta_t> window_metas;
+    std::vector<bool> window_filled;
+    size_t window_n_filled;
+    size_t cur_window_id;
+    uint64_t next_pull_tag;
+    size_t n_late_frames;
+
+    // lock-free ring mode: one sequence number per slot and one 'head'/'tail' position per sub-buffer, all of them
+    // padded to their own cache line (the 'counter' is not used in this mode)
+    std::shared_ptr<tools::cache_aligned_vector<std::atomic<size_t>>> ring_seq;
+    std::shared_ptr<tools::cache_aligned_vector<std::atomic<size_t>>> ring_head;
+    std::shared_ptr<tools::cache_aligned_vector<std::atomic<size_t>>> ring_tail;
+
+    std::shared_ptr<tools::cache_aligned_vector<std::condition_variable>> cnd_push;
+    std::shared_ptr<tools::cache_aligned_vector<std::mutex>> mtx_push;
+    std::shared_ptr<tools::cache_aligned_vector<std::condition_variable>> cnd_pull;
+    std::shared_ptr<tools::cache_aligned_vector<std::mutex>> mtx_pull;
 
-    std::shared_ptr<std::vector<std::condition_variable>> cnd_push;
-    std::shared_ptr<std::vector<std::mutex>> mtx_push;
-    std::shared_ptr<std::vector<std::condition_variable>> cnd_pull;
-    std::shared_ptr<std::vector<std::mutex>> mtx_pull;
+    // hybrid waiting mode (passive waiting with a non-null 'spin_budget'): spin, then yield, then park
+    std::shared_ptr<tools::cache_aligned_vector<tools::Thread_parking>> park_push;
+    std::shared_ptr<tools::cache_aligned_vector<tools::Thread_parking>> park_pull;
 
     int tid_push;
     int tid_pull;
@@ -67,19 +160,58 @@ class Adaptor_m_to_n
     bool cloned;
     size_t cur_push_id;
     size_t cur_pull_id;
+    size_t cur_pull_home_id; // sub-buffer of the puller in the round-robin ('cur_pull_id' can differ when stealing)
+    size_t cur_push_slot;
+    size_t cur_pull_slot;
+    size_t cur_push_pos;
+    size_t cur_pull_pos;
+    // batched mode: number of slots already used in the current batch and number of slots claimed by the puller for
+    // the current batch (can be smaller than 'batch_size' when the waiting has been canceled)
+    size_t cur_push_batch;
+    size_t cur_pull_batch;
+    size_t cur_pull_batch_len;
 
   public:
     inline Adaptor_m_to_n(const size_t n_elmts,
                           const std::type_index datatype,
                           const size_t buffer_size = 1,
-                          const bool active_waiting = true);
+                          const bool active_waiting = true,
+                          const bool lock_free = false,
+                          const size_t spin_budget = 0,
+                          const size_t batch_size = 1,
+                          const size_t buffer_size_min = 0,
+                          const size_t buffer_size_max = 0,
+                          const bool work_stealing = false,
+                          const size_t reorder_window = 0);
     inline Adaptor_m_to_n(const std::vector<size_t>& n_elmts,
                           const std::vector<std::type_index>& datatype,
                           const size_t buffer_size = 1,
-                          const bool active_waiting = true);
+                          const bool active_waiting = true,
+                          const bool lock_free = false,
+                          const size_t spin_budget = 0,
+                          const size_t batch_size = 1,
+                          const size_t buffer_size_min = 0,
+                          const size_t buffer_size_max = 0,
+                          const bool work_stealing = false,
+                          const size_t reorder_window = 0);
     inline size_t get_n_elmts(const size_t sid = 0) const;
     inline size_t get_n_bytes(const size_t sid = 0) const;
     inline std::type_index get_datatype(const size_t sid = 0) const;
+    inline bool is_active_waiting() const;
+    inline bool is_lock_free() const;
+    inline size_t get_spin_budget() const;
+    inline size_t get_batch_size() const;
+    inline bool is_adaptive_depth() const;
+    inline size_t get_depth(const size_t id = 0) const;
+    inline bool is_work_stealing() const;
+    inline size_t get_reorder_window() const;
+    inline size_t get_n_late_frames() const;
+    inline uint64_t get_pull_tag() const;
+    void set_tag_source(const Adaptor_m_to_n* tag_source);
+    void set_pull_placement(const std::vector<std::string>& pull_placement);
+    inline const std::vector<std::string>& get_pull_placement() const;
+    // true if all the slots are still bound to the NUMA node of their puller (always false without placement)
+    bool check_pull_placement() const;
     void reset();
     virtual ~Adaptor_m_to_n();
     virtual Adaptor_m_to_n* clone() const;
@@ -91,6 +223,7 @@ class Adaptor_m_to_n
     void add_pusher();
     void add_puller();
     void alloc_buffers();
+    void flush_push();
 
   protected:
     void send_cancel_signal();
@@ -100,23 +233,47 @@ class Adaptor_m_to_n
     inline bool is_empty(const size_t id);
     inline size_t n_free_slots(const size_t id);
     inline size_t n_fill_slots(const size_t id);
+    inline bool is_hybrid_waiting() const;
+    inline bool has_free_slots(const size_t id, const size_t n);
+    inline bool has_filled_slots(const size_t id, const size_t n);
+    inline size_t n_ready_slots(const size_t id, const size_t n_max);
+    inline bool has_stealable_slots(const size_t n);
+    inline bool is_empty_all();
+    inline size_t pull_wait_id() const;
+    inline bool try_claim_push(const size_t n);
+    inline bool try_claim_pull(const size_t n);
+    inline bool try_steal_pull();
+    inline void tag_push_slot();
+    inline runtime::frame_meta_t* slot_meta(const size_t id, const size_t slot);
+    int8_t* alloc_slot(const size_t puller_id, const size_t size);
+    void free_slot(int8_t* ptr);
+    void alloc_window();
+    void free_window();
+    void reset_window();
+    inline void update_depth_push_stats(const size_t id, const bool stalled);
+    inline void update_depth_pull_stats(const size_t id, const bool stalled);
+    void adapt_depth(const size_t id);
+    void reset_depth();
 
     void set_no_copy_push(const bool no_copy_push);
     void set_no_copy_pull(const bool no_copy_pull);
     bool is_no_copy_push();
     bool is_no_copy_pull();
     void reset_buffer();
+    void reset_ring();
 
     void push(const std::vector<const int8_t*>& in, const size_t frame_id);
     void pull(const std::vector<int8_t*>& out, const size_t frame_id);
 
     void wait_push();
     void wait_pull();
+    void _wait_pull();
     void* get_empty_buffer(const size_t sid);
     void* get_filled_buffer(const size_t sid);
     void* get_empty_buffer(const size_t sid, void* swap_buffer);
     void* get_filled_buffer(const size_t sid, void* swap_buffer);
     void wake_up_pusher();
+    void _wake_up_pusher();
     void wake_up_puller();
 };
 }
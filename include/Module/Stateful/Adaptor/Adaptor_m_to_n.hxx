@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cmath>
 #include <sstream>
 #include <string>
@@ -14,27 +15,58 @@ namespace module
 Adaptor_m_to_n::Adaptor_m_to_n(const std::vector<size_t>& n_elmts,
                                const std::vector<std::type_index>& datatype,
                                const size_t buffer_size,
-                               const bool active_waiting)
+                               const bool active_waiting,
+                               const bool lock_free,
+                               const size_t spin_budget,
+                               const size_t batch_size,
+                               const size_t buffer_size_min,
+                               const size_t buffer_size_max,
+                               const bool work_stealing,
+                               const size_t reorder_window)
   : Stateful()
   , n_elmts(n_elmts)
   , n_bytes(tools::compute_bytes(n_elmts, datatype))
   , datatype(datatype)
-  , buffer_size(buffer_size)
+  , buffer_size(buffer_size_max ? buffer_size_max : buffer_size)
   , n_sockets(n_elmts.size())
   , buffer(new std::vector<std::vector<std::vector<int8_t*>>>(
       1,
-      std::vector<std::vector<int8_t*>>(n_sockets, std::vector<int8_t*>(buffer_size))))
-  , first(new std::vector<uint32_t>(1000))
-  , last(new std::vector<uint32_t>(1000))
-  , counter(new std::vector<std::atomic<uint32_t>>(1000))
+      std::vector<std::vector<int8_t*>>(n_sockets, std::vector<int8_t*>(this->buffer_size))))
+  , first(new tools::cache_aligned_vector<uint32_t>(1))
+  , last(new tools::cache_aligned_vector<uint32_t>(1))
+  , counter(new tools::cache_aligned_vector<std::atomic<uint32_t>>(1))
   , waiting_canceled(new std::atomic<bool>(false))
   , no_copy_pull(false)
   , no_copy_push(false)
   , active_waiting(active_waiting)
-  , cnd_push(new std::vector<std::condition_variable>(1000))
-  , mtx_push(new std::vector<std::mutex>(1000))
-  , cnd_pull(new std::vector<std::condition_variable>(1000))
-  , mtx_pull(new std::vector<std::mutex>(1000))
+  , lock_free(lock_free || work_stealing)
+  , spin_budget(spin_budget)
+  , batch_size(batch_size)
+  , depth_init(buffer_size)
+  , depth_min(buffer_size_min ? buffer_size_min : buffer_size)
+  , depth_max(this->buffer_size)
+  , depth_push_stats(new tools::cache_aligned_vector<depth_push_stats_t>())
+  , depth_pull_stats(new tools::cache_aligned_vector<depth_pull_stats_t>())
+  , work_stealing(work_stealing)
+  , tags(new std::vector<uint64_t>())
+  , tag_source(nullptr)
+  , n_pushed(0)
+  , cur_pull_tag(0)
+  , metas(new std::vector<runtime::frame_meta_t>())
+  , reorder_window(reorder_window)
+  , window_n_filled(0)
+  , cur_window_id(0)
+  , next_pull_tag(0)
+  , n_late_frames(0)
+  , ring_seq(new tools::cache_aligned_vector<std::atomic<size_t>>())
+  , ring_head(new tools::cache_aligned_vector<std::atomic<size_t>>())
+  , ring_tail(new tools::cache_aligned_vector<std::atomic<size_t>>())
+  , cnd_push(new tools::cache_aligned_vector<std::condition_variable>(1))
+  , mtx_push(new tools::cache_aligned_vector<std::mutex>(1))
+  , cnd_pull(new tools::cache_aligned_vector<std::condition_variable>(1))
+  , mtx_pull(new tools::cache_aligned_vector<std::mutex>(1))
+  , park_push(new tools::cache_aligned_vector<tools::Thread_parking>(1))
+  , park_pull(new tools::cache_aligned_vector<tools::Thread_parking>(1))
   , tid_push(0)
   , tid_pull(0)
   , n_pushers(new size_t(1))
@@ -44,6 +76,14 @@ Adaptor_m_to_n::Adaptor_m_to_n(const std::vector<size_t>& n_elmts,
   , cloned(false)
   , cur_push_id(0)
   , cur_pull_id(0)
+  , cur_pull_home_id(0)
+  , cur_push_slot(0)
+  , cur_pull_slot(0)
+  , cur_push_pos(0)
+  , cur_pull_pos(0)
+  , cur_push_batch(0)
+  , cur_pull_batch(0)
+  , cur_pull_batch_len(batch_size)
 {
     const std::string name = "Adaptor_m_to_n";
     this->set_name(name);
@@ -56,6 +96,31 @@ Adaptor_m_to_n::Adaptor_m_to_n(const std::vector<size_t>& n_elmts,
         throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
     }
 
+    if (this->depth_min > buffer_size)
+    {
+        std::stringstream message;
+        message << "'buffer_size_min' has to be smaller or equal to 'buffer_size' ('buffer_size_min' = "
+                << buffer_size_min << ", 'buffer_size' = " << buffer_size << ").";
+        throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (buffer_size_max && buffer_size_max < buffer_size)
+    {
+        std::stringstream message;
+        message << "'buffer_size_max' has to be greater or equal to 'buffer_size' ('buffer_size_max' = "
+                << buffer_size_max << ", 'buffer_size' = " << buffer_size << ").";
+        throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (batch_size == 0 || batch_size > this->depth_min)
+    {
+        std::stringstream message;
+        message << "'batch_size' has to be greater than 0 and smaller or equal to the minimum buffer size ("
+                << "'batch_size' = " << batch_size << ", 'buffer_size' = " << buffer_size
+                << ", 'buffer_size_min' = " << buffer_size_min << ").";
+        throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
     if (n_elmts.size() == 0)
     {
         std::stringstream message;
@@ -80,11 +145,25 @@ Adaptor_m_to_n::Adaptor_m_to_n(const std::vector<size_t>& n_elmts,
 Adaptor_m_to_n::Adaptor_m_to_n(const size_t n_elmts,
                                const std::type_index datatype,
                                const size_t buffer_size,
-                               const bool active_waiting)
+                               const bool active_waiting,
+                               const bool lock_free,
+                               const size_t spin_budget,
+                               const size_t batch_size,
+                               const size_t buffer_size_min,
+                               const size_t buffer_size_max,
+                               const bool work_stealing,
+                               const size_t reorder_window)
   : Adaptor_m_to_n(std::vector<size_t>(1, n_elmts),
                    std::vector<std::type_index>(1, datatype),
                    buffer_size,
-                   active_waiting)
+                   active_waiting,
+                   lock_free,
+                   spin_budget,
+                   batch_size,
+                   buffer_size_min,
+                   buffer_size_max,
+                   work_stealing,
+                   reorder_window)
 {
 }
 
@@ -167,28 +246,329 @@ Adaptor_m_to_n::get_datatype(const size_t sid) const
     return this->datatype[sid];
 }
 
+bool
+Adaptor_m_to_n::is_active_waiting() const
+{
+    return this->active_waiting;
+}
+
+bool
+Adaptor_m_to_n::is_lock_free() const
+{
+    return this->lock_free;
+}
+
+size_t
+Adaptor_m_to_n::get_spin_budget() const
+{
+    return this->spin_budget;
+}
+
+size_t
+Adaptor_m_to_n::get_batch_size() const
+{
+    return this->batch_size;
+}
+
+bool
+Adaptor_m_to_n::is_adaptive_depth() const
+{
+    return this->depth_min < this->depth_max;
+}
+
+size_t
+Adaptor_m_to_n::get_depth(const size_t id) const
+{
+    if (!this->is_adaptive_depth() || id >= this->depth_push_stats->size()) return this->depth_init;
+    return (*this->depth_push_stats)[id].value.depth.load(std::memory_order_relaxed);
+}
+
+bool
+Adaptor_m_to_n::is_work_stealing() const
+{
+    return this->work_stealing;
+}
+
+size_t
+Adaptor_m_to_n::get_reorder_window() const
+{
+    return this->reorder_window;
+}
+
+const std::vector<std::string>&
+Adaptor_m_to_n::get_pull_placement() const
+{
+    return this->pull_placement;
+}
+
+size_t
+Adaptor_m_to_n::get_n_late_frames() const
+{
+    return this->n_late_frames;
+}
+
+uint64_t
+Adaptor_m_to_n::get_pull_tag() const
+{
+    return this->cur_pull_tag;
+}
+
+bool
+Adaptor_m_to_n::is_hybrid_waiting() const
+{
+    return !this->active_waiting && this->spin_budget > 0;
+}
+
 bool
 Adaptor_m_to_n::is_empty(const size_t id)
 {
-    return (*this->counter)[id] == this->buffer_size;
+    if (this->lock_free)
+    {
+        const size_t pos = (*this->ring_tail)[id].value.load(std::memory_order_relaxed);
+        const size_t seq =
+          (*this->ring_seq)[id * this->buffer_size + pos % this->buffer_size].value.load(std::memory_order_acquire);
+        return (std::ptrdiff_t)(seq - (2 * pos + 1)) < 0;
+    }
+    return (*this->counter)[id].value == this->buffer_size;
 }
 
 bool
 Adaptor_m_to_n::is_full(const size_t id)
 {
-    return (*this->counter)[id] == 0;
+    if (this->lock_free)
+    {
+        const size_t pos = (*this->ring_head)[id].value.load(std::memory_order_relaxed);
+        const size_t seq =
+          (*this->ring_seq)[id * this->buffer_size + pos % this->buffer_size].value.load(std::memory_order_acquire);
+        return (std::ptrdiff_t)(seq - 2 * pos) < 0;
+    }
+    return (*this->counter)[id].value == 0;
 }
 
 size_t
 Adaptor_m_to_n::n_fill_slots(const size_t id)
 {
-    return this->buffer_size - (*this->counter)[id];
+    if (this->lock_free)
+        return (*this->ring_head)[id].value.load(std::memory_order_relaxed) -
+               (*this->ring_tail)[id].value.load(std::memory_order_relaxed);
+    return this->buffer_size - (*this->counter)[id].value;
 }
 
 size_t
 Adaptor_m_to_n::n_free_slots(const size_t id)
 {
-    return (*this->counter)[id];
+    if (this->lock_free) return this->buffer_size - this->n_fill_slots(id);
+    return (*this->counter)[id].value;
+}
+
+bool
+Adaptor_m_to_n::has_free_slots(const size_t id, const size_t n)
+{
+    if (this->lock_free)
+    {
+        // the slots are given back in order, if the last slot of the batch is free then the previous ones are too
+        const size_t pos = (*this->ring_head)[id].value.load(std::memory_order_relaxed) + n - 1;
+        const size_t seq =
+          (*this->ring_seq)[id * this->buffer_size + pos % this->buffer_size].value.load(std::memory_order_acquire);
+        if ((std::ptrdiff_t)(seq - 2 * pos) < 0) return false;
+        return !this->is_adaptive_depth() || this->n_fill_slots(id) + n <= this->get_depth(id);
+    }
+    const uint32_t n_free = (*this->counter)[id].value;
+    return n_free >= n && (!this->is_adaptive_depth() || this->buffer_size - n_free + n <= this->get_depth(id));
+}
+
+bool
+Adaptor_m_to_n::has_filled_slots(const size_t id, const size_t n)
+{
+    if (this->lock_free)
+    {
+        // the slots are published in order, if the last slot of the batch is filled then the previous ones are too
+        const size_t pos = (*this->ring_tail)[id].value.load(std::memory_order_relaxed) + n - 1;
+        const size_t seq =
+          (*this->ring_seq)[id * this->buffer_size + pos % this->buffer_size].value.load(std::memory_order_acquire);
+        return (std::ptrdiff_t)(seq - (2 * pos + 1)) >= 0;
+    }
+    return this->buffer_size - (*this->counter)[id].value >= n;
+}
+
+size_t
+Adaptor_m_to_n::n_ready_slots(const size_t id, const size_t n_max)
+{
+    if (this->lock_free)
+    {
+        // 'head - tail' also counts the slots claimed by the pusher but not published yet
+        size_t n = 0;
+        while (n < n_max && this->has_filled_slots(id, n + 1))
+            n++;
+        return n;
+    }
+    return std::min(n_max, this->n_fill_slots(id));
+}
+
+bool
+Adaptor_m_to_n::has_stealable_slots(const size_t n)
+{
+    for (size_t id = 0; id < this->buffer->size(); id++)
+        if (this->has_filled_slots(id, n)) return true;
+    return false;
+}
+
+bool
+Adaptor_m_to_n::is_empty_all()
+{
+    for (size_t id = 0; id < this->buffer->size(); id++)
+        if (!this->is_empty(id)) return false;
+    return true;
+}
+
+// in work-stealing mode, all the pullers wait on the parking (or on the condition variable) of the first sub-buffer:
+// a new batch in any sub-buffer can wake any of them up
+size_t
+Adaptor_m_to_n::pull_wait_id() const
+{
+    return this->work_stealing ? 0 : this->cur_pull_id;
+}
+
+void
+Adaptor_m_to_n::update_depth_push_stats(const size_t id, const bool stalled)
+{
+    auto& stats = (*this->depth_push_stats)[id].value;
+    const auto t_cur = std::chrono::steady_clock::now();
+    if (stats.n_claims)
+    {
+        const double dt = std::chrono::duration<double, std::nano>(t_cur - stats.t_last).count();
+        stats.sum_dt += dt;
+        stats.sum_dt2 += dt * dt;
+    }
+    stats.t_last = t_cur;
+    stats.n_stalls += stalled ? 1 : 0;
+    stats.occupancy[std::min(this->n_fill_slots(id), this->buffer_size)]++;
+    if (++stats.n_claims == Adaptor_m_to_n::depth_window) this->adapt_depth(id);
+}
+
+void
+Adaptor_m_to_n::update_depth_pull_stats(const size_t id, const bool stalled)
+{
+    auto& stats = (*this->depth_pull_stats)[id].value;
+    const auto t_cur = std::chrono::steady_clock::now();
+    const uint64_t n_claims = stats.n_claims.load(std::memory_order_relaxed);
+    if (n_claims)
+    {
+        const double dt = std::chrono::duration<double, std::nano>(t_cur - stats.t_last).count();
+        stats.sum_dt.store(stats.sum_dt.load(std::memory_order_relaxed) + dt, std::memory_order_relaxed);
+        stats.sum_dt2.store(stats.sum_dt2.load(std::memory_order_relaxed) + dt * dt, std::memory_order_relaxed);
+    }
+    stats.t_last = t_cur;
+    if (stalled) stats.n_stalls.store(stats.n_stalls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    stats.n_claims.store(n_claims + 1, std::memory_order_relaxed);
+}
+
+// Vyukov's bounded queue: a slot is free for the pusher at position 'pos' when its sequence number is equal to
+// '2 * pos', and it is filled for the puller at position 'pos' when its sequence number is equal to '2 * pos + 1' (the
+// sequence numbers are doubled to remain unambiguous when 'buffer_size' is 1). Each sub-buffer has a single pusher and
+// a single puller (SPSC): the positions are owned by one thread and a plain store is enough to claim a slot, except
+// on the pull side in work-stealing mode where several pullers can claim in the same sub-buffer with a CAS. 'n'
+// contiguous slots are claimed at once by checking the sequence number of the last one (the slots are always published
+// and given back in order).
+bool
+Adaptor_m_to_n::try_claim_push(const size_t n)
+{
+    auto& head = (*this->ring_head)[this->cur_push_id].value;
+    const size_t offset = this->cur_push_id * this->buffer_size;
+    size_t pos = head.load(std::memory_order_relaxed);
+    while (true)
+    {
+        const size_t last = pos + n - 1;
+        const size_t seq = (*this->ring_seq)[offset + last % this->buffer_size].value.load(std::memory_order_acquire);
+        const std::ptrdiff_t dif = (std::ptrdiff_t)(seq - 2 * last);
+        if (dif == 0)
+        {
+            head.store(pos + n, std::memory_order_relaxed);
+            this->cur_push_slot = pos % this->buffer_size;
+            this->cur_push_pos = pos;
+            return true;
+        }
+        else if (dif < 0) // the sub-buffer is full
+            return false;
+        else
+            pos = head.load(std::memory_order_relaxed);
+    }
+}
+
+bool
+Adaptor_m_to_n::try_claim_pull(const size_t n)
+{
+    auto& tail = (*this->ring_tail)[this->cur_pull_id].value;
+    const size_t offset = this->cur_pull_id * this->buffer_size;
+    size_t pos = tail.load(std::memory_order_relaxed);
+    while (true)
+    {
+        const size_t last = pos + n - 1;
+        const size_t seq = (*this->ring_seq)[offset + last % this->buffer_size].value.load(std::memory_order_acquire);
+        const std::ptrdiff_t dif = (std::ptrdiff_t)(seq - (2 * last + 1));
+        if (dif == 0)
+        {
+            if (!this->work_stealing)
+                tail.store(pos + n, std::memory_order_relaxed);
+            else if (!tail.compare_exchange_weak(pos, pos + n, std::memory_order_relaxed))
+                continue;
+            this->cur_pull_slot = pos % this->buffer_size;
+            this->cur_pull_pos = pos;
+            return true;
+        }
+        else if (dif < 0) // the sub-buffer is empty
+            return false;
+        else
+            pos = tail.load(std::memory_order_relaxed);
+    }
+}
+
+runtime::frame_meta_t*
+Adaptor_m_to_n::slot_meta(const size_t id, const size_t slot)
+{
+    return this->metas->data() + (id * this->buffer_size + slot) * this->n_frames;
+}
+
+// the sequence number (and the frame metadata) are written in the slot before its publication (see 'flush_push()'),
+// without source the 'k'-th frame of the pusher 'p' gets its index in the round-robin order: the pushers take turns by
+// batches of 'batch_size' frames
+void
+Adaptor_m_to_n::tag_push_slot()
+{
+    uint64_t tag;
+    if (this->tag_source)
+        tag = this->tag_source->get_pull_tag();
+    else
+    {
+        const uint64_t k = this->n_pushed;
+        tag = ((k / this->batch_size) * *this->n_pushers + (uint64_t)this->tid_push) * this->batch_size +
+              k % this->batch_size;
+    }
+    (*this->tags)[this->cur_push_id * this->buffer_size + this->cur_push_slot] = tag;
+    this->n_pushed++;
+
+    const runtime::frame_meta_t* meta = this->tasks[0]->get_frame_meta(); // push task
+    if (meta != nullptr)
+        std::copy(meta, meta + this->n_frames, this->slot_meta(this->cur_push_id, this->cur_push_slot));
+}
+
+// the puller first tries its own sub-buffer and then the following ones, 'cur_pull_id' is left on the sub-buffer where
+// the batch has been claimed (then the slots are given back to the right pusher)
+bool
+Adaptor_m_to_n::try_steal_pull()
+{
+    const size_t n_sub_buffers = this->buffer->size();
+    for (size_t i = 0; i < n_sub_buffers; i++)
+    {
+        this->cur_pull_id = (this->cur_pull_home_id + i) % n_sub_buffers;
+        // when the waiting has been canceled, the last batch of a sub-buffer can be incomplete (see 'flush_push()')
+        this->cur_pull_batch_len = *this->waiting_canceled
+                                     ? this->n_ready_slots(this->cur_pull_id, this->batch_size)
+                                     : this->batch_size;
+        if (this->cur_pull_batch_len && this->try_claim_pull(this->cur_pull_batch_len)) return true;
+    }
+    this->cur_pull_id = this->cur_pull_home_id;
+    return false;
 }
 
 }
@@ -12,6 +12,7 @@
 #include "Module/Stateful/Stateful.hpp"
 #include "Runtime/Socket/Socket.hpp"
 #include "Runtime/Task/Task.hpp"
+#include "Tools/Interface/Interface_elementwise.hpp"
 #include "Tools/Math/binaryop.h"
 
 namespace spu
@@ -47,7 +48,9 @@ enum class performf : size_t
 }
 
 template<typename TI, typename TO, tools::proto_bop<TI, TO> BOP>
-class Binaryop : public Stateful
+class Binaryop
+  : public Stateful
+  , public tools::Interface_elementwise
 {
   public:
     inline runtime::Task& operator[](const bop::tsk t);
@@ -57,6 +60,8 @@ class Binaryop : public Stateful
 
   protected:
     const size_t n_elmts;
+    const size_t n_in0;
+    const size_t n_in1;
 
   public:
     Binaryop(const size_t n_in0, const size_t n_in1);
@@ -75,6 +80,9 @@ class Binaryop : public Stateful
 
     void perform(const TI* in0, const TI* in1, TO* out, const int frame_id = -1, const bool managed_memory = true);
 
+    virtual bool is_elementwise(const runtime::Task& task) const;
+    virtual void perform_elmts(const runtime::Task& task, const void* const* in, void* out, const size_t n) const;
+
   protected:
     virtual void _perform(const TI* in0, const TI* in1, TO* out, const size_t frame_id);
     virtual void _perform(const TI in0, const TI* in1, TO* out, const size_t frame_id);
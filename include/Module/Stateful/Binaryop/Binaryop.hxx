@@ -1,3 +1,5 @@
+#include <typeinfo>
+
 #include "Module/Stateful/Binaryop/Binaryop.hpp"
 
 namespace spu
@@ -37,6 +39,8 @@ template<typename TI, typename TO, tools::proto_bop<TI, TO> BOP>
 Binaryop<TI, TO, BOP>::Binaryop(const size_t n_in0, const size_t n_in1)
   : Stateful()
   , n_elmts(n_in0 > n_in1 ? n_in0 : n_in1)
+  , n_in0(n_in0)
+  , n_in1(n_in1)
 {
     const std::string name = "Binaryop";
     this->set_name(name + "<" + tools::bop_get_name<TI, TO, BOP>() + ">");
@@ -71,42 +75,36 @@ Binaryop<TI, TO, BOP>::Binaryop(const size_t n_in0, const size_t n_in1)
 
     if (n_in0 == 1)
     {
-        this->create_codelet(p,
-                             [ps_in0, ps_in1, ps_out](Module& m, runtime::Task& t, const size_t frame_id) -> int
-                             {
-                                 auto& bop = static_cast<Binaryop&>(m);
-                                 bop._perform(*t[ps_in0].template get_dataptr<const TI>(),
-                                              t[ps_in1].template get_dataptr<const TI>(),
-                                              t[ps_out].template get_dataptr<TO>(),
-                                              frame_id);
-                                 return runtime::status_t::SUCCESS;
-                             });
+        this->template create_codelet<const TI, const TI, TO>(
+          p,
+          { { ps_in0, ps_in1, ps_out } },
+          [](Module& m, runtime::Task& t, const TI* in0, const TI* in1, TO* out, const size_t frame_id) -> int
+          {
+              static_cast<Binaryop&>(m)._perform(*in0, in1, out, frame_id);
+              return runtime::status_t::SUCCESS;
+          });
     }
     else if (n_in1 == 1)
     {
-        this->create_codelet(p,
-                             [ps_in0, ps_in1, ps_out](Module& m, runtime::Task& t, const size_t frame_id) -> int
-                             {
-                                 auto& bop = static_cast<Binaryop&>(m);
-                                 bop._perform(t[ps_in0].template get_dataptr<const TI>(),
-                                              *t[ps_in1].template get_dataptr<const TI>(),
-                                              t[ps_out].template get_dataptr<TO>(),
-                                              frame_id);
-                                 return runtime::status_t::SUCCESS;
-                             });
+        this->template create_codelet<const TI, const TI, TO>(
+          p,
+          { { ps_in0, ps_in1, ps_out } },
+          [](Module& m, runtime::Task& t, const TI* in0, const TI* in1, TO* out, const size_t frame_id) -> int
+          {
+              static_cast<Binaryop&>(m)._perform(in0, *in1, out, frame_id);
+              return runtime::status_t::SUCCESS;
+          });
     }
     else
     {
-        this->create_codelet(p,
-                             [ps_in0, ps_in1, ps_out](Module& m, runtime::Task& t, const size_t frame_id) -> int
-                             {
-                                 auto& bop = static_cast<Binaryop&>(m);
-                                 bop._perform(t[ps_in0].template get_dataptr<const TI>(),
-                                              t[ps_in1].template get_dataptr<const TI>(),
-                                              t[ps_out].template get_dataptr<TO>(),
-                                              frame_id);
-                                 return runtime::status_t::SUCCESS;
-                             });
+        this->template create_codelet<const TI, const TI, TO>(
+          p,
+          { { ps_in0, ps_in1, ps_out } },
+          [](Module& m, runtime::Task& t, const TI* in0, const TI* in1, TO* out, const size_t frame_id) -> int
+          {
+              static_cast<Binaryop&>(m)._perform(in0, in1, out, frame_id);
+              return runtime::status_t::SUCCESS;
+          });
     }
 
     auto& p2 = this->create_task("performf");
@@ -115,23 +113,23 @@ Binaryop<TI, TO, BOP>::Binaryop(const size_t n_in0, const size_t n_in1)
 
     if (n_in0 == 1)
     {
-        this->create_codelet(
+        this->template create_codelet<const TI, TI>(
           p2,
-          [p2_in, p2_fwd](Module& m, runtime::Task& t, const size_t frame_id) -> int
+          { { p2_in, p2_fwd } },
+          [](Module& m, runtime::Task& t, const TI* in, TI* fwd, const size_t frame_id) -> int
           {
-              auto& bop = static_cast<Binaryop&>(m);
-              bop._perform(*t[p2_in].template get_dataptr<const TI>(), t[p2_fwd].template get_dataptr<TI>(), frame_id);
+              static_cast<Binaryop&>(m)._perform(*in, fwd, frame_id);
               return runtime::status_t::SUCCESS;
           });
     }
     else
     {
-        this->create_codelet(
+        this->template create_codelet<const TI, TI>(
           p2,
-          [p2_in, p2_fwd](Module& m, runtime::Task& t, const size_t frame_id) -> int
+          { { p2_in, p2_fwd } },
+          [](Module& m, runtime::Task& t, const TI* in, TI* fwd, const size_t frame_id) -> int
           {
-              auto& bop = static_cast<Binaryop&>(m);
-              bop._perform(t[p2_in].template get_dataptr<const TI>(), t[p2_fwd].template get_dataptr<TI>(), frame_id);
+              static_cast<Binaryop&>(m)._perform(in, fwd, frame_id);
               return runtime::status_t::SUCCESS;
           });
     }
@@ -184,6 +182,34 @@ Binaryop<TI, TO, BOP>::perform(const TI* in0, const TI* in1, TO* out, const int
     (*this)[bop::tsk::perform].exec(frame_id, managed_memory);
 }
 
+template<typename TI, typename TO, tools::proto_bop<TI, TO> BOP>
+bool
+Binaryop<TI, TO, BOP>::is_elementwise(const runtime::Task& task) const
+{
+    // a derived module can override the '_perform' methods: it has to opt in by overriding this method
+    if (typeid(*this) != typeid(Binaryop<TI, TO, BOP>)) return false;
+    // the 'performf' task is not considered because its output is also an input
+    return &task == this->tasks[(size_t)bop::tsk::perform].get();
+}
+
+template<typename TI, typename TO, tools::proto_bop<TI, TO> BOP>
+void
+Binaryop<TI, TO, BOP>::perform_elmts(const runtime::Task& task, const void* const* in, void* out, const size_t n) const
+{
+    const TI* in0 = static_cast<const TI*>(in[0]);
+    const TI* in1 = static_cast<const TI*>(in[1]);
+    TO* out_elmts = static_cast<TO*>(out);
+    if (this->n_in0 == 1)
+        for (size_t e = 0; e < n; e++)
+            out_elmts[e] = BOP(in0[0], in1[e]);
+    else if (this->n_in1 == 1)
+        for (size_t e = 0; e < n; e++)
+            out_elmts[e] = BOP(in0[e], in1[0]);
+    else
+        for (size_t e = 0; e < n; e++)
+            out_elmts[e] = BOP(in0[e], in1[e]);
+}
+
 template<typename TI, typename TO, tools::proto_bop<TI, TO> BOP>
 void
 Binaryop<TI, TO, BOP>::_perform(const TI* in0, const TI* in1, TO* out, const size_t frame_id)
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "Module/Stateful/Stateful.hpp"
+#include "Tools/Algo/Shared_data/Shared_data.hpp"
 
 namespace spu
 {
@@ -47,7 +48,8 @@ class Delayer : public Stateful
   protected:
     const size_t size; // Size of one frame (= number of datas in one frame)
     const D init_val;
-    std::vector<D> data;
+    // shared with the clones until their first 'memorize' (copy-on-write)
+    tools::Shared_data<std::vector<D>> data;
 
   public:
     Delayer(const size_t size, const D init_val);
@@ -6,8 +6,11 @@
 #define INITIALIZER_HPP_
 
 #include <cstdint>
+#include <memory>
+#include <vector>
 
 #include "Module/Stateful/Stateful.hpp"
+#include "Tools/Algo/Shared_data/Shared_data.hpp"
 
 namespace spu
 {
@@ -40,7 +43,8 @@ class Initializer : public Stateful
     inline runtime::Socket& operator[](const std::string& tsk_sck);
 
   protected:
-    std::vector<std::vector<T>> init_data;
+    // shared with the clones, a clone gets its own copy when its data are set (copy-on-write)
+    tools::Shared_data<std::vector<std::vector<T>>> init_data;
     size_t ns;
 
   public:
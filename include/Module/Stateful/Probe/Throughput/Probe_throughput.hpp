@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "Module/Stateful/Probe/Probe.hpp"
+#include "Tools/System/Clock.hpp"
 
 namespace spu
 {
@@ -19,7 +20,7 @@ namespace module
 class Probe_throughput : public Probe<uint8_t>
 {
   protected:
-    std::chrono::time_point<std::chrono::steady_clock> t_start;
+    tools::Clock::time_point t_start;
     size_t data_size;
     double thr;
     double factor;
@@ -46,12 +46,12 @@ Reducer<TI, TO, BOP>::Reducer(const size_t n_elmts)
     auto& p = this->create_task("reduce");
     auto ps_in = this->template create_socket_in<TI>(p, "in", this->n_elmts);
     auto ps_out = this->template create_socket_out<TO>(p, "out", 1);
-    this->create_codelet(
+    this->template create_codelet<const TI, TO>(
       p,
-      [ps_in, ps_out](Module& m, runtime::Task& t, const size_t frame_id) -> int
+      { { ps_in, ps_out } },
+      [](Module& m, runtime::Task& t, const TI* in, TO* out, const size_t frame_id) -> int
       {
-          auto& red = static_cast<Reducer&>(m);
-          red._reduce(t[ps_in].template get_dataptr<const TI>(), t[ps_out].template get_dataptr<TO>(), frame_id);
+          static_cast<Reducer&>(m)._reduce(in, out, frame_id);
           return runtime::status_t::SUCCESS;
       });
 }
@@ -5,6 +5,7 @@
 #ifndef SOURCE_USER_HPP_
 #define SOURCE_USER_HPP_
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -18,7 +19,7 @@ template<typename B = int>
 class Source_user : public Source<B>
 {
   private:
-    std::vector<std::vector<B>> source;
+    std::shared_ptr<const std::vector<std::vector<B>>> source; // read-only, shared by the clones
     int next_frame_idx;
     int src_counter;
     const bool auto_reset;
@@ -114,11 +114,13 @@ Switcher::Switcher(const size_t n_data_sockets,
                          [p2s_in_data, p2s_out_data](Module& m, runtime::Task& t, const size_t frame_id) -> int
                          {
                              auto& swi = static_cast<Switcher&>(m);
+                             const size_t path = swi.get_path();
+
+                             // the frames come from the selected path (and not from the first input socket)
+                             if (t.is_frame_meta()) t.copy_frame_meta(t[p2s_in_data[path]].get_frame_meta());
 
                              if (!swi.is_no_copy_select())
                              {
-                                 const size_t path = swi.get_path();
-
                                  const auto data_socket_in = t[p2s_in_data[path]].get_dataptr<const int8_t>();
                                  auto data_socket_out = t[p2s_out_data].get_dataptr<int8_t>();
 
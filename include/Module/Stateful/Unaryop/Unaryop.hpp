@@ -12,6 +12,7 @@
 #include "Module/Stateful/Stateful.hpp"
 #include "Runtime/Socket/Socket.hpp"
 #include "Runtime/Task/Task.hpp"
+#include "Tools/Interface/Interface_elementwise.hpp"
 #include "Tools/Math/unaryop.h"
 
 namespace spu
@@ -39,7 +40,9 @@ enum class perform : size_t
 }
 
 template<typename TI, typename TO, tools::proto_uop<TI, TO> UOP>
-class Unaryop : public Stateful
+class Unaryop
+  : public Stateful
+  , public tools::Interface_elementwise
 {
   public:
     inline runtime::Task& operator[](const uop::tsk t);
@@ -64,6 +67,9 @@ class Unaryop : public Stateful
 
     void perform(const TI* in, TO* out, const int frame_id = -1, const bool managed_memory = true);
 
+    virtual bool is_elementwise(const runtime::Task& task) const;
+    virtual void perform_elmts(const runtime::Task& task, const void* const* in, void* out, const size_t n) const;
+
   protected:
     virtual void _perform(const TI* in, TO* out, const size_t frame_id);
 };
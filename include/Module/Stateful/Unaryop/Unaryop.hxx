@@ -1,3 +1,5 @@
+#include <typeinfo>
+
 #include "Module/Stateful/Unaryop/Unaryop.hpp"
 
 namespace spu
@@ -45,12 +47,12 @@ Unaryop<TI, TO, UOP>::Unaryop(const size_t n_elmts)
     auto& p = this->create_task("perform");
     auto ps_in = this->template create_socket_in<TI>(p, "in", this->n_elmts);
     auto ps_out = this->template create_socket_out<TO>(p, "out", this->n_elmts);
-    this->create_codelet(
+    this->template create_codelet<const TI, TO>(
       p,
-      [ps_in, ps_out](Module& m, runtime::Task& t, const size_t frame_id) -> int
+      { { ps_in, ps_out } },
+      [](Module& m, runtime::Task& t, const TI* in, TO* out, const size_t frame_id) -> int
       {
-          auto& uop = static_cast<Unaryop&>(m);
-          uop._perform(t[ps_in].template get_dataptr<const TI>(), t[ps_out].template get_dataptr<TO>(), frame_id);
+          static_cast<Unaryop&>(m)._perform(in, out, frame_id);
           return runtime::status_t::SUCCESS;
       });
 }
@@ -93,6 +95,25 @@ Unaryop<TI, TO, UOP>::perform(const TI* in, TO* out, const int frame_id, const b
     (*this)[uop::tsk::perform].exec(frame_id, managed_memory);
 }
 
+template<typename TI, typename TO, tools::proto_uop<TI, TO> UOP>
+bool
+Unaryop<TI, TO, UOP>::is_elementwise(const runtime::Task& task) const
+{
+    // a derived module can override '_perform': it has to opt in by overriding this method
+    if (typeid(*this) != typeid(Unaryop<TI, TO, UOP>)) return false;
+    return &task == this->tasks[(size_t)uop::tsk::perform].get();
+}
+
+template<typename TI, typename TO, tools::proto_uop<TI, TO> UOP>
+void
+Unaryop<TI, TO, UOP>::perform_elmts(const runtime::Task& task, const void* const* in, void* out, const size_t n) const
+{
+    const TI* in_elmts = static_cast<const TI*>(in[0]);
+    TO* out_elmts = static_cast<TO*>(out);
+    for (size_t e = 0; e < n; e++)
+        out_elmts[e] = UOP(in_elmts[e]);
+}
+
 template<typename TI, typename TO, tools::proto_uop<TI, TO> UOP>
 void
 Unaryop<TI, TO, UOP>::_perform(const TI* in, TO* out, const size_t frame_id)
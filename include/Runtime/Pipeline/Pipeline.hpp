@@ -70,7 +70,13 @@ class Pipeline : public tools::Interface_get_set_n_frames
              const std::vector<size_t> &synchro_buffer_sizes = {},
              const std::vector<bool> &synchro_active_waiting = {},
              const std::vector<bool> &thread_pinning = {},
-             const std::vector<std::vector<size_t>> &puids = {}/*,
+             const std::vector<std::vector<size_t>> &puids = {},
+             const std::vector<bool> &synchro_lock_free = {},
+             const std::vector<size_t> &synchro_spin_budgets = {},
+             const std::vector<size_t> &synchro_batch_sizes = {},
+             const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds = {},
+             const std::vector<bool> &synchro_work_stealing = {},
+             const std::vector<size_t> &synchro_reorder_windows = {}/*,
              const std::vector<bool> &tasks_inplace = {}*/);
     Pipeline(const std::vector<runtime::Task*> &firsts,
              const std::vector<runtime::Task*> &lasts,
@@ -79,7 +85,13 @@ class Pipeline : public tools::Interface_get_set_n_frames
              const std::vector<size_t> &synchro_buffer_sizes = {},
              const std::vector<bool> &synchro_active_waiting = {},
              const std::vector<bool> &thread_pinning = {},
-             const std::vector<std::vector<size_t>> &puids = {}/*,
+             const std::vector<std::vector<size_t>> &puids = {},
+             const std::vector<bool> &synchro_lock_free = {},
+             const std::vector<size_t> &synchro_spin_budgets = {},
+             const std::vector<size_t> &synchro_batch_sizes = {},
+             const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds = {},
+             const std::vector<bool> &synchro_work_stealing = {},
+             const std::vector<size_t> &synchro_reorder_windows = {}/*,
              const std::vector<bool> &tasks_inplace = {}*/);
     Pipeline(const std::vector<runtime::Task*> &firsts,
              const std::vector<std::tuple<std::vector<runtime::Task*>, std::vector<runtime::Task*>, std::vector<runtime::Task*>>> &sep_stages = {},
@@ -87,7 +99,13 @@ class Pipeline : public tools::Interface_get_set_n_frames
              const std::vector<size_t> &synchro_buffer_sizes = {},
              const std::vector<bool> &synchro_active_waiting = {},
              const std::vector<bool> &thread_pinning = {},
-             const std::vector<std::vector<size_t>> &puids = {}/*,
+             const std::vector<std::vector<size_t>> &puids = {},
+             const std::vector<bool> &synchro_lock_free = {},
+             const std::vector<size_t> &synchro_spin_budgets = {},
+             const std::vector<size_t> &synchro_batch_sizes = {},
+             const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds = {},
+             const std::vector<bool> &synchro_work_stealing = {},
+             const std::vector<size_t> &synchro_reorder_windows = {}/*,
              const std::vector<bool> &tasks_inplace = {}*/);
     Pipeline(const std::vector<runtime::Task*> &firsts,
              const std::vector<std::pair<std::vector<runtime::Task*>, std::vector<runtime::Task*>>> &sep_stages = {},
@@ -95,7 +113,13 @@ class Pipeline : public tools::Interface_get_set_n_frames
              const std::vector<size_t> &synchro_buffer_sizes = {},
              const std::vector<bool> &synchro_active_waiting = {},
              const std::vector<bool> &thread_pinning = {},
-             const std::vector<std::vector<size_t>> &puids = {}/*,
+             const std::vector<std::vector<size_t>> &puids = {},
+             const std::vector<bool> &synchro_lock_free = {},
+             const std::vector<size_t> &synchro_spin_budgets = {},
+             const std::vector<size_t> &synchro_batch_sizes = {},
+             const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds = {},
+             const std::vector<bool> &synchro_work_stealing = {},
+             const std::vector<size_t> &synchro_reorder_windows = {}/*,
              const std::vector<bool> &tasks_inplace = {}*/);
     Pipeline(runtime::Task &first,
              const std::vector<std::pair<std::vector<runtime::Task*>, std::vector<runtime::Task*>>> &sep_stages = {},
@@ -103,7 +127,13 @@ class Pipeline : public tools::Interface_get_set_n_frames
              const std::vector<size_t> &synchro_buffer_sizes = {},
              const std::vector<bool> &synchro_active_waiting = {},
              const std::vector<bool> &thread_pinning = {},
-             const std::vector<std::vector<size_t>> &puids = {}/*,
+             const std::vector<std::vector<size_t>> &puids = {},
+             const std::vector<bool> &synchro_lock_free = {},
+             const std::vector<size_t> &synchro_spin_budgets = {},
+             const std::vector<size_t> &synchro_batch_sizes = {},
+             const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds = {},
+             const std::vector<bool> &synchro_work_stealing = {},
+             const std::vector<size_t> &synchro_reorder_windows = {}/*,
              const std::vector<bool> &tasks_inplace = {}*/);
     Pipeline(runtime::Task &first,
              runtime::Task &last,
@@ -112,7 +142,13 @@ class Pipeline : public tools::Interface_get_set_n_frames
              const std::vector<size_t> &synchro_buffer_sizes = {},
              const std::vector<bool> &synchro_active_waiting = {},
              const std::vector<bool> &thread_pinning = {},
-             const std::vector<std::vector<size_t>> &puids = {}/*,
+             const std::vector<std::vector<size_t>> &puids = {},
+             const std::vector<bool> &synchro_lock_free = {},
+             const std::vector<size_t> &synchro_spin_budgets = {},
+             const std::vector<size_t> &synchro_batch_sizes = {},
+             const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds = {},
+             const std::vector<bool> &synchro_work_stealing = {},
+             const std::vector<size_t> &synchro_reorder_windows = {}/*,
              const std::vector<bool> &tasks_inplace = {}*/);
 
     // Constructors for pinning second version
@@ -123,7 +159,13 @@ class Pipeline : public tools::Interface_get_set_n_frames
              const std::vector<size_t> &synchro_buffer_sizes,
              const std::vector<bool> &synchro_active_waiting,
              const std::vector<bool> &thread_pinning,
-             const std::string &pipeline_pinning_policy/*,
+             const std::string &pipeline_pinning_policy,
+             const std::vector<bool> &synchro_lock_free = {},
+             const std::vector<size_t> &synchro_spin_budgets = {},
+             const std::vector<size_t> &synchro_batch_sizes = {},
+             const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds = {},
+             const std::vector<bool> &synchro_work_stealing = {},
+             const std::vector<size_t> &synchro_reorder_windows = {}/*,
              const std::vector<bool> &tasks_inplace = {}*/);
     Pipeline(const std::vector<runtime::Task*> &firsts,
              const std::vector<runtime::Task*> &lasts,
@@ -132,7 +174,13 @@ class Pipeline : public tools::Interface_get_set_n_frames
              const std::vector<size_t> &synchro_buffer_sizes,
              const std::vector<bool> &synchro_active_waiting,
              const std::vector<bool> &thread_pinning,
-             const std::string &pipeline_pinning_policy/*,
+             const std::string &pipeline_pinning_policy,
+             const std::vector<bool> &synchro_lock_free = {},
+             const std::vector<size_t> &synchro_spin_budgets = {},
+             const std::vector<size_t> &synchro_batch_sizes = {},
+             const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds = {},
+             const std::vector<bool> &synchro_work_stealing = {},
+             const std::vector<size_t> &synchro_reorder_windows = {}/*,
              const std::vector<bool> &tasks_inplace = {}*/);
     Pipeline(const std::vector<runtime::Task*> &firsts,
              const std::vector<std::tuple<std::vector<runtime::Task*>, std::vector<runtime::Task*>, std::vector<runtime::Task*>>> &sep_stages,
@@ -140,7 +188,13 @@ class Pipeline : public tools::Interface_get_set_n_frames
              const std::vector<size_t> &synchro_buffer_sizes,
              const std::vector<bool> &synchro_active_waiting,
              const std::vector<bool> &thread_pinning,
-             const std::string &pipeline_pinning_policy/*,
+             const std::string &pipeline_pinning_policy,
+             const std::vector<bool> &synchro_lock_free = {},
+             const std::vector<size_t> &synchro_spin_budgets = {},
+             const std::vector<size_t> &synchro_batch_sizes = {},
+             const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds = {},
+             const std::vector<bool> &synchro_work_stealing = {},
+             const std::vector<size_t> &synchro_reorder_windows = {}/*,
              const std::vector<bool> &tasks_inplace = {}*/);
     Pipeline(const std::vector<runtime::Task*> &firsts,
              const std::vector<std::pair<std::vector<runtime::Task*>, std::vector<runtime::Task*>>> &sep_stages,
@@ -148,7 +202,13 @@ class Pipeline : public tools::Interface_get_set_n_frames
              const std::vector<size_t> &synchro_buffer_sizes,
              const std::vector<bool> &synchro_active_waiting,
              const std::vector<bool> &thread_pinning,
-             const std::string &pipeline_pinning_policy/*,
+             const std::string &pipeline_pinning_policy,
+             const std::vector<bool> &synchro_lock_free = {},
+             const std::vector<size_t> &synchro_spin_budgets = {},
+             const std::vector<size_t> &synchro_batch_sizes = {},
+             const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds = {},
+             const std::vector<bool> &synchro_work_stealing = {},
+             const std::vector<size_t> &synchro_reorder_windows = {}/*,
              const std::vector<bool> &tasks_inplace = {}*/);
     Pipeline(runtime::Task &first,
              const std::vector<std::pair<std::vector<runtime::Task*>, std::vector<runtime::Task*>>> &sep_stages,
@@ -156,7 +216,13 @@ class Pipeline : public tools::Interface_get_set_n_frames
              const std::vector<size_t> &synchro_buffer_sizes,
              const std::vector<bool> &synchro_active_waiting,
              const std::vector<bool> &thread_pinning,
-             const std::string &pipeline_pinning_policy/*,
+             const std::string &pipeline_pinning_policy,
+             const std::vector<bool> &synchro_lock_free = {},
+             const std::vector<size_t> &synchro_spin_budgets = {},
+             const std::vector<size_t> &synchro_batch_sizes = {},
+             const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds = {},
+             const std::vector<bool> &synchro_work_stealing = {},
+             const std::vector<size_t> &synchro_reorder_windows = {}/*,
              const std::vector<bool> &tasks_inplace = {}*/);
     Pipeline(runtime::Task &first,
             runtime::Task &last,
@@ -165,7 +231,13 @@ class Pipeline : public tools::Interface_get_set_n_frames
             const std::vector<size_t> &synchro_buffer_sizes,
             const std::vector<bool> &synchro_active_waiting,
             const std::vector<bool> &thread_pinning,
-            const std::string &pipeline_pinning_policy/*,
+            const std::string &pipeline_pinning_policy,
+            const std::vector<bool> &synchro_lock_free = {},
+            const std::vector<size_t> &synchro_spin_budgets = {},
+            const std::vector<size_t> &synchro_batch_sizes = {},
+            const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds = {},
+            const std::vector<bool> &synchro_work_stealing = {},
+            const std::vector<size_t> &synchro_reorder_windows = {}/*,
             const std::vector<bool> &tasks_inplace = {}*/);
 
     virtual ~Pipeline();
@@ -206,7 +278,13 @@ class Pipeline : public tools::Interface_get_set_n_frames
 
   protected:
     void create_adaptors(const std::vector<size_t>& synchro_buffer_sizes = {},
-                         const std::vector<bool>& synchro_active_waiting = {});
+                         const std::vector<bool>& synchro_active_waiting = {},
+                         const std::vector<bool>& synchro_lock_free = {},
+                         const std::vector<size_t>& synchro_spin_budgets = {},
+                         const std::vector<size_t>& synchro_batch_sizes = {},
+                         const std::vector<std::pair<size_t, size_t>>& synchro_buffer_size_bounds = {},
+                         const std::vector<bool>& synchro_work_stealing = {},
+                         const std::vector<size_t>& synchro_reorder_windows = {});
 
     void _bind_adaptors(const bool bind_adaptors = true);
     void _unbind_adaptors(const bool bind_orphans = true);
@@ -221,7 +299,13 @@ class Pipeline : public tools::Interface_get_set_n_frames
               const std::vector<bool> &synchro_active_waiting = {},
               const std::vector<bool> &thread_pinning = {},
               const std::vector<std::vector<size_t>> &puids = {},
-              const std::string &pipeline_policy_pinning = ""/*,
+              const std::string &pipeline_policy_pinning = "",
+              const std::vector<bool> &synchro_lock_free = {},
+              const std::vector<size_t> &synchro_spin_budgets = {},
+              const std::vector<size_t> &synchro_batch_sizes = {},
+              const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds = {},
+              const std::vector<bool> &synchro_work_stealing = {},
+              const std::vector<size_t> &synchro_reorder_windows = {}/*,
               const std::vector<bool> &tasks_inplace = {}*/);
 };
 } // namespace runtime
@@ -6,6 +6,9 @@
 #define SEQUENCE_HPP_
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
 #include <functional>
 #include <iostream>
 #include <map>
@@ -14,6 +17,7 @@
 #include <string>
 #include <vector>
 
+#include "Runtime/Sequence/Sequence_handle.hpp"
 #include "Runtime/Socket/Socket.hpp"
 #include "Tools/Algo/Digraph/Digraph_node.hpp"
 #include "Tools/Interface/Interface_clone.hpp"
@@ -49,6 +53,8 @@ class Sub_sequence_generic
   public:
     subseq_t type;
     VTA tasks;
+    // one process per task, an empty process means that the task is directly executed (no extra work around the
+    // 'exec' call)
     std::vector<std::function<const int*()>> processes;
     std::vector<size_t> tasks_id;
     size_t id;
@@ -69,6 +75,72 @@ class Sub_sequence_generic
 using Sub_sequence = Sub_sequence_generic<std::vector<runtime::Task*>>;
 using Sub_sequence_const = Sub_sequence_generic<std::vector<const runtime::Task*>>;
 
+// operations of the flattened execution plan of a sub-sequences digraph (see 'Sequence::gen_plans()')
+enum class plan_op_t : uint8_t
+{
+    EXEC,    // execute a task and go to the next instruction
+    COMMUTE, // execute a commute task and jump to the entry of the selected path, the entries of the 'n_paths' paths
+             // are stored in the 'arg' of the 'n_paths' next instructions (return if the path does not exist)
+    CALL,    // push the next instruction on the return stack and jump to 'arg'
+    JUMP,    // jump to 'arg'
+    RET,     // jump to the instruction on the top of the return stack (the execution is over if the stack is empty)
+    PAR      // execute the 'n_paths' next EXEC instructions concurrently, in the order allowed by the dependencies of
+             // the block 'arg' (see 'dag_block_t'), and go to the instruction after them
+};
+
+struct plan_instr_t
+{
+    plan_op_t op;
+    size_t arg;     // EXEC and COMMUTE: id of the task (index in the statuses), CALL and JUMP: index of an
+                    // instruction, PAR: index of the block
+    size_t n_paths; // COMMUTE: number of paths, PAR: number of tasks in the block
+    runtime::Task* task;
+    const std::function<const int*()>* process; // nullptr when the task is directly executed
+};
+
+// dependencies between the tasks of a PAR instruction (the task 't' is the EXEC instruction 'first + t' of the plan),
+// they are derived from the socket bindings: a task runs after the tasks that write the data it reads and after the
+// tasks that read or write the data it writes, the tasks of a same module are executed in the sequential order
+struct dag_block_t
+{
+    size_t first;                             // index of the first EXEC instruction in the plan
+    std::vector<uint32_t> n_preds;            // number of direct predecessors of each task
+    std::vector<std::vector<uint32_t>> succs; // direct successors of each task
+    std::vector<uint32_t> roots;              // tasks without predecessor
+};
+
+// state of the PAR instruction being executed by a replicated sequence and by its workers: the 'n_tasks' tasks are
+// claimed in the order they became ready, a task becomes ready when its 'remaining' counter reaches 0
+struct dag_state_t
+{
+    const dag_block_t* block;
+    const plan_instr_t* instrs;
+    const void* exec_ctx;
+    const int* (*exec_fn)(const void* exec_ctx, const plan_instr_t& instr);
+    size_t n_tasks;
+    std::unique_ptr<std::atomic<uint32_t>[]> remaining;
+    std::unique_ptr<std::atomic<int32_t>[]> ready; // -1 until the slot is filled
+    std::atomic<size_t> n_ready;
+    std::atomic<size_t> n_claimed;
+    std::atomic<bool> aborted;
+    std::mutex mtx_exception;
+    std::exception_ptr exception;
+
+    explicit dag_state_t(const size_t capacity)
+      : block(nullptr)
+      , instrs(nullptr)
+      , exec_ctx(nullptr)
+      , exec_fn(nullptr)
+      , n_tasks(0)
+      , remaining(new std::atomic<uint32_t>[capacity])
+      , ready(new std::atomic<int32_t>[capacity])
+      , n_ready(0)
+      , n_claimed(0)
+      , aborted(false)
+    {
+    }
+};
+
 class Sequence
   : public tools::Interface_clone
   , public tools::Interface_get_set_n_frames
@@ -76,12 +148,19 @@ class Sequence
 {
     friend Pipeline;
     friend sched::Scheduler;
+    friend Sequence_handle;
 
   protected:
-    const size_t n_threads;
+    size_t n_threads;
     std::shared_ptr<tools::Thread_pool> thread_pool;
 
     std::vector<tools::Digraph_node<Sub_sequence>*> sequences;
+    // one flattened execution plan per thread, generated from 'sequences' (and from the processes of the
+    // sub-sequences) by 'gen_plans()': it has to be generated again each time the sub-sequences are modified
+    std::vector<std::vector<plan_instr_t>> plans;
+    // return stack of each plan, reserved by 'gen_plans()' to the number of CALL instructions and cleared at each
+    // execution of the plan
+    std::vector<std::vector<size_t>> ret_stacks;
     std::vector<size_t> firsts_tasks_id;
     std::vector<size_t> lasts_tasks_id;
     std::vector<std::vector<runtime::Task*>> firsts_tasks;
@@ -103,6 +182,34 @@ class Sequence
     bool auto_stop;
     bool is_part_of_pipeline;
 
+    // DAG-parallel execution of the independent tasks of the sub-sequences, disabled when 'n_dag_workers' = 0
+    // (default), otherwise each replicated sequence has its own pool of 'n_dag_workers' threads, the worker 'w' of the
+    // replicated sequence 'tid' is pinned on 'dag_puids[tid * n_dag_workers + w]' (unpinned when empty)
+    size_t n_dag_workers;
+    std::vector<size_t> dag_puids;
+    std::vector<std::shared_ptr<tools::Thread_pool>> dag_pools;
+    std::vector<std::vector<dag_block_t>> dag_blocks;
+    std::vector<std::shared_ptr<dag_state_t>> dag_states;
+
+    // fusion of the chains of element-wise tasks in single tiled loops (see 'gen_fused_processes()'), disabled by
+    // default
+    bool fusion;
+
+    // execution of the sub-sequences by tiles of frames that fit in the L2 cache (see 'gen_tiled_processes()'),
+    // disabled by default
+    bool frames_tiling;
+
+    // true when the processes have been generated in no-copy mode ('gen_processes(true)'), they are kept from an
+    // execution to the next one: the sockets stay rebound until 'leave_no_copy_processes()' or 'reset_no_copy_mode()'
+    // (when the sequence is modified or by the pipeline)
+    bool no_copy_processes;
+    // value of 'Socket::get_bindings_generation()' when the no-copy processes have been generated, they are generated
+    // again by 'exec()' when sockets have been bound or unbound since
+    uint64_t no_copy_bindings_generation;
+
+    // state of the last asynchronous execution (see 'exec_async()'), nullptr if there was none
+    std::shared_ptr<exec_async_state_t> async_state;
+
     // internal state for the `exec_step` method
     std::vector<bool> next_round_is_over;
     std::vector<size_t> cur_task_id;
@@ -233,6 +340,13 @@ class Sequence
     void exec(std::function<bool(const std::vector<const int*>&)> stop_condition);
     void exec(std::function<bool()> stop_condition);
     void exec();
+    // built-in stop conditions, cheaper than a stop condition function
+    void exec_n(const size_t n_frames); // 'n_frames' frames in total (all the threads included)
+    void exec_for(const std::chrono::nanoseconds duration);
+    void exec_until_done(); // until a module that implements 'tools::Interface_is_done' is done
+    Sequence_handle exec_async(std::function<bool(const std::vector<const int*>&)> stop_condition);
+    Sequence_handle exec_async(std::function<bool()> stop_condition);
+    Sequence_handle exec_async();
     void exec_seq(const size_t tid = 0, const int frame_id = -1);
     runtime::Task* exec_step(const size_t tid = 0, const int frame_id = -1);
 
@@ -260,9 +374,25 @@ class Sequence
     void set_auto_stop(const bool auto_stop);
     bool is_auto_stop() const;
 
+    void set_n_dag_workers(const size_t n_dag_workers, const std::vector<size_t>& dag_puids = {});
+    inline size_t get_n_dag_workers() const;
+    inline const std::vector<size_t>& get_dag_puids() const;
+
+    void set_fusion(const bool fusion);
+    bool is_fusion() const;
+
+    void set_frames_tiling(const bool frames_tiling);
+    bool is_frames_tiling() const;
+
     inline size_t get_n_frames() const;
     void set_n_frames(const size_t n_frames);
 
+    // incremental reconfiguration: the existing replicated sequences are kept, only the new ones are created
+    void set_n_threads(const size_t n_threads);
+    // replace a module (and its clones) by 'new_module' (and its clones) in place, the tasks and the sockets of the two
+    // modules have to match
+    void replace_module(const module::Module& old_module, module::Module& new_module);
+
     virtual bool is_done() const;
 
     bool is_control_flow() const;
@@ -301,18 +431,43 @@ class Sequence
     void export_dot(tools::Digraph_node<SS>* root, std::ostream& stream = std::cout) const;
 
     template<class SS, class MO>
-    void replicate(const tools::Digraph_node<SS>* sequence);
+    void replicate(const tools::Digraph_node<SS>* sequence, const size_t first_tid = 0);
+
+    void _exec(const size_t tid, std::function<bool(const std::vector<const int*>&)>& stop_condition);
+
+    template<class S>
+    void _exec_without_statuses(const size_t tid, S& stop_condition);
+
+    template<class F>
+    void exec_threads(F&& exec_thread);
+
+    // 'exec()' without the check of the asynchronous execution, called by the driver of 'exec_async()'
+    void exec_sync(std::function<bool(const std::vector<const int*>&)> stop_condition);
+    void exec_sync(std::function<bool()> stop_condition);
+
+    std::shared_ptr<exec_async_state_t> new_exec_async_state();
+    void start_exec_async(std::shared_ptr<exec_async_state_t> state, std::function<void()> exec_func);
+    void stop_exec_async();
+    void cancel_exec();
+
+    template<class E>
+    inline void exec_plan(const size_t tid, E&& exec_task);
 
-    void _exec(const size_t tid,
-               std::function<bool(const std::vector<const int*>&)>& stop_condition,
-               tools::Digraph_node<Sub_sequence>* sequence);
+    template<class E>
+    inline void exec_dag_block(const size_t tid, const plan_instr_t& instr, E& exec_task);
 
-    void _exec_without_statuses(const size_t tid,
-                                std::function<bool()>& stop_condition,
-                                tools::Digraph_node<Sub_sequence>* sequence);
+    void dag_work(const size_t tid);
 
     void gen_processes(const bool no_copy_mode = false);
-    void reset_no_copy_mode();
+    void gen_fused_processes(Sub_sequence* contents,
+                             std::map<runtime::Task*, std::function<const int*()>>& modified_tasks) const;
+    void gen_tiled_processes(Sub_sequence* contents,
+                             std::map<runtime::Task*, std::function<const int*()>>& modified_tasks) const;
+    void gen_plans();
+    bool gen_dag_block(const std::vector<runtime::Task*>& tasks, dag_block_t& block) const;
+    void reset_no_copy_mode(const size_t first_tid = 0);
+    void leave_no_copy_processes();
+    void check_no_exec_async(const std::string& action) const;
 
     template<class SS>
     void check_ctrl_flow(tools::Digraph_node<SS>* root);
@@ -326,6 +481,7 @@ class Sequence
     void _set_n_frames_unbind(std::vector<std::pair<runtime::Socket*, runtime::Socket*>>& unbind_sockets,
                               std::vector<std::pair<runtime::Task*, runtime::Socket*>>& unbind_tasks);
     void _set_n_frames(const size_t n_frames);
+    bool _set_n_frames_in_place(const size_t n_frames);
     void _set_n_frames_rebind(const std::vector<std::pair<runtime::Socket*, runtime::Socket*>>& unbind_sockets,
                               const std::vector<std::pair<runtime::Task*, runtime::Socket*>>& unbind_tasks);
 
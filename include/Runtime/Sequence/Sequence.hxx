@@ -1,4 +1,5 @@
 #include <set>
+#include <type_traits>
 
 #include "Module/Stateful/Set/Set.hpp"
 #include "Runtime/Sequence/Sequence.hpp"
@@ -13,6 +14,18 @@ Sequence::get_n_threads() const
     return this->n_threads;
 }
 
+size_t
+Sequence::get_n_dag_workers() const
+{
+    return this->n_dag_workers;
+}
+
+const std::vector<size_t>&
+Sequence::get_dag_puids() const
+{
+    return this->dag_puids;
+}
+
 const std::vector<std::vector<runtime::Task*>>&
 Sequence::get_firsts_tasks() const
 {
@@ -309,5 +322,97 @@ Sequence::get_n_frames() const
     return n_frames;
 }
 
+template<class E>
+void
+Sequence::exec_plan(const size_t tid, E&& exec_task)
+{
+    const std::vector<plan_instr_t>& plan = this->plans[tid];
+    // the return stack is only used when a sub-sequence has more than one child (the last child is reached with a
+    // jump), it does not grow with the iterations of the loops
+    std::vector<size_t>& ret_stack = this->ret_stacks[tid];
+    ret_stack.clear();
+    size_t pc = 0;
+    while (pc < plan.size())
+    {
+        const plan_instr_t& instr = plan[pc];
+        switch (instr.op)
+        {
+            case plan_op_t::EXEC:
+                exec_task(instr);
+                pc++;
+                break;
+            case plan_op_t::COMMUTE:
+            {
+                const size_t path = (size_t)exec_task(instr)[0];
+                if (path < instr.n_paths)
+                    pc = plan[pc + 1 + path].arg;
+                else if (ret_stack.empty())
+                    return;
+                else
+                {
+                    pc = ret_stack.back();
+                    ret_stack.pop_back();
+                }
+                break;
+            }
+            case plan_op_t::CALL:
+                ret_stack.push_back(pc + 1);
+                pc = instr.arg;
+                break;
+            case plan_op_t::JUMP:
+                pc = instr.arg;
+                break;
+            case plan_op_t::RET:
+                if (ret_stack.empty()) return;
+                pc = ret_stack.back();
+                ret_stack.pop_back();
+                break;
+            case plan_op_t::PAR:
+                this->exec_dag_block(tid, instr, exec_task);
+                pc += 1 + instr.n_paths;
+                break;
+        }
+    }
+}
+
+template<class E>
+inline const int*
+dag_exec_task(const void* exec_ctx, const plan_instr_t& instr)
+{
+    return (*static_cast<const E*>(exec_ctx))(instr);
+}
+
+template<class E>
+void
+Sequence::exec_dag_block(const size_t tid, const plan_instr_t& instr, E& exec_task)
+{
+    auto& state = *this->dag_states[tid];
+    const auto& block = this->dag_blocks[tid][instr.arg];
+
+    state.block = &block;
+    state.instrs = &instr + 1;
+    state.exec_ctx = &exec_task;
+    state.exec_fn = &dag_exec_task<typename std::decay<E>::type>;
+    state.n_tasks = instr.n_paths;
+    for (size_t t = 0; t < state.n_tasks; t++)
+    {
+        state.remaining[t].store(block.n_preds[t], std::memory_order_relaxed);
+        state.ready[t].store(-1, std::memory_order_relaxed);
+    }
+    for (size_t r = 0; r < block.roots.size(); r++)
+        state.ready[r].store((int32_t)block.roots[r], std::memory_order_relaxed);
+    state.n_ready.store(block.roots.size(), std::memory_order_relaxed);
+    state.n_claimed.store(0, std::memory_order_relaxed);
+    state.aborted.store(false, std::memory_order_relaxed);
+    state.exception = nullptr;
+
+    // the waking of the workers publishes the state, the current thread works with them until the block is over
+    this->dag_pools[tid]->run(true);
+    this->dag_work(tid);
+    this->dag_pools[tid]->wait();
+
+    if (state.exception) std::rethrow_exception(state.exception);
+}
+
 }
 }
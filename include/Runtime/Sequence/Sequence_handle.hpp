@@ -0,0 +1,72 @@
+/*!
+ * \file
+ * \brief Class runtime::Sequence_handle.
+ */
+#ifndef SEQUENCE_HANDLE_HPP_
+#define SEQUENCE_HANDLE_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace spu
+{
+namespace runtime
+{
+class Sequence;
+
+// shared state of an asynchronous execution of a sequence, between the sequence, the thread that drives the
+// execution and the handles
+struct exec_async_state_t
+{
+    Sequence* sequence; // nullptr once the sequence is destroyed
+    std::mutex mtx;     // protects 'sequence', 'running' and 'canceled' against the concurrent calls to 'cancel()'
+    std::thread driver; // runs 'Sequence::exec()', joined by the sequence
+    std::shared_future<void> done;
+    std::atomic<size_t> n_execs; // number of executions of the replicated sequences completed so far
+    bool running;
+    bool canceled;
+
+    exec_async_state_t(Sequence* sequence)
+      : sequence(sequence)
+      , n_execs(0)
+      , running(true)
+      , canceled(false)
+    {
+    }
+};
+
+// handle on an asynchronous execution of a sequence (see 'Sequence::exec_async()'), the copies of a handle share the
+// same execution
+class Sequence_handle
+{
+    friend Sequence;
+
+  protected:
+    std::shared_ptr<exec_async_state_t> state;
+
+    Sequence_handle(std::shared_ptr<exec_async_state_t> state);
+
+  public:
+    virtual ~Sequence_handle() = default;
+
+    // block until the end of the execution, rethrow the exception raised by the execution (if any)
+    void wait() const;
+    // block until the end of the execution or until 'timeout' is elapsed, return true if the execution is over
+    bool wait_for(const std::chrono::nanoseconds timeout) const;
+    // stop the execution at the end of the current executions of the replicated sequences, the tasks blocked in a
+    // module that implements 'tools::Interface_waiting' are woken up
+    void cancel();
+
+    bool is_done() const;
+    bool is_canceled() const;
+    size_t get_n_execs() const;
+};
+}
+}
+
+#endif /* SEQUENCE_HANDLE_HPP_ */
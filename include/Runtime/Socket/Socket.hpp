@@ -5,7 +5,9 @@
 #ifndef SOCKET_HPP_
 #define SOCKET_HPP_
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <typeindex>
@@ -34,6 +36,8 @@ class Socket : public tools::Interface_reset
     friend module::Set;
     friend Sequence;
     friend Pipeline;
+    template<class F, typename... T>
+    friend class Codelet_typed;
 #endif
   protected:
     Task& task;
@@ -84,6 +88,10 @@ class Socket : public tools::Interface_reset
     inline const Socket& get_bound_socket() const;
     inline Socket& get_bound_socket();
     inline socket_t get_type() const;
+    inline const frame_meta_t* get_frame_meta() const;
+
+    // incremented each time a socket is bound to or unbound from another socket (all the sockets of the process)
+    static inline uint64_t get_bindings_generation();
 
     template<typename T>
     inline T* get_dataptr(const size_t start_col = 0) const;
@@ -185,6 +193,8 @@ class Socket : public tools::Interface_reset
 
   private:
     inline void check_bound_socket();
+
+    static inline std::atomic<uint64_t>& bindings_generation();
 };
 }
 }
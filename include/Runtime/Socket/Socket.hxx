@@ -340,6 +340,27 @@ Socket::get_type() const
     return this->type;
 }
 
+const frame_meta_t*
+Socket::get_frame_meta() const
+{
+    // the metadata belong to the task that produces the frames
+    if (this->type == socket_t::SIN) return this->bound_socket ? this->bound_socket->task.get_frame_meta() : nullptr;
+    return this->task.get_frame_meta();
+}
+
+uint64_t
+Socket::get_bindings_generation()
+{
+    return Socket::bindings_generation().load(std::memory_order_relaxed);
+}
+
+std::atomic<uint64_t>&
+Socket::bindings_generation()
+{
+    static std::atomic<uint64_t> generation(0);
+    return generation;
+}
+
 void
 Socket::set_fast(const bool fast)
 {
@@ -430,6 +451,7 @@ Socket::_bind(Socket& s_out, const int priority)
     else
         s_out.bound_sockets.insert(s_out.bound_sockets.begin() + priority, this);
     this->dataptr = s_out.dataptr;
+    Socket::bindings_generation().fetch_add(1, std::memory_order_relaxed);
 }
 
 void
@@ -991,6 +1013,7 @@ Socket::unbind(Socket& s_out)
     }
 #endif
 
+    Socket::bindings_generation().fetch_add(1, std::memory_order_relaxed);
     return unbind_pos;
 }
 
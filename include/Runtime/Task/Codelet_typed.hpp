@@ -0,0 +1,71 @@
+/*!
+ * \file
+ * \brief Class runtime::Codelet_typed.
+ */
+#ifndef CODELET_TYPED_HPP_
+#define CODELET_TYPED_HPP_
+
+#include <array>
+#include <cstddef>
+
+namespace spu
+{
+namespace module
+{
+class Module;
+}
+namespace runtime
+{
+class Task;
+class Socket;
+
+template<size_t... I>
+struct index_seq
+{
+};
+
+template<size_t N, size_t... I>
+struct make_index_seq : make_index_seq<N - 1, N - 1, I...>
+{
+};
+
+template<size_t... I>
+struct make_index_seq<0, I...>
+{
+    typedef index_seq<I...> type;
+};
+
+// codelet that calls 'F' with the typed data pointers of its sockets: 'F' is called as
+// 'codelet(m, t, data_0, data_1, ..., frame_id)' where 'data_i' is a 'T_i*' pointer on the socket 'sids[i]' of 't'.
+// The types of the sockets are checked once (see 'Module::create_codelet') and the sockets are resolved at the first
+// call on a task (the clones of a task get their own copy of the codelet). As 'F' is a template parameter, its body
+// can be inlined in the dispatch.
+template<class F, typename... T>
+class Codelet_typed
+{
+  protected:
+    F codelet;
+    std::array<size_t, sizeof...(T)> sids;
+    const Task* task;
+    std::array<Socket*, sizeof...(T)> sockets;
+
+  public:
+    Codelet_typed(const F& codelet, const std::array<size_t, sizeof...(T)>& sids);
+    Codelet_typed(const Codelet_typed& other);
+
+    inline int operator()(module::Module& m, Task& t, const size_t frame_id);
+
+  protected:
+    void resolve(Task& t);
+
+    template<size_t... I>
+    inline int call(module::Module& m, Task& t, const size_t frame_id, index_seq<I...>);
+};
+}
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#include "Runtime/Task/Codelet_typed.hxx"
+#endif
+
+#endif /* CODELET_TYPED_HPP_ */
@@ -0,0 +1,52 @@
+#include "Runtime/Socket/Socket.hpp"
+#include "Runtime/Task/Codelet_typed.hpp"
+#include "Runtime/Task/Task.hpp"
+
+namespace spu
+{
+namespace runtime
+{
+template<class F, typename... T>
+Codelet_typed<F, T...>::Codelet_typed(const F& codelet, const std::array<size_t, sizeof...(T)>& sids)
+  : codelet(codelet)
+  , sids(sids)
+  , task(nullptr)
+  , sockets()
+{
+}
+
+template<class F, typename... T>
+Codelet_typed<F, T...>::Codelet_typed(const Codelet_typed& other)
+  : codelet(other.codelet)
+  , sids(other.sids)
+  , task(nullptr) // the copy belongs to another task (a clone), its sockets are resolved again
+  , sockets()
+{
+}
+
+template<class F, typename... T>
+void
+Codelet_typed<F, T...>::resolve(Task& t)
+{
+    for (size_t i = 0; i < sizeof...(T); i++)
+        this->sockets[i] = t.sockets[this->sids[i]].get();
+    this->task = &t;
+}
+
+template<class F, typename... T>
+template<size_t... I>
+int
+Codelet_typed<F, T...>::call(module::Module& m, Task& t, const size_t frame_id, index_seq<I...>)
+{
+    return this->codelet(m, t, static_cast<T*>(this->sockets[I]->dataptr)..., frame_id);
+}
+
+template<class F, typename... T>
+int
+Codelet_typed<F, T...>::operator()(module::Module& m, Task& t, const size_t frame_id)
+{
+    if (&t != this->task) this->resolve(t);
+    return this->call(m, t, frame_id, typename make_index_seq<sizeof...(T)>::type());
+}
+}
+}
@@ -15,6 +15,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "Tools/Algo/Histogram/Histogram.hpp"
 #include "Tools/Interface/Interface_clone.hpp"
 #include "Tools/Interface/Interface_reset.hpp"
 #include "Tools/System/memory.hpp"
@@ -29,6 +30,7 @@ namespace runtime
 {
 class Socket;
 class Pipeline;
+class Sequence;
 
 enum status_t : int
 {
@@ -59,6 +61,14 @@ enum class datatype_t : uint8_t
     U8
 };
 
+// metadata of a frame: written by the task that ingests the frame (a task without input metadata) and forwarded by the
+// next tasks, through the sockets and the adaptors
+struct frame_meta_t
+{
+    uint64_t seq; // sequence number of the frame (in the ingest order)
+    int64_t ts;   // ingest timestamp (nanoseconds since the epoch of 'std::chrono::steady_clock')
+};
+
 static std::unordered_map<int, std::string> status_t_to_string = { { 0, "SUCCESS" },
                                                                    { 1, "FAILURE" },
                                                                    { -1, "FAILURE_STOP" },
@@ -72,6 +82,7 @@ class Task
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
     friend Socket;
     friend Pipeline;
+    friend Sequence;
     friend module::Module;
 #endif
 
@@ -84,6 +95,7 @@ class Task
     bool debug;
     bool debug_hex;
     bool replicable;
+    bool partial_waves;
     int32_t debug_limit;
     uint8_t debug_precision;
     int32_t debug_frame_max;
@@ -98,9 +110,16 @@ class Task
 
     // stats
     uint32_t n_calls;
+    uint32_t n_calls_stats;   // number of calls with the stats enabled (timed or not)
+    uint32_t n_calls_timed;   // lower than 'n_calls_stats' when the stats are sampled
+    uint32_t stats_period;    // one call in 'stats_period' is timed (on average when 'stats_random')
+    bool stats_random;        // the gap between two timed calls is drawn in [1, 2 * 'stats_period' - 1]
+    uint32_t stats_countdown; // number of calls before the next timed call
+    uint32_t stats_rng;       // state of the xorshift generator of the random gate
     std::chrono::nanoseconds duration_total;
     std::chrono::nanoseconds duration_min;
     std::chrono::nanoseconds duration_max;
+    tools::Histogram duration_hist; // distribution of the durations (in ns), allocated when the stats are enabled
 
     std::vector<std::string> timers_name;
     std::vector<uint32_t> timers_n_calls;
@@ -110,6 +129,12 @@ class Task
 
     Socket* last_input_socket;
 
+    // metadata of the frames produced by the task (one per frame, empty when the frame metadata are disabled)
+    std::vector<frame_meta_t> frames_meta;
+    uint64_t frames_meta_seq; // next sequence number when the task ingests the frames
+
+    size_t n_frames_cur_wave; // number of frames to process by the current call of the codelet
+
     // precomputed values to speedup the task execution
     std::vector<int8_t*> sockets_dataptr_init;
     std::vector<size_t> sockets_databytes_per_frame;
@@ -132,6 +157,9 @@ class Task
 
     void set_autoalloc(const bool autoalloc);
     void set_stats(const bool stats);
+    // times one call in 'period' (periodically, or on average with a pseudo-random gate when 'random' is true), the
+    // durations are scaled accordingly in 'get_duration_total()' and 'get_duration_avg()'
+    void set_stats_sampling(const uint32_t period, const bool random = false);
     void set_fast(const bool fast);
     void set_debug(const bool debug);
     void set_debug_hex(const bool debug_hex);
@@ -139,12 +167,18 @@ class Task
     void set_debug_precision(const uint8_t prec);
     void set_debug_frame_max(const uint32_t limit);
     void set_replicability(const bool replicable);
+    void set_frame_meta(const bool frame_meta);
+    // the codelet processes 'get_n_frames_cur_wave()' frames in place instead of always 'n_frames_per_wave' frames:
+    // the incomplete waves and the single frames are no longer copied into intermediate buffers
+    void set_partial_waves(const bool partial_waves);
 
     inline bool is_autoalloc() const;
     inline bool is_stats() const;
     inline bool is_fast() const;
     inline bool is_debug() const;
     inline bool is_debug_hex() const;
+    inline bool is_frame_meta() const;
+    inline bool is_partial_waves() const;
     inline bool is_last_input_socket(const Socket& s_in) const;
     bool is_stateless() const;
     bool is_stateful() const;
@@ -154,12 +188,18 @@ class Task
     inline module::Module& get_module() const;
     inline std::string get_name() const;
     inline uint32_t get_n_calls() const;
+    inline uint32_t get_n_calls_timed() const;
+    inline uint32_t get_stats_period() const;
+    inline const frame_meta_t* get_frame_meta() const;
+    inline size_t get_n_frames_cur_wave() const;
 
     // get stats
     std::chrono::nanoseconds get_duration_total() const;
     std::chrono::nanoseconds get_duration_avg() const;
     std::chrono::nanoseconds get_duration_min() const;
     std::chrono::nanoseconds get_duration_max() const;
+    std::chrono::nanoseconds get_duration_percentile(const float percentile) const;
+    const tools::Histogram& get_duration_histogram() const;
     const std::vector<std::string>& get_timers_name() const;
     const std::vector<uint32_t>& get_timers_n_calls() const;
     const std::vector<std::chrono::nanoseconds>& get_timers_total() const;
@@ -172,6 +212,10 @@ class Task
     size_t get_n_static_input_sockets() const;
 
     const std::vector<int>& exec(const int frame_id = -1, const bool managed_memory = true);
+    // executes the waves ['w_start', 'w_stop'[ of the frames, an execution of all the waves can be split in several
+    // calls on consecutive ranges (the debug and stats modes are ignored), the call is counted by the range that
+    // starts at the first wave
+    const std::vector<int>& exec_waves(const size_t w_start, const size_t w_stop);
 
     inline Socket& operator[](const size_t id);
     Socket& operator[](const std::string& sck_name);
@@ -182,6 +226,8 @@ class Task
 
     inline const std::vector<int>& get_status() const;
 
+    void copy_frame_meta(const frame_meta_t* meta);
+
     void bind(Socket& s_out, const int priority = -1); // deprecated
     void operator=(Socket& s_out);
     size_t unbind(Socket& s_out);
@@ -195,6 +241,12 @@ class Task
     void _bind(Task& t_out, const int priority = -1);
 
     void _exec(const int frame_id = -1, const bool managed_memory = true);
+    void _exec_waves(const size_t w_start, const size_t w_stop);
+
+    void update_frame_meta(const int frame_id);
+
+    inline bool sample_call();
+    void record_duration(const std::chrono::nanoseconds& duration);
 
     void register_timer(const std::string& key);
 
@@ -42,6 +42,18 @@ Task::is_debug_hex() const
     return this->debug_hex;
 }
 
+bool
+Task::is_frame_meta() const
+{
+    return !this->frames_meta.empty();
+}
+
+bool
+Task::is_partial_waves() const
+{
+    return this->partial_waves;
+}
+
 bool
 Task::is_last_input_socket(const Socket& s_in) const
 {
@@ -66,6 +78,49 @@ Task::get_n_calls() const
     return this->n_calls;
 }
 
+uint32_t
+Task::get_n_calls_timed() const
+{
+    return this->n_calls_timed;
+}
+
+uint32_t
+Task::get_stats_period() const
+{
+    return this->stats_period;
+}
+
+bool
+Task::sample_call()
+{
+    this->n_calls_stats++;
+    if (--this->stats_countdown) return false;
+
+    if (this->stats_random)
+    {
+        // xorshift32, the mean gap is 'stats_period'
+        this->stats_rng ^= this->stats_rng << 13;
+        this->stats_rng ^= this->stats_rng >> 17;
+        this->stats_rng ^= this->stats_rng << 5;
+        this->stats_countdown = 1 + this->stats_rng % (2 * this->stats_period - 1);
+    }
+    else
+        this->stats_countdown = this->stats_period;
+    return true;
+}
+
+const frame_meta_t*
+Task::get_frame_meta() const
+{
+    return this->frames_meta.empty() ? nullptr : this->frames_meta.data();
+}
+
+size_t
+Task::get_n_frames_cur_wave() const
+{
+    return this->n_frames_cur_wave;
+}
+
 Socket&
 Task::operator[](const size_t id)
 {
@@ -17,6 +17,7 @@ class Scheduler_from_file : public Scheduler
   protected:
     std::vector<std::pair<size_t, size_t>> solution_from_file;
     std::vector<size_t> sync_buff_sizes_from_file;
+    std::vector<size_t> sync_buff_sizes_max_from_file;
     std::vector<bool> sync_active_waitings_from_file;
     std::vector<std::vector<size_t>> puids_from_file;
 
@@ -28,6 +29,7 @@ class Scheduler_from_file : public Scheduler
 
     std::vector<bool> get_thread_pinnings() const override;
     std::vector<size_t> get_sync_buff_sizes() const override;
+    std::vector<std::pair<size_t, size_t>> get_sync_buff_size_bounds() const override;
     std::vector<bool> get_sync_active_waitings() const override;
     std::string get_threads_mapping() const override;
 };
@@ -9,6 +9,7 @@
 #include "Runtime/Sequence/Sequence.hpp"
 #include "Tools/Interface/Interface_reset.hpp"
 #include <chrono>
+#include <cstdint>
 #include <iostream>
 #include <string>
 #include <utility>
@@ -33,6 +34,9 @@ class Scheduler : public tools::Interface_reset
     std::vector<size_t> profiled_puids;
     std::vector<std::string> profiling_summary;
     std::vector<std::pair<size_t, size_t>> solution;
+    uint32_t profiling_period; // one call in 'profiling_period' of each task is timed during the profiling
+    bool profiling_random;
+    size_t sync_buff_size_max_factor; // the adaptors can grow up to 'sync_buff_size_max_factor' times their size
 
     Scheduler(runtime::Sequence& sequence);
     Scheduler(runtime::Sequence* sequence);
@@ -43,22 +47,29 @@ class Scheduler : public tools::Interface_reset
     void profile(const size_t n_exec = 100);
     void profile(const std::vector<size_t>& puids, const size_t n_exec = 100);
     void print_profiling(std::ostream& stream = std::cout);
+    // samples the calls of the tasks during the profiling (see 'runtime::Task::set_stats_sampling')
+    void set_profiling_sampling(const uint32_t period, const bool random = false);
+    // lets the adaptors of the generated pipeline grow at runtime up to 'factor' times their buffer size (1 = fixed)
+    void set_sync_buff_size_max_factor(const size_t factor);
     const std::vector<task_desc_t>& get_profiling();
     virtual ~Scheduler() = default;
     runtime::Pipeline* generate_pipeline();
     std::vector<std::pair<size_t, size_t>> get_solution();
     virtual void reset() override;
     virtual void schedule() = 0;
-    runtime::Pipeline* instantiate_pipeline(const std::vector<size_t> synchro_buffer_sizes,
-                                            const std::vector<bool> synchro_active_waitings,
-                                            const std::vector<bool> thread_pinings,
-                                            const std::string& pinning_policy);
+    runtime::Pipeline* instantiate_pipeline(
+      const std::vector<size_t> synchro_buffer_sizes,
+      const std::vector<bool> synchro_active_waitings,
+      const std::vector<bool> thread_pinings,
+      const std::string& pinning_policy,
+      const std::vector<std::pair<size_t, size_t>> synchro_buffer_size_bounds = {});
     runtime::Pipeline* instantiate_pipeline(const size_t buffer_size = 1,
                                             const bool active_wait = false,
                                             const bool thread_pining = false,
                                             const std::string& pinning_policy = "");
     virtual std::vector<bool> get_thread_pinnings() const;
     virtual std::vector<size_t> get_sync_buff_sizes() const;
+    virtual std::vector<std::pair<size_t, size_t>> get_sync_buff_size_bounds() const;
     virtual std::vector<bool> get_sync_active_waitings() const;
     virtual std::string get_threads_mapping() const;
     size_t get_n_alloc_ressources() const;
@@ -0,0 +1,60 @@
+/*!
+ * \file
+ * \brief Class tools::Histogram.
+ */
+#ifndef HISTOGRAM_HPP_
+#define HISTOGRAM_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace spu
+{
+namespace tools
+{
+
+// fixed-memory histogram with log-linear buckets (HDR-like): the values lower than '2^n_sub_bits' have their own
+// bucket, then each power of two is split in '2^n_sub_bits' buckets of the same width. The relative error of a
+// recorded value is lower than '2^-n_sub_bits' (~3%). The values greater than '2^max_bits' go in the last bucket.
+// The counters are only allocated by 'allocate' (or by 'merge'), 'record' is not thread-safe: each thread has to
+// record in its own histogram, the histograms are merged when the statistics are read.
+class Histogram
+{
+  public:
+    static constexpr size_t n_sub_bits = 5;
+    static constexpr size_t max_bits = 36;
+    static constexpr size_t n_sub_buckets = (size_t)1 << n_sub_bits;
+    static constexpr size_t n_buckets = (max_bits - n_sub_bits + 1) * n_sub_buckets;
+
+  private:
+    std::vector<uint64_t> counts; // 64-bit: a long run or the merge of many replicated tasks can exceed 2^32 values
+    uint64_t n_values;
+
+  public:
+    Histogram();
+    virtual ~Histogram() = default;
+
+    void allocate();
+    inline bool is_allocated() const;
+    void clear();
+
+    inline void record(const uint64_t value);
+    void merge(const Histogram& other);
+
+    inline uint64_t get_n_values() const;
+    uint64_t get_percentile(const float percentile) const;
+
+    inline static size_t get_bucket(const uint64_t value);
+    static uint64_t get_bucket_min(const size_t bucket);
+    static uint64_t get_bucket_max(const size_t bucket);
+};
+
+}
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#include "Tools/Algo/Histogram/Histogram.hxx"
+#endif
+
+#endif /* HISTOGRAM_HPP_ */
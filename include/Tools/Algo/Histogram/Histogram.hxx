@@ -0,0 +1,46 @@
+#include "Tools/Algo/Histogram/Histogram.hpp"
+
+namespace spu
+{
+namespace tools
+{
+
+bool
+Histogram::is_allocated() const
+{
+    return !this->counts.empty();
+}
+
+size_t
+Histogram::get_bucket(const uint64_t value)
+{
+    if (value < (uint64_t)Histogram::n_sub_buckets) return (size_t)value;
+    if (value >= ((uint64_t)1 << Histogram::max_bits)) return Histogram::n_buckets - 1;
+
+    // position of the most significant bit
+#if defined(__GNUC__) || defined(__clang__)
+    const size_t msb = 63 - (size_t)__builtin_clzll(value);
+#else
+    size_t msb = Histogram::n_sub_bits;
+    while (value >> (msb + 1))
+        msb++;
+#endif
+    const size_t shift = msb - Histogram::n_sub_bits;
+    return ((shift + 1) << Histogram::n_sub_bits) + (size_t)((value >> shift) & (Histogram::n_sub_buckets - 1));
+}
+
+void
+Histogram::record(const uint64_t value)
+{
+    this->counts[Histogram::get_bucket(value)]++;
+    this->n_values++;
+}
+
+uint64_t
+Histogram::get_n_values() const
+{
+    return this->n_values;
+}
+
+}
+}
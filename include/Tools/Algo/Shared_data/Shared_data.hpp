@@ -0,0 +1,55 @@
+/*!
+ * \file
+ * \brief Class tools::Shared_data.
+ */
+#ifndef SHARED_DATA_HPP_
+#define SHARED_DATA_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace spu
+{
+namespace tools
+{
+
+// copy-on-write value shared between a module and its clones: the copies of a 'Shared_data' share the same value
+// until they call 'get_mut', then the caller gets its own copy if the value is still shared. The copies can be made
+// concurrently by the clones (on the threads that execute them): the sharers are counted explicitly, a sharer
+// releases the value once its copy is done and the last sharer acquires these releases before to write in place.
+// The copies of a 'Shared_data' (and the assignments) can't be made concurrently with 'get_mut'.
+template<typename T>
+class Shared_data
+{
+  private:
+    struct block_t
+    {
+        T value;
+        std::atomic<size_t> n_sharers;
+        block_t(const T& value);
+    };
+    std::shared_ptr<block_t> block;
+
+  public:
+    explicit Shared_data(const T& value);
+    Shared_data(const Shared_data& other);
+    Shared_data& operator=(const Shared_data& other);
+    virtual ~Shared_data();
+
+    inline const T& get() const;
+    inline T& get_mut();
+    inline bool is_shared() const;
+
+  private:
+    void release();
+};
+
+}
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#include "Tools/Algo/Shared_data/Shared_data.hxx"
+#endif
+
+#endif /* SHARED_DATA_HPP_ */
@@ -0,0 +1,84 @@
+#include "Tools/Algo/Shared_data/Shared_data.hpp"
+
+namespace spu
+{
+namespace tools
+{
+
+template<typename T>
+Shared_data<T>::block_t::block_t(const T& value)
+  : value(value)
+  , n_sharers(1)
+{
+}
+
+template<typename T>
+Shared_data<T>::Shared_data(const T& value)
+  : block(new block_t(value))
+{
+}
+
+template<typename T>
+Shared_data<T>::Shared_data(const Shared_data& other)
+  : block(other.block)
+{
+    this->block->n_sharers.fetch_add(1, std::memory_order_relaxed);
+}
+
+template<typename T>
+Shared_data<T>&
+Shared_data<T>::operator=(const Shared_data& other)
+{
+    if (this->block != other.block)
+    {
+        this->release();
+        this->block = other.block;
+        this->block->n_sharers.fetch_add(1, std::memory_order_relaxed);
+    }
+    return *this;
+}
+
+template<typename T>
+Shared_data<T>::~Shared_data()
+{
+    this->release();
+}
+
+template<typename T>
+void
+Shared_data<T>::release()
+{
+    // the reads of the value by this sharer happen before the writes of the last sharer
+    this->block->n_sharers.fetch_sub(1, std::memory_order_release);
+}
+
+template<typename T>
+const T&
+Shared_data<T>::get() const
+{
+    return this->block->value;
+}
+
+template<typename T>
+T&
+Shared_data<T>::get_mut()
+{
+    if (this->is_shared())
+    {
+        std::shared_ptr<block_t> copy(new block_t(this->block->value));
+        this->release();
+        this->block = copy;
+    }
+    return this->block->value;
+}
+
+template<typename T>
+bool
+Shared_data<T>::is_shared() const
+{
+    // synchronizes with the releases of the sharers that made their own copy
+    return this->block->n_sharers.load(std::memory_order_acquire) > 1;
+}
+
+}
+}
@@ -340,9 +340,129 @@ class Pipeline_builder
          */
         const size_t get_buffer_size();
 
+        /**
+         * Enable the lock-free ring between the two stages (sequence numbers instead of a shared counter).
+         * @return A reference to the modified Synchro_builder object.
+         */
+        Synchro_builder& enable_lock_free();
+
+        /**
+         * Disable the lock-free ring between the two stages.
+         * @return A reference to the modified Synchro_builder object.
+         */
+        Synchro_builder& disable_lock_free();
+
+        /**
+         * Enable or disable the lock-free ring depending on the boolean parameter.
+         * @param lock_free Enable or disable the lock-free ring.
+         * @return A reference to the modified Synchro_builder object.
+         */
+        Synchro_builder& set_lock_free(bool lock_free);
+
+        /**
+         * Check if the lock-free ring is enabled.
+         * @return True if the lock-free ring is enabled, false otherwise.
+         */
+        const bool is_lock_free();
+
+        /**
+         * Set the number of spinning iterations of the passive waiting before yielding and parking the thread. When
+         * greater than 0, the passive waiting becomes a hybrid spin, yield and park waiting.
+         * @param spin_budget The number of spinning iterations (0 for the plain passive waiting).
+         * @return A reference to the modified Synchro_builder object.
+         */
+        Synchro_builder& set_spin_budget(size_t spin_budget);
+
+        /**
+         * Get the number of spinning iterations of the passive waiting before yielding and parking the thread.
+         * @return The number of spinning iterations.
+         */
+        const size_t get_spin_budget();
+
+        /**
+         * Set the number of slots claimed (and then published) at once by the synchronization between the two stages.
+         * The frames are also distributed to the threads by batches, so the input and the output synchros of a
+         * multi-threaded stage have to use the same batch size.
+         * @param batch_size The number of slots per batch (has to be smaller or equal to the buffer size).
+         * @return A reference to the modified Synchro_builder object.
+         */
+        Synchro_builder& set_batch_size(size_t batch_size);
+
+        /**
+         * Get the number of slots claimed at once by the synchronization between the two stages.
+         * @return The number of slots per batch.
+         */
+        size_t get_batch_size() const;
+
+        /**
+         * Set the bounds of the adaptive buffer size between the two stages. The buffers are allocated for
+         * 'buffer_size_max' slots and the number of slots actually used evolves at runtime between the two bounds
+         * (starting from the buffer size) depending on the stalls, on the occupancy and on the rate variance of the
+         * two stages.
+         * @param buffer_size_min The minimum buffer size (0 for the buffer size).
+         * @param buffer_size_max The maximum buffer size (0 for the buffer size).
+         * @return A reference to the modified Synchro_builder object.
+         */
+        Synchro_builder& set_buffer_size_bounds(size_t buffer_size_min, size_t buffer_size_max);
+
+        /**
+         * Get the bounds of the adaptive buffer size between the two stages.
+         * @return The minimum and the maximum buffer sizes (0 when the buffer size is fixed).
+         */
+        const std::pair<size_t, size_t> get_buffer_size_bounds();
+
+        /**
+         * Enable the work stealing between the two stages: the threads of the next stage pull the frames from any
+         * thread of the previous stage instead of following the round-robin. The frames order is not preserved, the
+         * next stage has to be stateless (or a reorder has to be done downstream). The lock-free ring is implied.
+         * @return A reference to the modified Synchro_builder object.
+         */
+        Synchro_builder& enable_work_stealing();
+
+        /**
+         * Disable the work stealing between the two stages.
+         * @return A reference to the modified Synchro_builder object.
+         */
+        Synchro_builder& disable_work_stealing();
+
+        /**
+         * Enable or disable the work stealing depending on the boolean parameter.
+         * @param work_stealing Enable or disable the work stealing.
+         * @return A reference to the modified Synchro_builder object.
+         */
+        Synchro_builder& set_work_stealing(bool work_stealing);
+
+        /**
+         * Check if the work stealing is enabled.
+         * @return True if the work stealing is enabled, false otherwise.
+         */
+        bool is_work_stealing() const;
+
+        /**
+         * Set the size of the reorder window of the synchronization between the two stages. When greater than 0, the
+         * frames are emitted to the next stage in the order of their sequence numbers (for instance after a
+         * work-stealing stage), the next stage has to be single-threaded.
+         * @param reorder_window The number of frames in the reorder window (0 to disable the reordering).
+         * @return A reference to the modified Synchro_builder object.
+         */
+        Synchro_builder& set_reorder_window(size_t reorder_window);
+
+        /**
+         * Get the size of the reorder window of the synchronization between the two stages.
+         * @return The number of frames in the reorder window (0 when the reordering is disabled).
+         */
+        size_t get_reorder_window() const;
+
       protected:
         bool active_waiting = false;
         size_t buffer_size = 1;
+        bool lock_free = false;
+        size_t spin_budget = 0;
+        size_t batch_size = 1;
+        size_t buffer_size_min = 0;
+        size_t buffer_size_max = 0;
+        bool work_stealing = false;
+        size_t reorder_window = 0;
     };
 
   protected:
@@ -14,6 +14,7 @@
 
 #include "Module/Module.hpp"
 #include "Runtime/Task/Task.hpp"
+#include "Tools/Algo/Histogram/Histogram.hpp"
 
 namespace spu
 {
@@ -88,6 +89,14 @@ class Statistics
                            const std::chrono::nanoseconds timer_min_duration,
                            const std::chrono::nanoseconds timer_max_duration,
                            std::ostream& stream = std::cout);
+
+    static void show_percentiles_header(std::ostream& stream = std::cout);
+
+    static void show_percentiles(const std::string& module_name,
+                                 const std::string& task_name,
+                                 const tools::Histogram& task_duration_hist,
+                                 const std::chrono::nanoseconds task_max_duration,
+                                 std::ostream& stream = std::cout);
 };
 
 using Stats = Statistics;
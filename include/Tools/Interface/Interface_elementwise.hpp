@@ -0,0 +1,36 @@
+/*!
+ * \file
+ * \brief Class tools::Interface_elementwise.
+ */
+#ifndef INTERFACE_ELEMENTWISE_HPP__
+#define INTERFACE_ELEMENTWISE_HPP__
+
+#include <cstddef>
+
+namespace spu
+{
+namespace runtime
+{
+class Task;
+}
+namespace tools
+{
+// a module whose tasks compute each element of their output socket from the elements at the same position in their
+// input sockets (or from the unique element of an input socket of one element per frame): the chains of such tasks
+// can be fused in a single tiled loop by the 'runtime::Sequence' (see 'Sequence::set_fusion()')
+class Interface_elementwise
+{
+  public:
+    // has to return false when the processing of 'task' is overridden by a derived module: the implementations of
+    // the library only return true for their own (most derived) type, a derived module has to opt in explicitly
+    virtual bool is_elementwise(const runtime::Task& task) const = 0;
+    // computes 'n' consecutive elements of the output socket of 'task', 'in' contains one pointer per input socket
+    // (in the order of the sockets of 'task') on the elements at the same position or on the unique element
+    virtual void perform_elmts(const runtime::Task& task, const void* const* in, void* out, const size_t n) const = 0;
+    virtual ~Interface_elementwise() = default;
+};
+
+}
+}
+
+#endif // INTERFACE_ELEMENTWISE_HPP__
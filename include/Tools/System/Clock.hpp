@@ -0,0 +1,66 @@
+/*!
+ * \file
+ * \brief Class tools::Clock.
+ */
+#ifndef SYSTEM_CLOCK_HPP__
+#define SYSTEM_CLOCK_HPP__
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace spu
+{
+namespace tools
+{
+enum class clock_backend_t : uint8_t
+{
+    STEADY, // 'std::chrono::steady_clock'
+    TSC     // time-stamp counter of the CPU ('rdtscp' on x86, 'cntvct_el0' on ARMv8)
+};
+
+// monotonic clock used to time the tasks (statistics) and the probes, it can be used in place of
+// 'std::chrono::steady_clock'. With the 'TSC' backend, the counter of the CPU is read directly (no system call, no
+// vDSO) and the ticks are converted in nanoseconds from a frequency calibrated once (on the first use of the counter,
+// the calibration lasts 10 ms on x86, then the programs that never read the clock do not pay it at startup). The
+// time points of the two backends share the same origin (the epoch of 'std::chrono::steady_clock'). The 'TSC' backend
+// is the default one when the library is compiled with 'SPU_TSC_CLOCK' and when the counter is usable (invariant TSC
+// on x86). The backend should not be changed while tasks are being executed.
+class Clock
+{
+  public:
+    typedef std::chrono::nanoseconds duration;
+    typedef duration::rep rep;
+    typedef duration::period period;
+    typedef std::chrono::time_point<Clock, duration> time_point;
+    static constexpr bool is_steady = true;
+
+  private:
+    static clock_backend_t backend;
+    static uint64_t tsc_origin;   // value of the counter at the calibration
+    static int64_t tsc_origin_ns; // time of 'std::chrono::steady_clock' at the calibration (in ns)
+    static double tsc_ns_per_tick;
+    static std::atomic<bool> tsc_calibrated;
+
+  public:
+    static inline time_point now();
+
+    static void set_backend(const clock_backend_t backend);
+    static clock_backend_t get_backend();
+    static bool is_tsc_available();
+    static double get_tsc_frequency(); // in GHz, 0 when the counter has not been calibrated yet
+
+  private:
+    static inline uint64_t read_tsc();
+    static void calibrate_tsc();
+    static void calibrate_tsc_once(); // thread-safe, the calibration is only made by the first caller
+    static clock_backend_t init_backend();
+};
+}
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#include "Tools/System/Clock.hxx"
+#endif
+
+#endif /* SYSTEM_CLOCK_HPP__ */
@@ -0,0 +1,43 @@
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "Tools/System/Clock.hpp"
+
+namespace spu
+{
+namespace tools
+{
+
+uint64_t
+Clock::read_tsc()
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    // 'rdtscp' waits for the previous instructions to be executed (unlike 'rdtsc')
+    unsigned int aux;
+    return (uint64_t)__rdtscp(&aux);
+#elif defined(__aarch64__)
+    uint64_t cnt;
+    __asm__ __volatile__("isb; mrs %0, cntvct_el0" : "=r"(cnt) : : "memory");
+    return cnt;
+#else
+    return 0;
+#endif
+}
+
+Clock::time_point
+Clock::now()
+{
+    if (Clock::backend == clock_backend_t::TSC)
+    {
+        if (!Clock::tsc_calibrated.load(std::memory_order_acquire)) Clock::calibrate_tsc_once();
+        const double ticks = (double)(Clock::read_tsc() - Clock::tsc_origin);
+        return time_point(duration(Clock::tsc_origin_ns + (rep)(ticks * Clock::tsc_ns_per_tick)));
+    }
+    return time_point(std::chrono::duration_cast<duration>(std::chrono::steady_clock::now().time_since_epoch()));
+}
+
+}
+}
@@ -5,7 +5,9 @@
 #ifndef SYSTEM_MEMORY_HPP__
 #define SYSTEM_MEMORY_HPP__
 
+#include <cstddef>
 #include <new>
+#include <vector>
 
 namespace spu
 {
@@ -45,6 +47,25 @@ struct aligned_allocator
     void deallocate(T* p, std::size_t n) { buffer_free<T>(p); }
 };
 
+// size of a cache line in bytes (used to pad the data shared between threads and avoid false sharing)
+constexpr std::size_t cache_line_size = 64;
+
+// wraps 'T' so that two consecutive 'cache_aligned' objects never share a cache line, it has to be stored in a
+// container with an 'aligned_allocator' to guarantee the alignment (C++11 'new' ignores over-alignment)
+template<typename T>
+struct alignas(cache_line_size) cache_aligned
+{
+    T value;
+};
+
+template<typename T>
+using cache_aligned_vector = std::vector<cache_aligned<T>, aligned_allocator<cache_aligned<T>>>;
+
+// size in bytes of the data cache of level 'level' (1, 2 or 3) of the first core, detected with hwloc when StreamPU is
+// linked with it and with 'sysconf' otherwise, returns 0 when the size can't be detected
+std::size_t
+get_cache_size(const unsigned level);
+
 // Returns true if and only if storage allocated from ma1 can be
 // deallocated from ma2, and vice versa. Always returns true for
 // stateless allocators.
@@ -2,27 +2,41 @@
 #define THREAD_BARRIER_STANDARD_HPP_
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 
+#include "Tools/Thread/Thread_parking/Thread_parking.hpp"
+
 namespace spu
 {
 namespace tools
 {
 
 // implementations exist in pthread lib and C++20 stdlib but not in C++11 stdlib :-(
+// 'n_threads' threads 'arrive()' and a single thread 'wait()'s for all of them. The barrier is sense-reversing: the
+// last arriving thread resets the counter and moves the barrier to the next phase, so the counter is never reset by
+// the waiting thread. The waiting thread spins for 'spin_budget' iterations and then parks (see 'Thread_parking')
 class Thread_barrier_standard
 {
   private:
     const uint32_t n_threads;
+    const size_t spin_budget;
     std::atomic<uint32_t> count;
+    std::atomic<uint32_t> phase;
+    uint32_t cur_phase; // last phase seen by the waiting thread
+    Thread_parking parking;
 
   public:
-    inline Thread_barrier_standard(const uint32_t n_threads);
+    inline Thread_barrier_standard(const uint32_t n_threads, const size_t spin_budget = default_spin_budget());
     inline Thread_barrier_standard(const Thread_barrier_standard& other);
     inline ~Thread_barrier_standard() = default;
     inline void arrive();
     inline void reset();
     inline void wait();
+    inline size_t get_spin_budget() const;
+
+    // no spinning on a single core (the waiting thread would steal the CPU of the threads that it waits for)
+    static inline size_t default_spin_budget();
 };
 
 }
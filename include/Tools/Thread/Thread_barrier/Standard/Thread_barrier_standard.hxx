@@ -1,5 +1,5 @@
-#include <iostream>
 #include <sstream>
+#include <thread>
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Thread/Thread_barrier/Standard/Thread_barrier_standard.hpp"
@@ -9,43 +9,72 @@ namespace spu
 namespace tools
 {
 
-Thread_barrier_standard::Thread_barrier_standard(const uint32_t n_threads)
+Thread_barrier_standard::Thread_barrier_standard(const uint32_t n_threads, const size_t spin_budget)
   : n_threads(n_threads)
+  , spin_budget(spin_budget)
   , count(0)
+  , phase(0)
+  , cur_phase(0)
 {
 }
 
 Thread_barrier_standard::Thread_barrier_standard(const Thread_barrier_standard& other)
   : n_threads(other.n_threads)
+  , spin_budget(other.spin_budget)
   , count(0)
+  , phase(0)
+  , cur_phase(0)
 {
 }
 
+size_t
+Thread_barrier_standard::default_spin_budget()
+{
+    return std::thread::hardware_concurrency() > 1 ? 4096 : 0;
+}
+
 void
 Thread_barrier_standard::arrive()
 {
-    this->count++;
-    if (this->count > this->n_threads)
+    const uint32_t count = this->count.fetch_add(1, std::memory_order_acq_rel) + 1;
+    if (count > this->n_threads)
     {
         std::stringstream message;
-        message << "Something went wrong, 'count' cannot be higher than 'n_threads' ('count' = " << this->count
+        message << "Something went wrong, 'count' cannot be higher than 'n_threads' ('count' = " << count
                 << " , 'n_threads' = " << n_threads << ").";
         throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
     }
+
+    if (count == this->n_threads)
+    {
+        // the counter is reset before the phase is published, a thread that arrives again after the waiting thread
+        // has been released is counted in the next phase
+        this->count.store(0, std::memory_order_relaxed);
+        this->phase.fetch_add(1, std::memory_order_release);
+        this->parking.unpark();
+    }
 }
 
 void
 Thread_barrier_standard::reset()
 {
     this->count = 0;
+    this->cur_phase = this->phase.load();
 }
 
 void
 Thread_barrier_standard::wait()
 {
-    while (this->count != this->n_threads)
-        std::this_thread::sleep_for(std::chrono::microseconds(1));
-    this->reset();
+    if (this->n_threads)
+        this->parking.wait(this->spin_budget,
+                           [this]() { return this->phase.load(std::memory_order_acquire) != this->cur_phase; });
+    this->cur_phase = this->phase.load(std::memory_order_acquire);
+}
+
+size_t
+Thread_barrier_standard::get_spin_budget() const
+{
+    return this->spin_budget;
 }
 
 }
@@ -0,0 +1,62 @@
+/*!
+ * \file
+ * \brief Class tools::Thread_parking.
+ */
+#ifndef THREAD_PARKING_HPP_
+#define THREAD_PARKING_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace spu
+{
+namespace tools
+{
+
+// hint to the CPU that the calling thread is busy waiting (reduces the power consumption and the pressure on the
+// sibling hyper-thread)
+inline void
+cpu_relax();
+
+// a place where threads can park until another thread signals a change of state, the waiting is done in three phases:
+// 1. spin on the predicate with CPU relax hints for 'spin_budget' iterations,
+// 2. yield the CPU to other threads for 'n_yields' iterations,
+// 3. park the thread in the kernel (a futex on Linux, a condition variable otherwise).
+// The notifying side only pays for a system call when at least one thread is parked.
+class Thread_parking
+{
+  public:
+    static constexpr size_t n_yields = 16;
+
+  private:
+    std::atomic<uint32_t> epoch;
+    std::atomic<uint32_t> n_parked;
+#ifndef __linux__
+    std::mutex mtx;
+    std::condition_variable cnd;
+#endif
+
+  public:
+    inline Thread_parking();
+    inline Thread_parking(const Thread_parking& other);
+    inline ~Thread_parking() = default;
+
+    template<class P> inline void wait(const size_t spin_budget, P predicate);
+    inline void unpark();
+
+  protected:
+    void park(const uint32_t epoch);
+    void unpark_all();
+};
+
+}
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#include "Tools/Thread/Thread_parking/Thread_parking.hxx"
+#endif
+
+#endif /* THREAD_PARKING_HPP_ */
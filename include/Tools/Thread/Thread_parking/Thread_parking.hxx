@@ -0,0 +1,71 @@
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+#include "Tools/Thread/Thread_parking/Thread_parking.hpp"
+
+namespace spu
+{
+namespace tools
+{
+
+void
+cpu_relax()
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+Thread_parking::Thread_parking()
+  : epoch(0)
+  , n_parked(0)
+{
+}
+
+Thread_parking::Thread_parking(const Thread_parking&)
+  : epoch(0)
+  , n_parked(0)
+{
+}
+
+template<class P>
+void
+Thread_parking::wait(const size_t spin_budget, P predicate)
+{
+    for (size_t i = 0; i < spin_budget; i++)
+    {
+        if (predicate()) return;
+        cpu_relax();
+    }
+
+    for (size_t i = 0; i < Thread_parking::n_yields; i++)
+    {
+        if (predicate()) return;
+        std::this_thread::yield();
+    }
+
+    // the parked counter is incremented before the predicate is checked for the last time: the notifying side either
+    // sees the parked thread or the parked thread sees the new state (both sides use sequentially consistent atomics)
+    while (!predicate())
+    {
+        this->n_parked.fetch_add(1);
+        const uint32_t cur_epoch = this->epoch.load();
+        if (!predicate()) this->park(cur_epoch);
+        this->n_parked.fetch_sub(1);
+    }
+}
+
+void
+Thread_parking::unpark()
+{
+    this->epoch.fetch_add(1);
+    if (this->n_parked.load()) this->unpark_all();
+}
+
+}
+}
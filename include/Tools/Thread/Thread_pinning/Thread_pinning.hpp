@@ -1,6 +1,7 @@
 #ifndef THREAD_PINNING_HPP
 #define THREAD_PINNING_HPP
 
+#include <cstddef>
 #include <string>
 
 namespace spu
@@ -17,6 +18,16 @@ class Thread_pinning
     static void pin(const std::string hwloc_objects);
     static void unpin();
 
+    // bind the memory area ['ptr', 'ptr' + 'size'[ to the NUMA node(s) local to the 'hwloc_objects' (ex: "PU_3" or
+    // "NUMA_0"), the pages that have already been touched are migrated, returns false if nothing has been done
+    static bool bind_memory(const void* ptr, const size_t size, const std::string hwloc_objects);
+    // allocate 'size' bytes of whole pages bound to the NUMA node(s) local to the 'hwloc_objects', returns nullptr if
+    // nothing has been done (the memory has to be released with 'free_memory')
+    static void* alloc_memory(const size_t size, const std::string hwloc_objects);
+    static void free_memory(void* ptr, const size_t size);
+    // true if the memory area is bound to (a subset of) the NUMA node(s) local to the 'hwloc_objects'
+    static bool is_memory_bound(const void* ptr, const size_t size, const std::string hwloc_objects);
+
     static std::string get_cur_cpuset_str();
 
     static void set_logs(const bool enable_logs);
@@ -123,9 +123,15 @@
 #ifndef SEQUENCE_HPP_
 #include <Runtime/Sequence/Sequence.hpp>
 #endif
+#ifndef SEQUENCE_HANDLE_HPP_
+#include <Runtime/Sequence/Sequence_handle.hpp>
+#endif
 #ifndef SOCKET_HPP_
 #include <Runtime/Socket/Socket.hpp>
 #endif
+#ifndef CODELET_TYPED_HPP_
+#include <Runtime/Task/Codelet_typed.hpp>
+#endif
 #ifndef TASK_HPP_
 #include <Runtime/Task/Task.hpp>
 #endif
@@ -144,6 +150,12 @@
 #ifndef DIGRAPH_NODE_HPP_
 #include <Tools/Algo/Digraph/Digraph_node.hpp>
 #endif
+#ifndef HISTOGRAM_HPP_
+#include <Tools/Algo/Histogram/Histogram.hpp>
+#endif
+#ifndef SHARED_DATA_HPP_
+#include <Tools/Algo/Shared_data/Shared_data.hpp>
+#endif
 #ifndef PIPELINE_BUILDER_HPP_
 #include <Tools/Builder/Pipeline_builder.hpp>
 #endif
@@ -216,6 +228,9 @@
 #ifndef INTERFACE_CLONE_HPP__
 #include <Tools/Interface/Interface_clone.hpp>
 #endif
+#ifndef INTERFACE_ELEMENTWISE_HPP__
+#include <Tools/Interface/Interface_elementwise.hpp>
+#endif
 #ifndef INTERFACE_GET_SET_N_FRAMES_HPP__
 #include <Tools/Interface/Interface_get_set_n_frames.hpp>
 #endif
@@ -249,12 +264,18 @@
 #ifndef SIGNAL_HANDLER_HPP_
 #include <Tools/Signal_handler/Signal_handler.hpp>
 #endif
+#ifndef SYSTEM_CLOCK_HPP__
+#include <Tools/System/Clock.hpp>
+#endif
 #ifndef SYSTEM_MEMORY_HPP__
 #include <Tools/System/memory.hpp>
 #endif
 #ifndef THREAD_BARRIER_STANDARD_HPP_
 #include <Tools/Thread/Thread_barrier/Standard/Thread_barrier_standard.hpp>
 #endif
+#ifndef THREAD_PARKING_HPP_
+#include <Tools/Thread/Thread_parking/Thread_parking.hpp>
+#endif
 #ifndef THREAD_PINNING_HPP
 #include <Tools/Thread/Thread_pinning/Thread_pinning.hpp>
 #endif
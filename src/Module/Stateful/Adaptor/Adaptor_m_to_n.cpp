@@ -1,5 +1,9 @@
+#include <algorithm>
+#include <cmath>
+
 #include "Module/Stateful/Adaptor/Adaptor_m_to_n.hpp"
 #include "Tools/Math/utils.h"
+#include "Tools/Thread/Thread_pinning/Thread_pinning.hpp"
 
 using namespace spu;
 using namespace spu::module;
@@ -7,7 +11,8 @@ using namespace spu::module;
 Adaptor_m_to_n::~Adaptor_m_to_n()
 {
     for (auto b : this->buffer_to_free)
-        delete[] b;
+        this->free_slot(b);
+    this->free_window();
     if (this->cloned) (*this->n_clones)--;
 }
 
@@ -37,6 +42,14 @@ Adaptor_m_to_n::deep_copy(const Adaptor_m_to_n& m)
     this->tid_pull = -1;
     this->cur_push_id = -1;
     this->cur_pull_id = -1;
+    this->cur_pull_home_id = -1;
+    this->tag_source = nullptr;
+    this->n_pushed = 0;
+    this->cur_pull_tag = 0;
+    // the reorder window is specific to each puller, it is allocated on the first pull
+    this->window_buffers.clear();
+    this->window_to_free.clear();
+    this->placed_slots.clear();
 
     this->waiting_canceled.reset(new std::atomic<bool>(m.waiting_canceled->load()));
 }
@@ -59,17 +72,25 @@ Adaptor_m_to_n::alloc_buffers()
         throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
     }
 
-    size_t ppcm = tools::find_smallest_common_multiple(*this->n_pushers, *this->n_pullers);
+    if (this->reorder_window && *this->n_pullers > 1)
+    {
+        std::stringstream message;
+        message << "The reorder mode requires a single puller ('reorder_window' = " << this->reorder_window
+                << ", 'n_pullers' = " << *this->n_pullers << ").";
+        throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
 
-    if (ppcm > 1000)
+    if (!this->pull_placement.empty() && this->pull_placement.size() != *this->n_pullers)
     {
         std::stringstream message;
-        message << "'ppcm' cannot exceed 1000 ('ppcm' = " << ppcm << ").";
-        throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+        message << "'pull_placement.size()' has to be equal to 'n_pullers' ('pull_placement.size()' = "
+                << this->pull_placement.size() << ", 'n_pullers' = " << *this->n_pullers << ").";
+        throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
     }
 
-    this->buffer->resize(ppcm,
-                         std::vector<std::vector<int8_t*>>(this->n_sockets, std::vector<int8_t*>(this->buffer_size)));
+    // one sub-buffer is required per couple of pusher/puller to preserve the round-robin order, this number explodes
+    // when the numbers of pushers and pullers are coprime
+    const size_t ppcm = tools::find_smallest_common_multiple(*this->n_pushers, *this->n_pullers);
 
     if (this->buffer_to_free.size())
     {
@@ -78,26 +99,80 @@ Adaptor_m_to_n::alloc_buffers()
         throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
     }
 
-    // this->buffer_to_free.clear();
-    for (size_t d = 0; d < ppcm; d++)
+    try
     {
-        for (size_t s = 0; s < this->n_sockets; s++)
-            for (size_t b = 0; b < this->buffer_size; b++)
-            {
-                (*this->buffer)[d][s][b] = new int8_t[this->n_frames * this->n_bytes[s]];
-                this->buffer_to_free.push_back((*this->buffer)[d][s][b]);
-            }
-        (*this->first)[d] = 0;
-        (*this->last)[d] = 0;
-        (*this->counter)[d] = this->buffer_size;
+        this->buffer->resize(
+          ppcm, std::vector<std::vector<int8_t*>>(this->n_sockets, std::vector<int8_t*>(this->buffer_size)));
+
+        // atomics, mutexes and condition variables are not movable, the vectors are swapped instead of resized to keep
+        // them shared with the clones
+        tools::cache_aligned_vector<uint32_t>(ppcm).swap(*this->first);
+        tools::cache_aligned_vector<uint32_t>(ppcm).swap(*this->last);
+        tools::cache_aligned_vector<std::atomic<uint32_t>>(ppcm).swap(*this->counter);
+        tools::cache_aligned_vector<std::condition_variable>(ppcm).swap(*this->cnd_push);
+        tools::cache_aligned_vector<std::mutex>(ppcm).swap(*this->mtx_push);
+        tools::cache_aligned_vector<std::condition_variable>(ppcm).swap(*this->cnd_pull);
+        tools::cache_aligned_vector<std::mutex>(ppcm).swap(*this->mtx_pull);
+        tools::cache_aligned_vector<tools::Thread_parking>(ppcm).swap(*this->park_push);
+        tools::cache_aligned_vector<tools::Thread_parking>(ppcm).swap(*this->park_pull);
+        this->tags->assign(ppcm * this->buffer_size, 0);
+        this->metas->assign(ppcm * this->buffer_size * this->n_frames, { 0, 0 });
+        if (this->is_adaptive_depth())
+        {
+            tools::cache_aligned_vector<depth_push_stats_t>(ppcm).swap(*this->depth_push_stats);
+            tools::cache_aligned_vector<depth_pull_stats_t>(ppcm).swap(*this->depth_pull_stats);
+            for (size_t d = 0; d < ppcm; d++)
+                (*this->depth_push_stats)[d].value.occupancy.resize(this->buffer_size + 1);
+        }
+
+        for (size_t d = 0; d < ppcm; d++)
+        {
+            for (size_t s = 0; s < this->n_sockets; s++)
+                for (size_t b = 0; b < this->buffer_size; b++)
+                {
+                    (*this->buffer)[d][s][b] =
+                      this->alloc_slot(d % *this->n_pullers, this->n_frames * this->n_bytes[s]);
+                    this->buffer_to_free.push_back((*this->buffer)[d][s][b]);
+                }
+            (*this->first)[d].value = 0;
+            (*this->last)[d].value = 0;
+            (*this->counter)[d].value = this->buffer_size;
+        }
+    }
+    catch (std::bad_alloc&)
+    {
+        std::stringstream message;
+        message << "The synchronization buffers cannot be allocated, try to use numbers of pushers and pullers that "
+                << "are multiple of each other to reduce the number of sub-buffers ('ppcm' = " << ppcm
+                << ", 'n_pushers' = " << *this->n_pushers << ", 'n_pullers' = " << *this->n_pullers
+                << ", 'buffer_size' = " << this->buffer_size << ", 'n_frames' = " << this->n_frames << ").";
+        throw tools::cannot_allocate(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (this->lock_free)
+    {
+        // each sub-buffer is a ring of 'buffer_size' slots with its own sequence numbers and positions
+        tools::cache_aligned_vector<std::atomic<size_t>>(ppcm * this->buffer_size).swap(*this->ring_seq);
+        tools::cache_aligned_vector<std::atomic<size_t>>(ppcm).swap(*this->ring_head);
+        tools::cache_aligned_vector<std::atomic<size_t>>(ppcm).swap(*this->ring_tail);
+        this->reset_ring();
     }
 
+    this->reset_depth();
     *this->buffers_allocated = true;
 }
 
 void
 Adaptor_m_to_n::add_pusher()
 {
+    if (*this->buffers_allocated)
+    {
+        std::stringstream message;
+        message << "Pusher cannot be added because the synchronization buffers have already been allocated ("
+                << "'n_pushers' = " << *this->n_pushers << ", 'n_pullers' = " << *this->n_pullers << ").";
+        throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
     if (*this->n_pushers - 1 + *this->n_pullers - 1 >= *this->n_clones)
     {
         std::stringstream message;
@@ -114,6 +189,14 @@ Adaptor_m_to_n::add_pusher()
 void
 Adaptor_m_to_n::add_puller()
 {
+    if (*this->buffers_allocated)
+    {
+        std::stringstream message;
+        message << "Puller cannot be added because the synchronization buffers have already been allocated ("
+                << "'n_pushers' = " << *this->n_pushers << ", 'n_pullers' = " << *this->n_pullers << ").";
+        throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
     if (*this->n_pushers - 1 + *this->n_pullers - 1 >= *this->n_clones)
     {
         std::stringstream message;
@@ -125,6 +208,7 @@ Adaptor_m_to_n::add_puller()
     this->tid_pull = (*this->n_pullers);
     (*this->n_pullers)++;
     this->cur_pull_id = this->tid_pull;
+    this->cur_pull_home_id = this->tid_pull;
 }
 
 void
@@ -141,14 +225,224 @@ Adaptor_m_to_n::reset()
         *this->waiting_canceled = false;
         for (size_t d = 0; d < this->buffer->size(); d++)
         {
-            (*this->first)[d] = 0;
-            (*this->last)[d] = 0;
-            (*this->counter)[d] = this->buffer_size;
+            (*this->first)[d].value = 0;
+            (*this->last)[d].value = 0;
+            (*this->counter)[d].value = this->buffer_size;
         }
+        if (this->lock_free) this->reset_ring();
+        this->reset_depth();
     }
     this->cur_push_id = (size_t)this->tid_push;
     this->cur_pull_id = (size_t)this->tid_pull;
+    this->cur_pull_home_id = (size_t)this->tid_pull;
+    this->cur_push_batch = 0;
+    this->cur_pull_batch = 0;
+    this->n_pushed = 0;
+    this->cur_pull_tag = 0;
     this->reset_buffer();
+    this->reset_window();
+}
+
+void
+Adaptor_m_to_n::reset_ring()
+{
+    for (size_t d = 0; d < this->ring_head->size(); d++)
+    {
+        for (size_t b = 0; b < this->buffer_size; b++)
+            (*this->ring_seq)[d * this->buffer_size + b].value.store(2 * b, std::memory_order_relaxed);
+        (*this->ring_head)[d].value.store(0, std::memory_order_relaxed);
+        (*this->ring_tail)[d].value.store(0, std::memory_order_relaxed);
+    }
+}
+
+void
+Adaptor_m_to_n::reset_depth()
+{
+    for (size_t d = 0; d < this->depth_push_stats->size(); d++)
+    {
+        auto& push = (*this->depth_push_stats)[d].value;
+        push.depth.store(this->depth_init, std::memory_order_relaxed);
+        push.n_claims = 0;
+        push.n_stalls = 0;
+        push.sum_dt = 0.;
+        push.sum_dt2 = 0.;
+        std::fill(push.occupancy.begin(), push.occupancy.end(), 0);
+        push.pull_n_claims = 0;
+        push.pull_n_stalls = 0;
+        push.pull_sum_dt = 0.;
+        push.pull_sum_dt2 = 0.;
+
+        auto& pull = (*this->depth_pull_stats)[d].value;
+        pull.n_claims.store(0, std::memory_order_relaxed);
+        pull.n_stalls.store(0, std::memory_order_relaxed);
+        pull.sum_dt.store(0., std::memory_order_relaxed);
+        pull.sum_dt2.store(0., std::memory_order_relaxed);
+    }
+}
+
+// called by the pusher of the sub-buffer 'id' at the end of each window: the depth is doubled when the pusher has
+// been stalled by the depth while the rates of the pusher and of the puller fluctuate (the puller also starved or the
+// durations between two claims vary a lot), then more slots absorb the bursts. The depth is halved when the 99th
+// percentile of the occupancy stays far below the depth or when the pusher has been stalled by a puller that is
+// steadily slower (more slots would not increase the throughput but the latency and the memory footprint)
+void
+Adaptor_m_to_n::adapt_depth(const size_t id)
+{
+    constexpr double stall_ratio_min = 0.02;
+    constexpr double jitter_max = 0.5;
+
+    auto& push = (*this->depth_push_stats)[id].value;
+    auto& pull = (*this->depth_pull_stats)[id].value;
+
+    const uint64_t pull_n_claims = pull.n_claims.load(std::memory_order_relaxed);
+    const uint64_t pull_n_stalls = pull.n_stalls.load(std::memory_order_relaxed);
+    const double pull_sum_dt = pull.sum_dt.load(std::memory_order_relaxed);
+    const double pull_sum_dt2 = pull.sum_dt2.load(std::memory_order_relaxed);
+
+    // squared coefficient of variation of the durations between two claims
+    auto cv2 = [](const double n, const double sum, const double sum2) -> double
+    {
+        if (n < 2 || sum <= 0.) return 0.;
+        const double mean = sum / n;
+        return std::max(0., sum2 / n - mean * mean) / (mean * mean);
+    };
+
+    const double n_claims = (double)push.n_claims;
+    const double pull_n = (double)(pull_n_claims - push.pull_n_claims);
+    const double jitter = cv2(n_claims, push.sum_dt, push.sum_dt2) +
+                          cv2(pull_n, pull_sum_dt - push.pull_sum_dt, pull_sum_dt2 - push.pull_sum_dt2);
+    const double stall_ratio = (double)push.n_stalls / n_claims;
+    const double starve_ratio = pull_n ? (double)(pull_n_stalls - push.pull_n_stalls) / pull_n : 0.;
+
+    size_t occupancy_p99 = 0;
+    size_t n_samples = push.occupancy[0];
+    while (n_samples < (size_t)std::ceil(0.99 * n_claims) && occupancy_p99 + 1 < push.occupancy.size())
+        n_samples += push.occupancy[++occupancy_p99];
+
+    size_t depth = push.depth.load(std::memory_order_relaxed);
+    if (stall_ratio > stall_ratio_min && (starve_ratio > stall_ratio_min || jitter > jitter_max))
+        depth = std::min(this->depth_max, 2 * depth);
+    else if (occupancy_p99 + this->batch_size <= depth / 2 || stall_ratio > stall_ratio_min)
+        depth = std::max(this->depth_min, depth / 2);
+    push.depth.store(depth, std::memory_order_relaxed);
+
+    push.n_claims = 0;
+    push.n_stalls = 0;
+    push.sum_dt = 0.;
+    push.sum_dt2 = 0.;
+    std::fill(push.occupancy.begin(), push.occupancy.end(), 0);
+    push.pull_n_claims = pull_n_claims;
+    push.pull_n_stalls = pull_n_stalls;
+    push.pull_sum_dt = pull_sum_dt;
+    push.pull_sum_dt2 = pull_sum_dt2;
+}
+
+void
+Adaptor_m_to_n::set_tag_source(const Adaptor_m_to_n* tag_source)
+{
+    this->tag_source = tag_source;
+}
+
+void
+Adaptor_m_to_n::set_pull_placement(const std::vector<std::string>& pull_placement)
+{
+    if (*this->buffers_allocated)
+    {
+        std::stringstream message;
+        message << "The placement of the pullers has to be set before the allocation of the synchronization buffers.";
+        throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    this->pull_placement = pull_placement;
+}
+
+// the slots pulled by a placed puller are allocated on whole pages bound to its NUMA node and touched right away:
+// otherwise they would be mapped on the node of the first thread that writes them (the pusher or the thread that
+// allocates them), and binding an area of the heap would also move the data that shares its pages
+int8_t*
+Adaptor_m_to_n::alloc_slot(const size_t puller_id, const size_t size)
+{
+    if (!this->pull_placement.empty() && !this->pull_placement[puller_id].empty())
+    {
+        auto ptr = (int8_t*)tools::Thread_pinning::alloc_memory(size, this->pull_placement[puller_id]);
+        if (ptr != nullptr)
+        {
+            std::fill(ptr, ptr + size, 0);
+            this->placed_slots[ptr] = size;
+            return ptr;
+        }
+    }
+    return new int8_t[size];
+}
+
+void
+Adaptor_m_to_n::free_slot(int8_t* ptr)
+{
+    auto it = this->placed_slots.find(ptr);
+    if (it != this->placed_slots.end())
+    {
+        tools::Thread_pinning::free_memory(ptr, it->second);
+        this->placed_slots.erase(it);
+    }
+    else
+        delete[] ptr;
+}
+
+bool
+Adaptor_m_to_n::check_pull_placement() const
+{
+    if (this->pull_placement.empty() || !*this->buffers_allocated) return false;
+
+    for (size_t d = 0; d < this->buffer->size(); d++)
+    {
+        const auto& objects = this->pull_placement[d % *this->n_pullers];
+        for (size_t s = 0; s < this->n_sockets; s++)
+            for (auto slot : (*this->buffer)[d][s])
+                if (objects.empty() ||
+                    !tools::Thread_pinning::is_memory_bound(slot, this->n_frames * this->n_bytes[s], objects))
+                    return false;
+    }
+    return true;
+}
+
+void
+Adaptor_m_to_n::alloc_window()
+{
+    this->window_buffers.assign(this->reorder_window, std::vector<int8_t*>(this->n_sockets));
+    for (size_t w = 0; w < this->reorder_window; w++)
+        for (size_t s = 0; s < this->n_sockets; s++)
+        {
+            // the reorder mode has a single puller, the window buffers are swapped with its slots
+            this->window_buffers[w][s] = this->alloc_slot(0, this->n_frames * this->n_bytes[s]);
+            this->window_to_free.push_back(this->window_buffers[w][s]);
+        }
+    this->window_tags.assign(this->reorder_window, 0);
+    this->window_metas.assign(this->reorder_window * this->n_frames, { 0, 0 });
+    this->window_filled.assign(this->reorder_window, false);
+    this->window_n_filled = 0;
+}
+
+void
+Adaptor_m_to_n::free_window()
+{
+    for (auto b : this->window_to_free)
+        this->free_slot(b);
+    this->window_to_free.clear();
+    this->window_buffers.clear();
+}
+
+void
+Adaptor_m_to_n::reset_window()
+{
+    // the buffers of the window may have been swapped with the buffers of the sub-buffers or of the sockets
+    size_t id_buff = 0;
+    for (size_t w = 0; w < this->window_buffers.size(); w++)
+        for (size_t s = 0; s < this->n_sockets; s++)
+            this->window_buffers[w][s] = this->window_to_free[id_buff++];
+    std::fill(this->window_filled.begin(), this->window_filled.end(), false);
+    this->window_n_filled = 0;
+    this->next_pull_tag = 0;
+    // 'n_late_frames' is a statistic: it is kept across the resets so it can be read after the execution
 }
 
 void
@@ -195,10 +489,12 @@ Adaptor_m_to_n::set_n_frames(const size_t n_frames)
     if (old_n_frames != n_frames)
     {
         Module::set_n_frames(n_frames);
+        this->free_window(); // the reorder window will be allocated again on the next pull
         if (!this->cloned)
         {
             if (*this->buffers_allocated)
             {
+                this->metas->assign(this->buffer->size() * this->buffer_size * n_frames, { 0, 0 });
                 for (size_t d = 0; d < (*this->buffer).size(); d++)
                 {
                     for (size_t s = 0; s < (*this->buffer)[d].size(); s++)
@@ -206,13 +502,14 @@ Adaptor_m_to_n::set_n_frames(const size_t n_frames)
                         for (size_t b = 0; b < (*this->buffer)[d][s].size(); b++)
                         {
                             auto old_ptr = (*this->buffer)[d][s][b];
-                            (*this->buffer)[d][s][b] = new int8_t[this->n_bytes[s] * n_frames];
+                            (*this->buffer)[d][s][b] =
+                              this->alloc_slot(d % *this->n_pullers, this->n_bytes[s] * n_frames);
 
                             bool found = false;
                             for (size_t bf = 0; bf < this->buffer_to_free.size(); bf++)
                                 if (this->buffer_to_free[bf] == old_ptr)
                                 {
-                                    delete[] this->buffer_to_free[bf];
+                                    this->free_slot(this->buffer_to_free[bf]);
                                     this->buffer_to_free[bf] = (*this->buffer)[d][s][b];
                                     found = true;
                                     break;
@@ -276,26 +573,112 @@ Adaptor_m_to_n::wait_push()
         throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
     }
 
-    if (this->active_waiting)
+    if (this->cur_push_batch) // the slots of the current batch have already been claimed
     {
-        while (this->is_full(this->cur_push_id) && !*this->waiting_canceled)
-            ;
+        if (*this->waiting_canceled) throw tools::waiting_canceled(__FILE__, __LINE__, __func__);
+        this->cur_push_slot = (this->cur_push_slot + 1) % this->buffer_size;
+        this->cur_push_pos++;
+        this->tag_push_slot();
+        return;
     }
-    else // passive waiting
+
+    // the sub-buffer is ready when a full batch of slots is available or when the waiting has been canceled
+    const auto is_ready = [this]()
+    { return this->has_free_slots(this->cur_push_id, this->batch_size) || *this->waiting_canceled; };
+
+    const bool stalled = this->is_adaptive_depth() && !this->has_free_slots(this->cur_push_id, this->batch_size);
+    do
     {
-        if (this->is_full(this->cur_push_id) && !*this->waiting_canceled)
+        if (this->active_waiting)
         {
-            std::unique_lock<std::mutex> lock((*this->mtx_push.get())[this->cur_push_id]);
-            ((*this->cnd_push.get())[this->cur_push_id])
-              .wait(lock, [this]() { return !(this->is_full(this->cur_push_id) && !*this->waiting_canceled); });
+            while (!is_ready())
+                tools::cpu_relax();
+        }
+        else if (this->is_hybrid_waiting())
+            (*this->park_push)[this->cur_push_id].value.wait(this->spin_budget, is_ready);
+        else // passive waiting
+        {
+            if (!is_ready())
+            {
+                std::unique_lock<std::mutex> lock((*this->mtx_push)[this->cur_push_id].value);
+                ((*this->cnd_push)[this->cur_push_id].value).wait(lock, is_ready);
+            }
         }
-    }
 
-    if (*this->waiting_canceled) throw tools::waiting_canceled(__FILE__, __LINE__, __func__);
+        if (*this->waiting_canceled) throw tools::waiting_canceled(__FILE__, __LINE__, __func__);
+    } while (this->lock_free && !this->try_claim_push(this->batch_size));
+
+    if (!this->lock_free) this->cur_push_slot = (*this->last)[this->cur_push_id].value;
+    if (this->is_adaptive_depth()) this->update_depth_push_stats(this->cur_push_id, stalled);
+    this->tag_push_slot();
 }
 
 void
 Adaptor_m_to_n::wait_pull()
+{
+    const bool frame_meta = this->tasks[1]->is_frame_meta(); // pull task
+    if (!this->reorder_window)
+    {
+        this->_wait_pull();
+        if (frame_meta) this->tasks[1]->copy_frame_meta(this->slot_meta(this->cur_pull_id, this->cur_pull_slot));
+        return;
+    }
+
+    if (this->window_buffers.empty()) this->alloc_window();
+
+    while (true)
+    {
+        // the oldest frame of the window is emitted when it is the next one in the sequence (or a late one) or when
+        // the window is full
+        size_t w_min = 0;
+        if (this->window_n_filled)
+        {
+            for (size_t w = 0; w < this->reorder_window; w++)
+                if (this->window_filled[w] &&
+                    (!this->window_filled[w_min] || this->window_tags[w] < this->window_tags[w_min]))
+                    w_min = w;
+            if (this->window_tags[w_min] <= this->next_pull_tag || this->window_n_filled == this->reorder_window)
+            {
+                this->cur_window_id = w_min;
+                break;
+            }
+        }
+
+        try
+        {
+            this->_wait_pull();
+        }
+        catch (tools::waiting_canceled const&)
+        {
+            // the previous stage is over, the frames remaining in the window are emitted in order
+            if (!this->window_n_filled) throw;
+            this->cur_window_id = w_min;
+            break;
+        }
+
+        // move the pulled frame in a free entry of the window (the buffers are swapped) and give the slot back to the
+        // pusher right away
+        size_t w = 0;
+        while (this->window_filled[w])
+            w++;
+        for (size_t s = 0; s < this->n_sockets; s++)
+            std::swap(this->window_buffers[w][s], (*this->buffer)[this->cur_pull_id][s][this->cur_pull_slot]);
+        this->window_tags[w] = this->cur_pull_tag;
+        if (frame_meta)
+        {
+            const runtime::frame_meta_t* meta = this->slot_meta(this->cur_pull_id, this->cur_pull_slot);
+            std::copy(meta, meta + this->n_frames, this->window_metas.begin() + w * this->n_frames);
+        }
+        this->window_filled[w] = true;
+        this->window_n_filled++;
+        this->_wake_up_pusher();
+    }
+    this->cur_pull_tag = this->window_tags[this->cur_window_id];
+    if (frame_meta) this->tasks[1]->copy_frame_meta(this->window_metas.data() + this->cur_window_id * this->n_frames);
+}
+
+void
+Adaptor_m_to_n::_wait_pull()
 {
     if (this->tid_pull < 0)
     {
@@ -304,23 +687,65 @@ Adaptor_m_to_n::wait_pull()
         throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
     }
 
-    if (this->active_waiting)
+    if (this->cur_pull_batch) // the slots of the current batch have already been claimed
     {
-        while (this->is_empty(this->cur_pull_id) && !*this->waiting_canceled)
-            ;
+        this->cur_pull_slot = (this->cur_pull_slot + 1) % this->buffer_size;
+        this->cur_pull_pos++;
+        this->cur_pull_tag = (*this->tags)[this->cur_pull_id * this->buffer_size + this->cur_pull_slot];
+        return;
     }
-    else // passive waiting
+
+    // the sub-buffer is ready when a full batch of slots is available or when the waiting has been canceled, in
+    // work-stealing mode any sub-buffer will do
+    const auto is_ready = [this]()
+    {
+        if (this->work_stealing) return this->has_stealable_slots(this->batch_size) || *this->waiting_canceled;
+        return this->has_filled_slots(this->cur_pull_id, this->batch_size) || *this->waiting_canceled;
+    };
+
+    // the puller statistics of the adaptive depth are not collected in work-stealing mode (a sub-buffer has no
+    // dedicated puller anymore)
+    const bool collect_stats = this->is_adaptive_depth() && !this->work_stealing;
+    const bool stalled = collect_stats && !this->has_filled_slots(this->cur_pull_id, this->batch_size);
+    do
     {
-        if (this->is_empty(this->cur_pull_id) && !*this->waiting_canceled)
+        const size_t wait_id = this->pull_wait_id();
+        if (this->active_waiting)
         {
-            std::unique_lock<std::mutex> lock((*this->mtx_pull.get())[this->cur_pull_id]);
-            ((*this->cnd_pull.get())[this->cur_pull_id])
-              .wait(lock, [this]() { return !(this->is_empty(this->cur_pull_id) && !*this->waiting_canceled); });
+            while (!is_ready())
+                tools::cpu_relax();
         }
-    }
+        else if (this->is_hybrid_waiting())
+            (*this->park_pull)[wait_id].value.wait(this->spin_budget, is_ready);
+        else // passive waiting
+        {
+            if (!is_ready())
+            {
+                std::unique_lock<std::mutex> lock((*this->mtx_pull)[wait_id].value);
+                ((*this->cnd_pull)[wait_id].value).wait(lock, is_ready);
+            }
+        }
+
+        if (this->work_stealing)
+        {
+            if (*this->waiting_canceled && this->is_empty_all())
+                throw tools::waiting_canceled(__FILE__, __LINE__, __func__);
+            continue;
+        }
+
+        if (this->is_empty(this->cur_pull_id) && *this->waiting_canceled)
+            throw tools::waiting_canceled(__FILE__, __LINE__, __func__);
 
-    if (this->is_empty(this->cur_pull_id) && *this->waiting_canceled)
-        throw tools::waiting_canceled(__FILE__, __LINE__, __func__);
+        // when the waiting has been canceled, the last batch can be incomplete (see 'flush_push()')
+        this->cur_pull_batch_len = *this->waiting_canceled
+                                     ? this->n_ready_slots(this->cur_pull_id, this->batch_size)
+                                     : this->batch_size;
+    } while (this->work_stealing ? !this->try_steal_pull()
+                                 : this->lock_free && !this->try_claim_pull(this->cur_pull_batch_len));
+
+    if (!this->lock_free) this->cur_pull_slot = (*this->first)[this->cur_pull_id].value;
+    if (collect_stats) this->update_depth_pull_stats(this->cur_pull_id, stalled);
+    this->cur_pull_tag = (*this->tags)[this->cur_pull_id * this->buffer_size + this->cur_pull_slot];
 }
 
 void*
@@ -334,7 +759,7 @@ Adaptor_m_to_n::get_empty_buffer(const size_t sid)
         throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
     }
 #endif
-    return (void*)(*this->buffer)[this->cur_push_id][sid][(*this->last)[this->cur_push_id]];
+    return (void*)(*this->buffer)[this->cur_push_id][sid][this->cur_push_slot];
 }
 
 void*
@@ -348,7 +773,8 @@ Adaptor_m_to_n::get_filled_buffer(const size_t sid)
         throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
     }
 #endif
-    return (void*)(*this->buffer)[this->cur_pull_id][sid][(*this->first)[this->cur_pull_id]];
+    if (this->reorder_window) return (void*)this->window_buffers[this->cur_window_id][sid];
+    return (void*)(*this->buffer)[this->cur_pull_id][sid][this->cur_pull_slot];
 }
 
 void*
@@ -362,8 +788,8 @@ Adaptor_m_to_n::get_empty_buffer(const size_t sid, void* swap_buffer)
         throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
     }
 #endif
-    void* empty_buffer = (void*)(*this->buffer)[this->cur_push_id][sid][(*this->last)[this->cur_push_id]];
-    (*this->buffer)[this->cur_push_id][sid][(*this->last)[this->cur_push_id]] = (int8_t*)swap_buffer;
+    void* empty_buffer = (void*)(*this->buffer)[this->cur_push_id][sid][this->cur_push_slot];
+    (*this->buffer)[this->cur_push_id][sid][this->cur_push_slot] = (int8_t*)swap_buffer;
     return empty_buffer;
 }
 
@@ -378,61 +804,155 @@ Adaptor_m_to_n::get_filled_buffer(const size_t sid, void* swap_buffer)
         throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
     }
 #endif
-    void* filled_buffer = (void*)(*this->buffer)[this->cur_pull_id][sid][(*this->first)[this->cur_pull_id]];
-    (*this->buffer)[this->cur_pull_id][sid][(*this->first)[this->cur_pull_id]] = (int8_t*)swap_buffer;
+    if (this->reorder_window)
+    {
+        void* filled_buffer = (void*)this->window_buffers[this->cur_window_id][sid];
+        this->window_buffers[this->cur_window_id][sid] = (int8_t*)swap_buffer;
+        return filled_buffer;
+    }
+    void* filled_buffer = (void*)(*this->buffer)[this->cur_pull_id][sid][this->cur_pull_slot];
+    (*this->buffer)[this->cur_pull_id][sid][this->cur_pull_slot] = (int8_t*)swap_buffer;
     return filled_buffer;
 }
 
 void
 Adaptor_m_to_n::wake_up_puller()
 {
-    (*this->last)[this->cur_push_id] = ((*this->last)[this->cur_push_id] + 1) % this->buffer_size;
-    (*this->counter)[this->cur_push_id]--; // atomic fetch sub
+    // the slots are published to the puller once the batch is complete
+    if (++this->cur_push_batch < this->batch_size) return;
+    this->flush_push();
+}
 
-    if (!this->active_waiting) // passive waiting
+void
+Adaptor_m_to_n::flush_push()
+{
+    const size_t n = this->cur_push_batch;
+    if (n == 0) return;
+
+    if (this->lock_free)
     {
-        if (!this->is_empty(this->cur_push_id))
+        // publish the slots to the puller, in order
+        const size_t offset = this->cur_push_id * this->buffer_size;
+        for (size_t pos = this->cur_push_pos + 1 - n; pos <= this->cur_push_pos; pos++)
+            (*this->ring_seq)[offset + pos % this->buffer_size].value.store(2 * pos + 1, std::memory_order_release);
+
+        // in work-stealing mode, all the pullers wait on the first sub-buffer (see 'pull_wait_id()')
+        const size_t wait_id = this->work_stealing ? 0 : this->cur_push_id;
+        if (this->is_hybrid_waiting())
+            (*this->park_pull)[wait_id].value.unpark();
+        else if (!this->active_waiting) // passive waiting
         {
-            std::lock_guard<std::mutex> lock((*this->mtx_pull.get())[this->cur_push_id]);
-            (*this->cnd_pull.get())[this->cur_push_id].notify_one();
+            std::lock_guard<std::mutex> lock((*this->mtx_pull)[wait_id].value);
+            (*this->cnd_pull)[wait_id].value.notify_one();
         }
     }
+    else
+    {
+        (*this->last)[this->cur_push_id].value = ((*this->last)[this->cur_push_id].value + n) % this->buffer_size;
+        (*this->counter)[this->cur_push_id].value -= (uint32_t)n; // atomic fetch sub
 
+        if (this->is_hybrid_waiting())
+            (*this->park_pull)[this->cur_push_id].value.unpark();
+        else if (!this->active_waiting) // passive waiting
+        {
+            if (!this->is_empty(this->cur_push_id))
+            {
+                std::lock_guard<std::mutex> lock((*this->mtx_pull)[this->cur_push_id].value);
+                (*this->cnd_pull)[this->cur_push_id].value.notify_one();
+            }
+        }
+    }
+
+    this->cur_push_batch = 0;
     this->cur_push_id = (this->cur_push_id + *this->n_pushers) % this->buffer->size();
 }
 
 void
 Adaptor_m_to_n::wake_up_pusher()
 {
-    (*this->first)[this->cur_pull_id] = ((*this->first)[this->cur_pull_id] + 1) % this->buffer_size;
-    (*this->counter)[this->cur_pull_id]++; // atomic fetch add
+    if (!this->reorder_window)
+    {
+        this->_wake_up_pusher();
+        return;
+    }
 
-    if (!this->active_waiting) // passive waiting
+    // the slot has already been given back to the pusher (see 'wait_pull()'), only the window entry is released
+    const uint64_t tag = this->window_tags[this->cur_window_id];
+    if (tag < this->next_pull_tag)
+        this->n_late_frames++;
+    else
+        this->next_pull_tag = tag + 1;
+    this->window_filled[this->cur_window_id] = false;
+    this->window_n_filled--;
+}
+
+void
+Adaptor_m_to_n::_wake_up_pusher()
+{
+    // the slots are given back to the pusher once the batch is complete
+    if (++this->cur_pull_batch < this->cur_pull_batch_len) return;
+    const size_t n = this->cur_pull_batch;
+
+    if (this->lock_free)
+    {
+        // give the slots back to the pusher for its next lap, in order
+        const size_t offset = this->cur_pull_id * this->buffer_size;
+        for (size_t pos = this->cur_pull_pos + 1 - n; pos <= this->cur_pull_pos; pos++)
+            (*this->ring_seq)[offset + pos % this->buffer_size].value.store(2 * (pos + this->buffer_size),
+                                                                             std::memory_order_release);
+
+        if (this->is_hybrid_waiting())
+            (*this->park_push)[this->cur_pull_id].value.unpark();
+        else if (!this->active_waiting) // passive waiting
+        {
+            std::lock_guard<std::mutex> lock((*this->mtx_push)[this->cur_pull_id].value);
+            (*this->cnd_push)[this->cur_pull_id].value.notify_one();
+        }
+    }
+    else
     {
-        if (!this->is_full(this->cur_pull_id))
+        (*this->first)[this->cur_pull_id].value = ((*this->first)[this->cur_pull_id].value + n) % this->buffer_size;
+        (*this->counter)[this->cur_pull_id].value += (uint32_t)n; // atomic fetch add
+
+        if (this->is_hybrid_waiting())
+            (*this->park_push)[this->cur_pull_id].value.unpark();
+        else if (!this->active_waiting) // passive waiting
         {
-            std::lock_guard<std::mutex> lock((*this->mtx_push.get())[this->cur_pull_id]);
-            (*this->cnd_push.get())[this->cur_pull_id].notify_one();
+            if (!this->is_full(this->cur_pull_id))
+            {
+                std::lock_guard<std::mutex> lock((*this->mtx_push)[this->cur_pull_id].value);
+                (*this->cnd_push)[this->cur_pull_id].value.notify_one();
+            }
         }
     }
 
-    this->cur_pull_id = (this->cur_pull_id + *this->n_pullers) % this->buffer->size();
+    this->cur_pull_batch = 0;
+    this->cur_pull_home_id = (this->cur_pull_home_id + *this->n_pullers) % this->buffer->size();
+    this->cur_pull_id = this->cur_pull_home_id;
 }
 
 void
 Adaptor_m_to_n::wake_up()
 {
-    if (!this->active_waiting) // passive waiting
+    if (this->is_hybrid_waiting())
+    {
+        for (size_t i = 0; i < this->buffer->size(); i++)
+        {
+            (*this->park_push)[i].value.unpark();
+            (*this->park_pull)[i].value.unpark();
+        }
+    }
+    else if (!this->active_waiting) // passive waiting
     {
         for (size_t i = 0; i < this->buffer->size(); i++)
         {
-            std::unique_lock<std::mutex> lock((*this->mtx_push.get())[i]);
-            (*this->cnd_push.get())[i].notify_all();
+            std::unique_lock<std::mutex> lock((*this->mtx_push)[i].value);
+            (*this->cnd_push)[i].value.notify_all();
         }
         for (size_t i = 0; i < this->buffer->size(); i++)
         {
-            std::unique_lock<std::mutex> lock((*this->mtx_pull.get())[i]);
-            (*this->cnd_pull.get())[i].notify_all();
+            std::unique_lock<std::mutex> lock((*this->mtx_pull)[i].value);
+            (*this->cnd_pull)[i].value.notify_all();
         }
     }
 }
@@ -11,7 +11,7 @@ Delayer<D>::Delayer(const size_t size, const D init_val)
   : Stateful()
   , size(size)
   , init_val(init_val)
-  , data(this->size * this->n_frames, init_val)
+  , data(std::vector<D>(this->size * this->n_frames, init_val))
 {
     const std::string name = "Delayer";
     this->set_name(name);
@@ -63,14 +63,15 @@ template<typename D>
 void
 Delayer<D>::_memorize(const D* in, const size_t frame_id)
 {
-    std::copy(in, in + this->size, this->data.data() + this->size * frame_id);
+    std::copy(in, in + this->size, this->data.get_mut().data() + this->size * frame_id);
 }
 
 template<typename D>
 void
 Delayer<D>::_produce(D* out, const size_t frame_id)
 {
-    std::copy(this->data.data() + this->size * (frame_id + 0), this->data.data() + this->size * (frame_id + 1), out);
+    const auto& data = this->data.get();
+    std::copy(data.data() + this->size * (frame_id + 0), data.data() + this->size * (frame_id + 1), out);
 }
 
 template<typename D>
@@ -82,9 +83,9 @@ Delayer<D>::set_n_frames(const size_t n_frames)
     {
         Module::set_n_frames(n_frames);
 
-        const auto old_data_size = this->data.size();
+        const auto old_data_size = this->data.get().size();
         const auto new_data_size = (old_data_size / old_n_frames) * n_frames;
-        this->data.resize(new_data_size, this->init_val);
+        this->data.get_mut().resize(new_data_size, this->init_val);
     }
 }
 
@@ -92,21 +93,23 @@ template<typename D>
 void
 Delayer<D>::set_data(const std::vector<D>& init)
 {
-    if (init.size() < this->data.size())
+    if (init.size() < this->data.get().size())
     {
         std::stringstream message;
         message << "'init.size()' has to be greater than data.size() ('init.size(' = " << init.size()
-                << ", 'data.size()' = " << this->data.size() << ").";
+                << ", 'data.size()' = " << this->data.get().size() << ").";
         throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
     }
-    std::copy(init.begin(), init.begin() + this->data.size(), this->data.begin());
+    auto& data = this->data.get_mut();
+    std::copy(init.begin(), init.begin() + data.size(), data.begin());
 }
 
 template<typename D>
 void
 Delayer<D>::set_data(const D* init)
 {
-    std::copy(init, init + this->data.size(), this->data.begin());
+    auto& data = this->data.get_mut();
+    std::copy(init, init + data.size(), data.begin());
 }
 
 // ==================================================================================== explicit template instantiation
@@ -12,7 +12,7 @@ using namespace spu::module;
 template<typename T>
 Initializer<T>::Initializer(const size_t n_elmts, const size_t ns)
   : Stateful()
-  , init_data(this->get_n_frames(), std::vector<T>(n_elmts, 0))
+  , init_data(std::vector<std::vector<T>>(this->get_n_frames(), std::vector<T>(n_elmts, 0)))
   , ns(ns)
 {
     const std::string name = "Initializer";
@@ -64,22 +64,22 @@ template<typename T>
 const std::vector<std::vector<T>>&
 Initializer<T>::get_init_data() const
 {
-    return this->init_data;
+    return this->init_data.get();
 }
 
 template<typename T>
 void
 Initializer<T>::set_init_data(const std::vector<T>& init_data)
 {
-    if (init_data.size() != this->init_data[0].size())
+    if (init_data.size() != this->init_data.get()[0].size())
     {
         std::stringstream message;
         message << "'init_data.size()' has to be equal to 'this->init_data[0].size()' ('init_data.size()' = "
-                << init_data.size() << ", 'this->init_data[0].size()' = " << this->init_data[0].size() << ").";
+                << init_data.size() << ", 'this->init_data[0].size()' = " << this->init_data.get()[0].size() << ").";
         throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
     }
 
-    for (auto& ini : this->init_data)
+    for (auto& ini : this->init_data.get_mut())
         ini = init_data;
 }
 
@@ -96,24 +96,25 @@ Initializer<T>::set_init_data(const std::vector<std::vector<T>>& init_data)
     }
 
     for (size_t f = 0; f < init_data.size(); f++)
-    {
-        if (init_data[f].size() != this->init_data[f].size())
+        if (init_data[f].size() != this->init_data.get()[f].size())
         {
             std::stringstream message;
             message << "'init_data[f].size()' has to be equal to 'this->init_data[f].size()' ('init_data[f].size()' = "
-                    << init_data[f].size() << ", 'this->init_data[f].size()' = " << this->init_data[f].size()
+                    << init_data[f].size() << ", 'this->init_data[f].size()' = " << this->init_data.get()[f].size()
                     << ", 'f' = " << f << ").";
             throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
         }
-        this->init_data[f] = init_data[f];
-    }
+
+    auto& cur_init_data = this->init_data.get_mut();
+    for (size_t f = 0; f < init_data.size(); f++)
+        cur_init_data[f] = init_data[f];
 }
 
 template<typename T>
 void
 Initializer<T>::set_init_data(const T val)
 {
-    for (auto& ini : this->init_data)
+    for (auto& ini : this->init_data.get_mut())
         std::fill(ini.begin(), ini.end(), val);
 }
 
@@ -126,9 +127,10 @@ Initializer<T>::set_n_frames(const size_t n_frames)
     {
         Module::set_n_frames(n_frames);
 
-        this->init_data.resize(n_frames);
+        auto& init_data = this->init_data.get_mut();
+        init_data.resize(n_frames);
         for (size_t f = old_n_frames; f < n_frames; f++)
-            this->init_data[f] = this->init_data[0];
+            init_data[f] = init_data[0];
     }
 }
 
@@ -147,7 +149,8 @@ Initializer<T>::_initialize(T* out, const size_t frame_id)
     std::chrono::time_point<std::chrono::steady_clock> t_start;
     if (this->ns) t_start = std::chrono::steady_clock::now();
 
-    std::copy(this->init_data[frame_id].begin(), this->init_data[frame_id].end(), out);
+    const auto& ini = this->init_data.get()[frame_id];
+    std::copy(ini.begin(), ini.end(), out);
 
     if (this->ns)
     {
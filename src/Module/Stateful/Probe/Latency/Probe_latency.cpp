@@ -9,7 +9,7 @@ using namespace spu::module;
 
 Probe_latency::Probe_latency(const std::string& col_name, tools::Reporter_probe* reporter)
   : Probe<uint8_t>(0, col_name)
-  , t_start(std::chrono::steady_clock::now())
+  , t_start(tools::Clock::now())
 {
     const std::string name = "Probe_latency<" + col_name + ">";
     this->set_name(name);
@@ -35,7 +35,7 @@ Probe_latency::register_reporter(tools::Reporter_probe* reporter)
 void
 Probe_latency::_probe(const uint8_t* in, const size_t frame_id)
 {
-    auto t_stop = std::chrono::steady_clock::now();
+    auto t_stop = tools::Clock::now();
     auto time_duration = (int64_t)std::chrono::duration_cast<std::chrono::microseconds>(t_stop - this->t_start).count();
     this->t_start = t_stop;
 
@@ -46,5 +46,5 @@ Probe_latency::_probe(const uint8_t* in, const size_t frame_id)
 void
 Probe_latency::reset()
 {
-    this->t_start = std::chrono::steady_clock::now();
+    this->t_start = tools::Clock::now();
 }
@@ -12,7 +12,7 @@ Probe_throughput::Probe_throughput(const size_t data_size,
                                    const double factor,
                                    tools::Reporter_probe* reporter)
   : Probe<uint8_t>(0, col_name)
-  , t_start(std::chrono::steady_clock::now())
+  , t_start(tools::Clock::now())
   , data_size(data_size)
   , thr(0.)
   , factor(factor)
@@ -51,7 +51,7 @@ Probe_throughput::register_reporter(tools::Reporter_probe* reporter)
 void
 Probe_throughput::_probe(const uint8_t* in, const size_t frame_id)
 {
-    auto t_stop = std::chrono::steady_clock::now();
+    auto t_stop = tools::Clock::now();
     auto time_duration = (double)std::chrono::duration_cast<std::chrono::microseconds>(t_stop - this->t_start).count();
     this->thr = ((double)(this->data_size * this->get_n_frames()) / (this->factor)) / (time_duration * 1e-6);
     this->t_start = t_stop;
@@ -63,6 +63,6 @@ Probe_throughput::_probe(const uint8_t* in, const size_t frame_id)
 void
 Probe_throughput::reset()
 {
-    this->t_start = std::chrono::steady_clock::now();
+    this->t_start = tools::Clock::now();
     this->thr = 0.;
 }
@@ -9,7 +9,7 @@ using namespace spu::module;
 
 Probe_time::Probe_time(const std::string& col_name, tools::Reporter_probe* reporter)
   : Probe<uint8_t>(0, col_name)
-  , t_start(std::chrono::steady_clock::now())
+  , t_start(tools::Clock::now())
 {
     const std::string name = "Probe_time<" + col_name + ">";
     this->set_name(name);
@@ -35,7 +35,7 @@ Probe_time::register_reporter(tools::Reporter_probe* reporter)
 void
 Probe_time::_probe(const uint8_t* in, const size_t frame_id)
 {
-    auto t_stop = std::chrono::steady_clock::now();
+    auto t_stop = tools::Clock::now();
     auto time_duration = (double)std::chrono::duration_cast<std::chrono::microseconds>(t_stop - this->t_start).count();
     auto time_duration_sec = time_duration * 1e-6;
 
@@ -46,5 +46,5 @@ Probe_time::_probe(const uint8_t* in, const size_t frame_id)
 void
 Probe_time::reset()
 {
-    this->t_start = std::chrono::steady_clock::now();
+    this->t_start = tools::Clock::now();
 }
@@ -43,9 +43,8 @@ Source_user<B>::Source_user(const int max_data_size,
             throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
         }
 
-        this->source.resize(n_src);
-        for (auto i = 0; i < n_src; i++)
-            this->source[i].resize(src_size);
+        auto source = new std::vector<std::vector<B>>(n_src, std::vector<B>(src_size));
+        this->source.reset(source);
 
         if (src_size == this->max_data_size)
         {
@@ -55,7 +54,7 @@ Source_user<B>::Source_user(const int max_data_size,
                     int bit;
                     file >> bit;
 
-                    this->source[i][j] = bit != 0;
+                    (*source)[i][j] = bit != 0;
                 }
         }
         else
@@ -72,7 +71,7 @@ Source_user<B>::Source_user(const int max_data_size,
     else
         throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Can't open '" + filename + "' file.");
 
-    this->next_frame_idx %= (int)source.size();
+    this->next_frame_idx %= (int)this->source->size();
 }
 
 template<typename B>
@@ -110,13 +109,14 @@ template<typename B>
 void
 Source_user<B>::_generate(B* out_data, const size_t frame_id)
 {
-    std::copy(this->source[this->next_frame_idx].begin(), this->source[this->next_frame_idx].end(), out_data);
+    const auto& source = *this->source;
+    std::copy(source[this->next_frame_idx].begin(), source[this->next_frame_idx].end(), out_data);
 
-    this->next_frame_idx = (this->next_frame_idx + 1) % (int)this->source.size();
+    this->next_frame_idx = (this->next_frame_idx + 1) % (int)source.size();
 
     if (this->auto_reset == false)
     {
-        this->src_counter = (this->src_counter + 1) % (int)this->source.size();
+        this->src_counter = (this->src_counter + 1) % (int)source.size();
         if (this->src_counter == 0) this->done = true;
     }
 }
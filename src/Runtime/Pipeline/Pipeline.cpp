@@ -70,7 +70,13 @@ Pipeline
            const std::vector<size_t> &synchro_buffer_sizes,
            const std::vector<bool> &synchro_active_waiting,
            const std::vector<bool> &thread_pinning,
-           const std::vector<std::vector<size_t>> &puids/*,
+           const std::vector<std::vector<size_t>> &puids,
+           const std::vector<bool> &synchro_lock_free,
+           const std::vector<size_t> &synchro_spin_budgets,
+           const std::vector<size_t> &synchro_batch_sizes,
+           const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds,
+           const std::vector<bool> &synchro_work_stealing,
+           const std::vector<size_t> &synchro_reorder_windows/*,
            const std::vector<bool> &tasks_inplace*/)
 : original_sequence(firsts, lasts, 1),
   stages(sep_stages.size()),
@@ -81,8 +87,8 @@ Pipeline
   auto_stop(true)
 {
     this->init<runtime::Task>(
-      firsts, lasts, sep_stages, n_threads, synchro_buffer_sizes, synchro_active_waiting, thread_pinning, puids
-      /*, tasks_inplace*/);
+      firsts, lasts, sep_stages, n_threads, synchro_buffer_sizes, synchro_active_waiting, thread_pinning, puids,
+      "", synchro_lock_free, synchro_spin_budgets, synchro_batch_sizes, synchro_buffer_size_bounds, synchro_work_stealing, synchro_reorder_windows/*, tasks_inplace*/);
 }
 
 Pipeline
@@ -93,7 +99,13 @@ Pipeline
            const std::vector<size_t> &synchro_buffer_sizes,
            const std::vector<bool> &synchro_active_waiting,
            const std::vector<bool> &thread_pinning,
-           const std::vector<std::vector<size_t>> &puids/*,
+           const std::vector<std::vector<size_t>> &puids,
+           const std::vector<bool> &synchro_lock_free,
+           const std::vector<size_t> &synchro_spin_budgets,
+           const std::vector<size_t> &synchro_batch_sizes,
+           const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds,
+           const std::vector<bool> &synchro_work_stealing,
+           const std::vector<size_t> &synchro_reorder_windows/*,
            const std::vector<bool> &tasks_inplace*/)
 : original_sequence(firsts, lasts, 1),
   stages(sep_stages.size()),
@@ -114,7 +126,7 @@ Pipeline
 	                          n_threads,
 	                          synchro_buffer_sizes,
 	                          synchro_active_waiting,
-	                          thread_pinning, puids/*,
+	                          thread_pinning, puids, "", synchro_lock_free, synchro_spin_budgets, synchro_batch_sizes, synchro_buffer_size_bounds, synchro_work_stealing, synchro_reorder_windows/*,
 	                          tasks_inplace*/);
 }
 
@@ -125,7 +137,13 @@ Pipeline
            const std::vector<size_t> &synchro_buffer_sizes,
            const std::vector<bool> &synchro_active_waiting,
            const std::vector<bool> &thread_pinning,
-           const std::vector<std::vector<size_t>> &puids/*,
+           const std::vector<std::vector<size_t>> &puids,
+           const std::vector<bool> &synchro_lock_free,
+           const std::vector<size_t> &synchro_spin_budgets,
+           const std::vector<size_t> &synchro_batch_sizes,
+           const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds,
+           const std::vector<bool> &synchro_work_stealing,
+           const std::vector<size_t> &synchro_reorder_windows/*,
            const std::vector<bool> &tasks_inplace*/)
 : Pipeline(firsts,
            {},
@@ -133,7 +151,7 @@ Pipeline
            n_threads,
            synchro_buffer_sizes,
            synchro_active_waiting,
-           thread_pinning, puids/*,
+           thread_pinning, puids, synchro_lock_free, synchro_spin_budgets, synchro_batch_sizes, synchro_buffer_size_bounds, synchro_work_stealing, synchro_reorder_windows/*,
            tasks_inplace*/)
 {
 }
@@ -145,7 +163,13 @@ Pipeline
            const std::vector<size_t> &synchro_buffer_sizes,
            const std::vector<bool> &synchro_active_waiting,
            const std::vector<bool> &thread_pinning,
-           const std::vector<std::vector<size_t>> &puids/*,
+           const std::vector<std::vector<size_t>> &puids,
+           const std::vector<bool> &synchro_lock_free,
+           const std::vector<size_t> &synchro_spin_budgets,
+           const std::vector<size_t> &synchro_batch_sizes,
+           const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds,
+           const std::vector<bool> &synchro_work_stealing,
+           const std::vector<size_t> &synchro_reorder_windows/*,
            const std::vector<bool> &tasks_inplace*/)
 : Pipeline(firsts,
            {},
@@ -153,7 +177,7 @@ Pipeline
            n_threads,
            synchro_buffer_sizes,
            synchro_active_waiting,
-           thread_pinning, puids/*,
+           thread_pinning, puids, synchro_lock_free, synchro_spin_budgets, synchro_batch_sizes, synchro_buffer_size_bounds, synchro_work_stealing, synchro_reorder_windows/*,
            tasks_inplace*/)
 {
 }
@@ -166,7 +190,13 @@ Pipeline
            const std::vector<size_t> &synchro_buffer_sizes,
            const std::vector<bool> &synchro_active_waiting,
            const std::vector<bool> &thread_pinning,
-           const std::vector<std::vector<size_t>> &puids/*,
+           const std::vector<std::vector<size_t>> &puids,
+           const std::vector<bool> &synchro_lock_free,
+           const std::vector<size_t> &synchro_spin_budgets,
+           const std::vector<size_t> &synchro_batch_sizes,
+           const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds,
+           const std::vector<bool> &synchro_work_stealing,
+           const std::vector<size_t> &synchro_reorder_windows/*,
            const std::vector<bool> &tasks_inplace*/)
 : Pipeline({&first},
            {&last},
@@ -174,7 +204,7 @@ Pipeline
            n_threads,
            synchro_buffer_sizes,
            synchro_active_waiting,
-           thread_pinning, puids/*,
+           thread_pinning, puids, synchro_lock_free, synchro_spin_budgets, synchro_batch_sizes, synchro_buffer_size_bounds, synchro_work_stealing, synchro_reorder_windows/*,
            tasks_inplace*/)
 {
 }
@@ -186,14 +216,20 @@ Pipeline
            const std::vector<size_t> &synchro_buffer_sizes,
            const std::vector<bool> &synchro_active_waiting,
            const std::vector<bool> &thread_pinning,
-           const std::vector<std::vector<size_t>> &puids/*,
+           const std::vector<std::vector<size_t>> &puids,
+           const std::vector<bool> &synchro_lock_free,
+           const std::vector<size_t> &synchro_spin_budgets,
+           const std::vector<size_t> &synchro_batch_sizes,
+           const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds,
+           const std::vector<bool> &synchro_work_stealing,
+           const std::vector<size_t> &synchro_reorder_windows/*,
            const std::vector<bool> &tasks_inplace*/)
 : Pipeline({&first},
            sep_stages,
            n_threads,
            synchro_buffer_sizes,
            synchro_active_waiting,
-           thread_pinning, puids/*,
+           thread_pinning, puids, synchro_lock_free, synchro_spin_budgets, synchro_batch_sizes, synchro_buffer_size_bounds, synchro_work_stealing, synchro_reorder_windows/*,
            tasks_inplace*/)
 {
 }
@@ -207,7 +243,13 @@ Pipeline
            const std::vector<size_t> &synchro_buffer_sizes,
            const std::vector<bool> &synchro_active_waiting,
            const std::vector<bool> &thread_pinning,
-           const std::string &pipeline_pinning_policy/*,
+           const std::string &pipeline_pinning_policy,
+           const std::vector<bool> &synchro_lock_free,
+           const std::vector<size_t> &synchro_spin_budgets,
+           const std::vector<size_t> &synchro_batch_sizes,
+           const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds,
+           const std::vector<bool> &synchro_work_stealing,
+           const std::vector<size_t> &synchro_reorder_windows/*,
            const std::vector<bool> &tasks_inplace*/)
 : original_sequence(firsts, lasts, 1),
   stages(sep_stages.size()),
@@ -223,7 +265,7 @@ Pipeline
 	                          n_threads,
 	                          synchro_buffer_sizes,
 	                          synchro_active_waiting,
-	                          thread_pinning, {}, pipeline_pinning_policy/*,
+	                          thread_pinning, {}, pipeline_pinning_policy, synchro_lock_free, synchro_spin_budgets, synchro_batch_sizes, synchro_buffer_size_bounds, synchro_work_stealing, synchro_reorder_windows/*,
 	                          tasks_inplace*/);
 }
 
@@ -235,7 +277,13 @@ Pipeline
            const std::vector<size_t> &synchro_buffer_sizes,
            const std::vector<bool> &synchro_active_waiting,
            const std::vector<bool> &thread_pinning,
-           const std::string &pipeline_pinning_policy/*,
+           const std::string &pipeline_pinning_policy,
+           const std::vector<bool> &synchro_lock_free,
+           const std::vector<size_t> &synchro_spin_budgets,
+           const std::vector<size_t> &synchro_batch_sizes,
+           const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds,
+           const std::vector<bool> &synchro_work_stealing,
+           const std::vector<size_t> &synchro_reorder_windows/*,
            const std::vector<bool> &tasks_inplace*/)
 : original_sequence(firsts, lasts, 1),
   stages(sep_stages.size()),
@@ -256,7 +304,7 @@ Pipeline
 	                          n_threads,
 	                          synchro_buffer_sizes,
 	                          synchro_active_waiting,
-	                          thread_pinning, {}, pipeline_pinning_policy/*,
+	                          thread_pinning, {}, pipeline_pinning_policy, synchro_lock_free, synchro_spin_budgets, synchro_batch_sizes, synchro_buffer_size_bounds, synchro_work_stealing, synchro_reorder_windows/*,
 	                          tasks_inplace*/);
 }
 
@@ -267,7 +315,13 @@ Pipeline
            const std::vector<size_t> &synchro_buffer_sizes,
            const std::vector<bool> &synchro_active_waiting,
            const std::vector<bool> &thread_pinning,
-           const std::string &pipeline_pinning_policy/*,
+           const std::string &pipeline_pinning_policy,
+           const std::vector<bool> &synchro_lock_free,
+           const std::vector<size_t> &synchro_spin_budgets,
+           const std::vector<size_t> &synchro_batch_sizes,
+           const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds,
+           const std::vector<bool> &synchro_work_stealing,
+           const std::vector<size_t> &synchro_reorder_windows/*,
            const std::vector<bool> &tasks_inplace*/)
 : Pipeline(firsts,
            {},
@@ -275,7 +329,7 @@ Pipeline
            n_threads,
            synchro_buffer_sizes,
            synchro_active_waiting,
-           thread_pinning, pipeline_pinning_policy/*,
+           thread_pinning, pipeline_pinning_policy, synchro_lock_free, synchro_spin_budgets, synchro_batch_sizes, synchro_buffer_size_bounds, synchro_work_stealing, synchro_reorder_windows/*,
            tasks_inplace*/)
 {
 }
@@ -287,7 +341,13 @@ Pipeline
            const std::vector<size_t> &synchro_buffer_sizes,
            const std::vector<bool> &synchro_active_waiting,
            const std::vector<bool> &thread_pinning,
-           const std::string &pipeline_pinning_policy/*,
+           const std::string &pipeline_pinning_policy,
+           const std::vector<bool> &synchro_lock_free,
+           const std::vector<size_t> &synchro_spin_budgets,
+           const std::vector<size_t> &synchro_batch_sizes,
+           const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds,
+           const std::vector<bool> &synchro_work_stealing,
+           const std::vector<size_t> &synchro_reorder_windows/*,
            const std::vector<bool> &tasks_inplace*/)
 : Pipeline(firsts,
            {},
@@ -295,7 +355,7 @@ Pipeline
            n_threads,
            synchro_buffer_sizes,
            synchro_active_waiting,
-           thread_pinning, pipeline_pinning_policy/*,
+           thread_pinning, pipeline_pinning_policy, synchro_lock_free, synchro_spin_budgets, synchro_batch_sizes, synchro_buffer_size_bounds, synchro_work_stealing, synchro_reorder_windows/*,
            tasks_inplace*/)
 {
 }
@@ -308,7 +368,13 @@ Pipeline
            const std::vector<size_t> &synchro_buffer_sizes,
            const std::vector<bool> &synchro_active_waiting,
            const std::vector<bool> &thread_pinning,
-           const std::string &pipeline_pinning_policy/*,
+           const std::string &pipeline_pinning_policy,
+           const std::vector<bool> &synchro_lock_free,
+           const std::vector<size_t> &synchro_spin_budgets,
+           const std::vector<size_t> &synchro_batch_sizes,
+           const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds,
+           const std::vector<bool> &synchro_work_stealing,
+           const std::vector<size_t> &synchro_reorder_windows/*,
            const std::vector<bool> &tasks_inplace*/)
 : Pipeline({&first},
            {&last},
@@ -316,7 +382,7 @@ Pipeline
            n_threads,
            synchro_buffer_sizes,
            synchro_active_waiting,
-           thread_pinning, pipeline_pinning_policy/*,
+           thread_pinning, pipeline_pinning_policy, synchro_lock_free, synchro_spin_budgets, synchro_batch_sizes, synchro_buffer_size_bounds, synchro_work_stealing, synchro_reorder_windows/*,
            tasks_inplace*/)
 {
 }
@@ -328,7 +394,13 @@ Pipeline
            const std::vector<size_t> &synchro_buffer_sizes,
            const std::vector<bool> &synchro_active_waiting,
            const std::vector<bool> &thread_pinning,
-           const std::string &pipeline_pinning_policy/*,
+           const std::string &pipeline_pinning_policy,
+           const std::vector<bool> &synchro_lock_free,
+           const std::vector<size_t> &synchro_spin_budgets,
+           const std::vector<size_t> &synchro_batch_sizes,
+           const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds,
+           const std::vector<bool> &synchro_work_stealing,
+           const std::vector<size_t> &synchro_reorder_windows/*,
            const std::vector<bool> &tasks_inplace*/)
 : Pipeline({&first},
            sep_stages,
@@ -336,7 +408,8 @@ Pipeline
            synchro_buffer_sizes,
            synchro_active_waiting,
            thread_pinning,
-           pipeline_pinning_policy/*,
+           pipeline_pinning_policy,
+           synchro_lock_free, synchro_spin_budgets, synchro_batch_sizes, synchro_buffer_size_bounds, synchro_work_stealing, synchro_reorder_windows/*,
            tasks_inplace*/)
 {
 }
@@ -452,7 +525,13 @@ void Pipeline
        const std::vector<bool> &synchro_active_waiting,
        const std::vector<bool> &thread_pinning,
        const std::vector<std::vector<size_t>> &puids,
-       const std::string &pipeline_pinning_policy/*,
+       const std::string &pipeline_pinning_policy,
+       const std::vector<bool> &synchro_lock_free,
+       const std::vector<size_t> &synchro_spin_budgets,
+       const std::vector<size_t> &synchro_batch_sizes,
+       const std::vector<std::pair<size_t, size_t>> &synchro_buffer_size_bounds,
+       const std::vector<bool> &synchro_work_stealing,
+       const std::vector<size_t> &synchro_reorder_windows/*,
        const std::vector<bool> &tasks_inplace*/)
 {
     if (sep_stages.size() != n_threads.size() && n_threads.size() != 0)
@@ -481,6 +560,103 @@ void Pipeline
         throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
     }
 
+    if (sep_stages.size() != synchro_lock_free.size() + 1 && synchro_lock_free.size() != 0)
+    {
+        std::stringstream message;
+        message << "'synchro_lock_free.size()' has to be equal to 'sep_stages.size() -1' or equal to '0' "
+                << "('synchro_lock_free.size()' = " << synchro_lock_free.size()
+                << " , 'sep_stages.size()' = " << sep_stages.size() << ").";
+        throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (sep_stages.size() != synchro_spin_budgets.size() + 1 && synchro_spin_budgets.size() != 0)
+    {
+        std::stringstream message;
+        message << "'synchro_spin_budgets.size()' has to be equal to 'sep_stages.size() -1' or equal to '0' "
+                << "('synchro_spin_budgets.size()' = " << synchro_spin_budgets.size()
+                << " , 'sep_stages.size()' = " << sep_stages.size() << ").";
+        throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (sep_stages.size() != synchro_batch_sizes.size() + 1 && synchro_batch_sizes.size() != 0)
+    {
+        std::stringstream message;
+        message << "'synchro_batch_sizes.size()' has to be equal to 'sep_stages.size() -1' or equal to '0' "
+                << "('synchro_batch_sizes.size()' = " << synchro_batch_sizes.size()
+                << " , 'sep_stages.size()' = " << sep_stages.size() << ").";
+        throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (sep_stages.size() != synchro_buffer_size_bounds.size() + 1 && synchro_buffer_size_bounds.size() != 0)
+    {
+        std::stringstream message;
+        message << "'synchro_buffer_size_bounds.size()' has to be equal to 'sep_stages.size() -1' or equal to '0' "
+                << "('synchro_buffer_size_bounds.size()' = " << synchro_buffer_size_bounds.size()
+                << " , 'sep_stages.size()' = " << sep_stages.size() << ").";
+        throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (sep_stages.size() != synchro_work_stealing.size() + 1 && synchro_work_stealing.size() != 0)
+    {
+        std::stringstream message;
+        message << "'synchro_work_stealing.size()' has to be equal to 'sep_stages.size() -1' or equal to '0' "
+                << "('synchro_work_stealing.size()' = " << synchro_work_stealing.size()
+                << ", 'sep_stages.size()' = " << sep_stages.size() << ").";
+        throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    // the frames are distributed to the threads of a stage by batches, the same batch size is required on the input
+    // and on the output synchros of a multi-threaded stage to preserve the frames order
+    for (size_t s = 1; s + 1 < sep_stages.size() && synchro_batch_sizes.size(); s++)
+    {
+        const size_t stage_n_threads = n_threads.size() ? n_threads[s] : 1;
+        if (stage_n_threads > 1 && synchro_batch_sizes[s - 1] != synchro_batch_sizes[s])
+        {
+            std::stringstream message;
+            message << "'synchro_batch_sizes[s -1]' has to be equal to 'synchro_batch_sizes[s]' when the stage 's' "
+                    << "is multi-threaded ('s' = " << s << ", 'n_threads[s]' = " << stage_n_threads
+                    << ", 'synchro_batch_sizes[s -1]' = " << synchro_batch_sizes[s - 1]
+                    << ", 'synchro_batch_sizes[s]' = " << synchro_batch_sizes[s] << ").";
+            throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+        }
+    }
+
+    if (sep_stages.size() != synchro_reorder_windows.size() + 1 && synchro_reorder_windows.size() != 0)
+    {
+        std::stringstream message;
+        message << "'synchro_reorder_windows.size()' has to be equal to 'sep_stages.size() -1' or equal to '0' "
+                << "('synchro_reorder_windows.size()' = " << synchro_reorder_windows.size()
+                << ", 'sep_stages.size()' = " << sep_stages.size() << ").";
+        throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    // the frames are reordered by the puller, a single thread is required after a reordering synchro
+    for (size_t s = 0; s < synchro_reorder_windows.size(); s++)
+    {
+        const size_t next_n_threads = n_threads.size() ? n_threads[s + 1] : 1;
+        if (synchro_reorder_windows[s] && next_n_threads > 1)
+        {
+            std::stringstream message;
+            message << "'n_threads[s +1]' has to be equal to 1 when 'synchro_reorder_windows[s]' is not 0 ('s' = " << s
+                    << ", 'n_threads[s +1]' = " << next_n_threads
+                    << ", 'synchro_reorder_windows[s]' = " << synchro_reorder_windows[s] << ").";
+            throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+        }
+    }
+
+    // the threads of a work-stealing stage do not process the same number of frames, the next stage has to pull the
+    // frames from any thread too (in any order)
+    for (size_t s = 1; s + 1 < sep_stages.size() && synchro_work_stealing.size(); s++)
+    {
+        if (synchro_work_stealing[s - 1] && !synchro_work_stealing[s])
+        {
+            std::stringstream message;
+            message << "'synchro_work_stealing[s]' has to be enabled when 'synchro_work_stealing[s -1]' is enabled ("
+                    << "'s' = " << s << ").";
+            throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+        }
+    }
+
     if (sep_stages.size() != thread_pinning.size() && thread_pinning.size() != 0)
     {
         std::stringstream message;
@@ -588,7 +764,14 @@ void Pipeline
         }
     }
 
-    this->create_adaptors(synchro_buffer_sizes, synchro_active_waiting);
+    this->create_adaptors(synchro_buffer_sizes,
+                          synchro_active_waiting,
+                          synchro_lock_free,
+                          synchro_spin_budgets,
+                          synchro_batch_sizes,
+                          synchro_buffer_size_bounds,
+                          synchro_work_stealing,
+                          synchro_reorder_windows);
     this->bind_adaptors();
 
     this->thread_pool.reset(new tools::Thread_pool_standard(this->stages.size() - 1));
@@ -597,7 +780,13 @@ void Pipeline
 
 void
 Pipeline::create_adaptors(const std::vector<size_t>& synchro_buffer_sizes,
-                          const std::vector<bool>& synchro_active_waiting)
+                          const std::vector<bool>& synchro_active_waiting,
+                          const std::vector<bool>& synchro_lock_free,
+                          const std::vector<size_t>& synchro_spin_budgets,
+                          const std::vector<size_t>& synchro_batch_sizes,
+                          const std::vector<std::pair<size_t, size_t>>& synchro_buffer_size_bounds,
+                          const std::vector<bool>& synchro_work_stealing,
+                          const std::vector<size_t>& synchro_reorder_windows)
 {
     //                     sck out addr     occ     stage   tsk id  sck id
     std::vector<std::tuple<runtime::Socket*, size_t, size_t, size_t, size_t>> out_sck_orphans;
@@ -867,6 +1056,17 @@ Pipeline::create_adaptors(const std::vector<size_t>& synchro_buffer_sizes,
             this->saved_firsts_tasks_id[sta] = this->stages[sta]->firsts_tasks_id;
             sck_orphan_binds_cpy = sck_orphan_binds_new;
 
+            // the synchronization buffers are placed on the NUMA nodes of the pinned threads that pull them
+            if (this->stages[sta]->is_thread_pinning())
+            {
+                std::vector<std::string> pull_placement(n_threads);
+                for (size_t t = 0; t < n_threads; t++)
+                    pull_placement[t] = this->stages[sta]->puids.empty()
+                                          ? this->stages[sta]->pin_objects_per_thread[t]
+                                          : "PU_" + std::to_string(this->stages[sta]->puids[t]);
+                adp->set_pull_placement(pull_placement);
+            }
+
             adp->alloc_buffers();
         }
 
@@ -880,6 +1080,13 @@ Pipeline::create_adaptors(const std::vector<size_t>& synchro_buffer_sizes,
             std::vector<std::type_index> adp_datatype;
             size_t adp_buffer_size = synchro_buffer_sizes.size() ? synchro_buffer_sizes[sta] : 1;
             bool adp_active_waiting = synchro_active_waiting.size() ? synchro_active_waiting[sta] : false;
+            bool adp_lock_free = synchro_lock_free.size() ? synchro_lock_free[sta] : false;
+            size_t adp_spin_budget = synchro_spin_budgets.size() ? synchro_spin_budgets[sta] : 0;
+            size_t adp_batch_size = synchro_batch_sizes.size() ? synchro_batch_sizes[sta] : 1;
+            size_t adp_buffer_size_min = synchro_buffer_size_bounds.size() ? synchro_buffer_size_bounds[sta].first : 0;
+            size_t adp_buffer_size_max = synchro_buffer_size_bounds.size() ? synchro_buffer_size_bounds[sta].second : 0;
+            bool adp_work_stealing = synchro_work_stealing.size() ? synchro_work_stealing[sta] : false;
+            size_t adp_reorder_window = synchro_reorder_windows.size() ? synchro_reorder_windows[sta] : 0;
             size_t adp_n_frames = 1;
 
             // a map to remember if a passed socket points already to the same memory space
@@ -912,7 +1119,17 @@ Pipeline::create_adaptors(const std::vector<size_t>& synchro_buffer_sizes,
             passed_scks_out.clear();
 
             // allocate the adaptor for the first thread
-            adp = new module::Adaptor_m_to_n(adp_n_elmts, adp_datatype, adp_buffer_size, adp_active_waiting);
+            adp = new module::Adaptor_m_to_n(adp_n_elmts,
+                                             adp_datatype,
+                                             adp_buffer_size,
+                                             adp_active_waiting,
+                                             adp_lock_free,
+                                             adp_spin_budget,
+                                             adp_batch_size,
+                                             adp_buffer_size_min,
+                                             adp_buffer_size_max,
+                                             adp_work_stealing,
+                                             adp_reorder_window);
             adp->set_n_frames(adp_n_frames);
 
             for (size_t t = 0; t < n_threads; t++)
@@ -921,6 +1138,10 @@ Pipeline::create_adaptors(const std::vector<size_t>& synchro_buffer_sizes,
                 cur_adp->set_custom_name("Adp_m_to_n_" + std::to_string(sta));
                 if (t > 0) cur_adp->add_pusher();
                 this->adaptors[sta].first.push_back(std::unique_ptr<module::Adaptor_m_to_n>(cur_adp));
+                // the sequence numbers of the frames are forwarded from the input adaptor of the same thread
+                if (sta > 0)
+                    cur_adp->set_tag_source(t == 0 ? this->adaptors[sta - 1].first[0].get()
+                                                   : this->adaptors[sta - 1].second[t - 1].get());
                 auto task_push = &(*cur_adp)("push");
 
                 std::map<void*, size_t> fwd_source;
@@ -1022,13 +1243,7 @@ Pipeline::_bind_adaptors(const bool bind_adaptors)
                     auto ss = this->stages[sta]->sequences[t]->get_contents();
                     assert(ss != nullptr);
                     ss->tasks.insert(ss->tasks.begin(), task_pull);
-                    ss->processes.insert(ss->processes.begin(),
-                                         [task_pull]() -> const int*
-                                         {
-                                             task_pull->exec();
-                                             const int* status = task_pull->sockets.back()->get_dataptr<const int>();
-                                             return status;
-                                         });
+                    ss->processes.insert(ss->processes.begin(), std::function<const int*()>());
                     this->stages[sta]->update_tasks_id(t);
                 }
                 this->stages[sta]->firsts_tasks_id.clear();
@@ -1054,13 +1269,7 @@ Pipeline::_bind_adaptors(const bool bind_adaptors)
                     auto ss = this->stages[sta]->get_last_subsequence(t);
                     assert(ss != nullptr);
                     ss->tasks.push_back(task_push);
-                    ss->processes.push_back(
-                      [task_push]() -> const int*
-                      {
-                          task_push->exec();
-                          const int* status = task_push->sockets.back()->get_dataptr<const int>();
-                          return status;
-                      });
+                    ss->processes.push_back(std::function<const int*()>());
                     last_task_id = ss->tasks_id[ss->tasks_id.size() - 1] + 1;
                     ss->tasks_id.push_back(last_task_id);
                 }
@@ -1069,6 +1278,7 @@ Pipeline::_bind_adaptors(const bool bind_adaptors)
                 this->stages[sta]->n_tasks++;
             }
             this->stages[sta]->update_firsts_and_lasts_tasks();
+            this->stages[sta]->gen_plans();
         }
 
         // ------------------------------------------------------------------------------------------------------------
@@ -1165,6 +1375,7 @@ Pipeline::_unbind_adaptors(const bool bind_orphans)
                 this->stages[sta]->n_tasks--;
             }
             this->stages[sta]->update_firsts_and_lasts_tasks();
+            this->stages[sta]->gen_plans();
         }
 
         // ------------------------------------------------------------------------------------------------------------
@@ -1240,6 +1451,10 @@ Pipeline::exec(const std::vector<std::function<bool(const std::vector<const int*
         else
             stages[s]->exec();
 
+        // publish the incomplete batches of frames before to stop the next stage
+        for (auto& m : stages[s]->get_modules<module::Adaptor_m_to_n>(false))
+            m->flush_push();
+
         // send the signal to stop the next stage
         const auto& tasks = stages[s + 1]->get_tasks_per_threads();
         for (size_t th = 0; th < tasks.size(); th++)
@@ -1315,6 +1530,10 @@ Pipeline::exec(const std::vector<std::function<bool()>>& stop_conditions)
         else
             stages[s]->exec();
 
+        // publish the incomplete batches of frames before to stop the next stage
+        for (auto& m : stages[s]->get_modules<module::Adaptor_m_to_n>(false))
+            m->flush_push();
+
         // send the signal to stop the next stage
         const auto& tasks = stages[s + 1]->get_tasks_per_threads();
         for (size_t th = 0; th < tasks.size(); th++)
@@ -1,7 +1,10 @@
 #include <algorithm>
+#include <condition_variable>
 #include <cstring>
 #include <exception>
 #include <fstream>
+#include <future>
+#include <mutex>
 #include <numeric>
 #include <set>
 #include <sstream>
@@ -17,7 +20,11 @@
 #include "Runtime/Task/Task.hpp"
 #include "Tools/Display/rang_format/rang_format.h"
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Interface/Interface_elementwise.hpp"
+#include "Tools/Interface/Interface_waiting.hpp"
 #include "Tools/Signal_handler/Signal_handler.hpp"
+#include "Tools/System/Clock.hpp"
+#include "Tools/System/memory.hpp"
 #include "Tools/Thread/Thread_pinning/Thread_pinning.hpp"
 #include "Tools/Thread/Thread_pinning/Thread_pinning_utils.hpp"
 #include "Tools/Thread/Thread_pool/Standard/Thread_pool_standard.hpp"
@@ -45,6 +52,11 @@ Sequence::Sequence(const std::vector<const runtime::Task*>& firsts,
   , switchers_reset(n_threads)
   , auto_stop(true)
   , is_part_of_pipeline(false)
+  , n_dag_workers(0)
+  , fusion(false)
+  , frames_tiling(false)
+  , no_copy_processes(false)
+  , no_copy_bindings_generation(0)
   , next_round_is_over(n_threads, false)
   , cur_task_id(n_threads, 0)
   , cur_ss(n_threads, nullptr)
@@ -132,6 +144,11 @@ Sequence::Sequence(const std::vector<runtime::Task*>& firsts,
   , switchers_reset(n_threads)
   , auto_stop(true)
   , is_part_of_pipeline(false)
+  , n_dag_workers(0)
+  , fusion(false)
+  , frames_tiling(false)
+  , no_copy_processes(false)
+  , no_copy_bindings_generation(0)
   , next_round_is_over(n_threads, false)
   , cur_task_id(n_threads, 0)
   , cur_ss(n_threads, nullptr)
@@ -219,6 +236,11 @@ Sequence::Sequence(const std::vector<const runtime::Task*>& firsts,
   , switchers_reset(n_threads)
   , auto_stop(true)
   , is_part_of_pipeline(false)
+  , n_dag_workers(0)
+  , fusion(false)
+  , frames_tiling(false)
+  , no_copy_processes(false)
+  , no_copy_bindings_generation(0)
   , next_round_is_over(n_threads, false)
   , cur_task_id(n_threads, 0)
   , cur_ss(n_threads, nullptr)
@@ -300,6 +322,11 @@ Sequence::Sequence(const std::vector<runtime::Task*>& firsts,
   , switchers_reset(n_threads)
   , auto_stop(true)
   , is_part_of_pipeline(false)
+  , n_dag_workers(0)
+  , fusion(false)
+  , frames_tiling(false)
+  , no_copy_processes(false)
+  , no_copy_bindings_generation(0)
   , next_round_is_over(n_threads, false)
   , cur_task_id(n_threads, 0)
   , cur_ss(n_threads, nullptr)
@@ -376,6 +403,11 @@ Sequence::Sequence(runtime::Task& first,
 
 Sequence::~Sequence()
 {
+    this->stop_exec_async();
+    // the sockets rebound by the no-copy processes are only restored in the modules cloned by the sequence: the
+    // modules of the first replicated sequence belong to the user when 'tasks_inplace' and can be already destroyed
+    if (this->no_copy_processes) this->reset_no_copy_mode(this->tasks_inplace ? 1 : 0);
+
     std::vector<tools::Digraph_node<Sub_sequence>*> already_deleted_nodes;
     for (auto s : this->sequences)
         this->delete_tree(s, already_deleted_nodes);
@@ -523,6 +555,14 @@ Sequence::clone() const
     c->tasks_inplace = false;
     c->modules.resize(c->get_n_threads());
 
+    // the workers of the DAG-parallel execution are created for the cloned sequence once it is initialized
+    c->n_dag_workers = 0;
+    c->dag_pools.clear();
+    c->dag_states.clear();
+
+    // the asynchronous executions are not shared with the cloned sequence
+    c->async_state.reset();
+
     std::vector<const runtime::Task*> firsts_tasks;
     for (auto ta : this->get_firsts_tasks()[0])
         firsts_tasks.push_back(ta);
@@ -534,6 +574,7 @@ Sequence::clone() const
     c->init<runtime::Sub_sequence_const, const runtime::Task>(firsts_tasks, lasts_tasks, this->saved_exclusions);
     c->mtx_exception.reset(new std::mutex());
     c->force_exit_loop.reset(new std::atomic<bool>(false));
+    if (this->n_dag_workers) c->set_n_dag_workers(this->n_dag_workers, this->dag_puids);
     return c;
 }
 
@@ -666,9 +707,7 @@ Sequence::is_done() const
 }
 
 void
-Sequence::_exec(const size_t tid,
-                std::function<bool(const std::vector<const int*>&)>& stop_condition,
-                tools::Digraph_node<Sub_sequence>* sequence)
+Sequence::_exec(const size_t tid, std::function<bool(const std::vector<const int*>&)>& stop_condition)
 {
     tools::Signal_handler::reset_sigint();
 
@@ -680,28 +719,6 @@ Sequence::_exec(const size_t tid,
             tools::Thread_pinning::pin(this->pin_objects_per_thread[tid]);
     }
 
-    std::function<void(tools::Digraph_node<Sub_sequence>*, std::vector<const int*>&)> exec_sequence =
-      [&exec_sequence](tools::Digraph_node<Sub_sequence>* cur_ss, std::vector<const int*>& statuses)
-    {
-        auto type = cur_ss->get_c()->type;
-        auto& tasks_id = cur_ss->get_c()->tasks_id;
-        auto& processes = cur_ss->get_c()->processes;
-
-        if (type == subseq_t::COMMUTE)
-        {
-            statuses[tasks_id[0]] = processes[0]();
-            const int path = statuses[tasks_id[0]][0];
-            if (cur_ss->get_children().size() > (size_t)path) exec_sequence(cur_ss->get_children()[path], statuses);
-        }
-        else
-        {
-            for (size_t p = 0; p < processes.size(); p++)
-                statuses[tasks_id[p]] = processes[p]();
-            for (auto c : cur_ss->get_children())
-                exec_sequence(c, statuses);
-        }
-    };
-
     std::vector<const int*> statuses(this->n_tasks, nullptr);
     try
     {
@@ -714,7 +731,13 @@ Sequence::_exec(const size_t tid,
             std::fill(statuses.begin(), statuses.end(), nullptr);
             try
             {
-                exec_sequence(sequence, statuses);
+                this->exec_plan(tid,
+                                [&statuses](const plan_instr_t& instr) -> const int*
+                                {
+                                    if (instr.process) return statuses[instr.arg] = (*instr.process)();
+                                    instr.task->exec();
+                                    return statuses[instr.arg] = instr.task->sockets.back()->get_dataptr<int>();
+                                });
             }
             catch (tools::processing_aborted const&)
             {
@@ -752,10 +775,9 @@ Sequence::_exec(const size_t tid,
     if (this->is_thread_pinning()) tools::Thread_pinning::unpin();
 }
 
+template<class S>
 void
-Sequence::_exec_without_statuses(const size_t tid,
-                                 std::function<bool()>& stop_condition,
-                                 tools::Digraph_node<Sub_sequence>* sequence)
+Sequence::_exec_without_statuses(const size_t tid, S& stop_condition)
 {
     tools::Signal_handler::reset_sigint();
 
@@ -767,26 +789,6 @@ Sequence::_exec_without_statuses(const size_t tid,
             tools::Thread_pinning::pin(this->pin_objects_per_thread[tid]);
     }
 
-    std::function<void(tools::Digraph_node<Sub_sequence>*)> exec_sequence =
-      [&exec_sequence](tools::Digraph_node<Sub_sequence>* cur_ss)
-    {
-        auto type = cur_ss->get_c()->type;
-        auto& processes = cur_ss->get_c()->processes;
-
-        if (type == subseq_t::COMMUTE)
-        {
-            const int path = processes[0]()[0];
-            if (cur_ss->get_children().size() > (size_t)path) exec_sequence(cur_ss->get_children()[path]);
-        }
-        else
-        {
-            for (auto& process : processes)
-                process();
-            for (auto c : cur_ss->get_children())
-                exec_sequence(c);
-        }
-    };
-
     try
     {
         do
@@ -797,7 +799,13 @@ Sequence::_exec_without_statuses(const size_t tid,
 
             try
             {
-                exec_sequence(sequence);
+                this->exec_plan(tid,
+                                [](const plan_instr_t& instr) -> const int*
+                                {
+                                    if (instr.process) return (*instr.process)();
+                                    instr.task->exec();
+                                    return instr.task->sockets.back()->get_dataptr<int>();
+                                });
             }
             catch (tools::processing_aborted const&)
             {
@@ -835,36 +843,24 @@ Sequence::_exec_without_statuses(const size_t tid,
     if (this->is_thread_pinning()) tools::Thread_pinning::unpin();
 }
 
+template<class F>
 void
-Sequence::exec(std::function<bool(const std::vector<const int*>&)> stop_condition)
+Sequence::exec_threads(F&& exec_thread)
 {
-    if (this->is_no_copy_mode()) this->gen_processes(true);
-
-    std::function<bool(const std::vector<const int*>&)> real_stop_condition;
-    if (this->auto_stop)
-        real_stop_condition = [this, stop_condition](const std::vector<const int*>& statuses)
-        {
-            bool res = stop_condition(statuses);
-            return res || this->is_done();
-        };
-    else
-        real_stop_condition = stop_condition;
+    // the no-copy processes are kept from an execution to the next one, they are only generated again when the
+    // sequence has been modified ('leave_no_copy_processes()') or when sockets have been bound or unbound since
+    if (this->is_no_copy_mode() &&
+        (!this->no_copy_processes || this->no_copy_bindings_generation != Socket::get_bindings_generation()))
+        this->gen_processes(true);
 
-    std::function<void(const size_t)> func_exec = [this, &real_stop_condition](const size_t tid)
-    { this->Sequence::_exec(tid + 1, real_stop_condition, this->sequences[tid + 1]); };
+    std::function<void(const size_t)> func_exec = [&exec_thread](const size_t tid) { exec_thread(tid + 1); };
 
     this->thread_pool->run(func_exec, true);
-    this->_exec(0, real_stop_condition, this->sequences[0]);
+    exec_thread(0);
     this->thread_pool->wait();
 
     this->thread_pool->unset_func_exec();
 
-    if (this->is_no_copy_mode() && !this->is_part_of_pipeline)
-    {
-        this->reset_no_copy_mode();
-        this->gen_processes(false);
-    }
-
     if (!this->prev_exception_messages_to_display.empty())
     {
         *force_exit_loop = false;
@@ -872,11 +868,40 @@ Sequence::exec(std::function<bool(const std::vector<const int*>&)> stop_conditio
     }
 }
 
+void
+Sequence::exec(std::function<bool(const std::vector<const int*>&)> stop_condition)
+{
+    this->check_no_exec_async("Executing the sequence");
+    this->exec_sync(stop_condition);
+}
+
 void
 Sequence::exec(std::function<bool()> stop_condition)
 {
-    if (this->is_no_copy_mode()) this->gen_processes(true);
+    this->check_no_exec_async("Executing the sequence");
+    this->exec_sync(stop_condition);
+}
+
+void
+Sequence::exec_sync(std::function<bool(const std::vector<const int*>&)> stop_condition)
+{
+    std::function<bool(const std::vector<const int*>&)> real_stop_condition;
+    if (this->auto_stop)
+        real_stop_condition = [this, stop_condition](const std::vector<const int*>& statuses)
+        {
+            bool res = stop_condition(statuses);
+            return res || this->is_done();
+        };
+    else
+        real_stop_condition = stop_condition;
+
+    this->exec_threads([this, &real_stop_condition](const size_t tid)
+                       { this->Sequence::_exec(tid, real_stop_condition); });
+}
 
+void
+Sequence::exec_sync(std::function<bool()> stop_condition)
+{
     std::function<bool()> real_stop_condition;
     if (this->auto_stop)
         real_stop_condition = [this, stop_condition]()
@@ -887,26 +912,122 @@ Sequence::exec(std::function<bool()> stop_condition)
     else
         real_stop_condition = stop_condition;
 
-    std::function<void(const size_t)> func_exec = [this, &real_stop_condition](const size_t tid)
-    { this->Sequence::_exec_without_statuses(tid + 1, real_stop_condition, this->sequences[tid + 1]); };
+    this->exec_threads([this, &real_stop_condition](const size_t tid)
+                       { this->Sequence::_exec_without_statuses(tid, real_stop_condition); });
+}
 
-    this->thread_pool->run(func_exec, true);
-    this->_exec_without_statuses(0, real_stop_condition, this->sequences[0]);
-    this->thread_pool->wait();
+void
+Sequence::exec_n(const size_t n_frames)
+{
+    this->check_no_exec_async("Executing the sequence");
+
+    // the budget of frames is shared by all the threads: each execution takes a ticket of 'get_n_frames()' frames
+    // before to start, the threads stop when there is no frame left
+    const int64_t ticket = (int64_t)this->get_n_frames();
+    std::atomic<int64_t> budget((int64_t)n_frames);
+    const bool check_donners = this->auto_stop && !this->donners.empty();
+    auto stop_condition = [this, &budget, ticket, check_donners]()
+    { return budget.fetch_sub(ticket, std::memory_order_relaxed) <= 0 || (check_donners && this->is_done()); };
+
+    this->exec_threads(
+      [this, &budget, ticket, &stop_condition](const size_t tid)
+      {
+          if (budget.fetch_sub(ticket, std::memory_order_relaxed) > 0)
+              this->Sequence::_exec_without_statuses(tid, stop_condition);
+      });
+}
 
-    this->thread_pool->unset_func_exec();
+void
+Sequence::exec_for(const std::chrono::nanoseconds duration)
+{
+    this->check_no_exec_async("Executing the sequence");
+
+    // the threads are stopped by a timer through 'force_exit_loop', they do not read the clock
+    const auto deadline = std::chrono::steady_clock::now() + duration;
+    std::mutex mtx_timer;
+    std::condition_variable cv_timer;
+    bool over = false;
+    std::thread timer(
+      [this, deadline, &mtx_timer, &cv_timer, &over]()
+      {
+          std::unique_lock<std::mutex> lock(mtx_timer);
+          if (!cv_timer.wait_until(lock, deadline, [&over]() { return over; })) *this->force_exit_loop = true;
+      });
+
+    auto stop_timer = [this, &timer, &mtx_timer, &cv_timer, &over]()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mtx_timer);
+            over = true;
+        }
+        cv_timer.notify_one();
+        timer.join();
+        *this->force_exit_loop = false;
+    };
 
-    if (this->is_no_copy_mode() && !this->is_part_of_pipeline)
+    const bool check_donners = this->auto_stop && !this->donners.empty();
+    auto stop_condition = [this, check_donners]() { return check_donners && this->is_done(); };
+
+    try
     {
-        this->reset_no_copy_mode();
-        this->gen_processes(false);
+        this->exec_threads([this, &stop_condition](const size_t tid)
+                           { this->Sequence::_exec_without_statuses(tid, stop_condition); });
+    }
+    catch (...)
+    {
+        stop_timer();
+        throw;
     }
+    stop_timer();
+}
 
-    if (!this->prev_exception_messages_to_display.empty())
+void
+Sequence::exec_until_done()
+{
+    this->check_no_exec_async("Executing the sequence");
+
+    if (this->donners.empty())
     {
-        *force_exit_loop = false;
-        throw std::runtime_error(this->prev_exception_messages_to_display.back());
+        std::stringstream message;
+        message << "The sequence has no module that implements 'tools::Interface_is_done', its execution would never "
+                   "stop.";
+        throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
     }
+
+    // each thread only checks the modules of its replicated sequence, the first thread that is done stops the others
+    std::vector<std::vector<tools::Interface_is_done*>> donners_per_thread(this->n_threads);
+    for (size_t tid = 0; tid < this->n_threads; tid++)
+        for (auto m : this->all_modules[tid])
+        {
+            auto c = dynamic_cast<module::Set*>(m);
+            if (c != nullptr)
+            {
+                auto subret = c->get_sequence().get_modules<tools::Interface_is_done>(true);
+                donners_per_thread[tid].insert(donners_per_thread[tid].end(), subret.begin(), subret.end());
+            }
+
+            auto d = dynamic_cast<tools::Interface_is_done*>(m);
+            if (d != nullptr) donners_per_thread[tid].push_back(d);
+        }
+
+    std::atomic<bool> done(false);
+    this->exec_threads(
+      [this, &done, &donners_per_thread](const size_t tid)
+      {
+          auto& tid_donners = donners_per_thread[tid];
+          auto stop_condition = [&done, &tid_donners]()
+          {
+              if (done.load(std::memory_order_relaxed)) return true;
+              for (auto donner : tid_donners)
+                  if (donner->is_done())
+                  {
+                      done.store(true, std::memory_order_relaxed);
+                      return true;
+                  }
+              return false;
+          };
+          this->Sequence::_exec_without_statuses(tid, stop_condition);
+      });
 }
 
 void
@@ -915,9 +1036,146 @@ Sequence::exec()
     this->exec([]() { return false; });
 }
 
+Sequence_handle
+Sequence::exec_async(std::function<bool(const std::vector<const int*>&)> stop_condition)
+{
+    auto state = this->new_exec_async_state();
+    std::function<bool(const std::vector<const int*>&)> counted_stop_condition =
+      [state, stop_condition](const std::vector<const int*>& statuses)
+    {
+        // the counter is only read by the handles, it does not order the executions
+        state->n_execs.fetch_add(1, std::memory_order_relaxed);
+        return stop_condition(statuses);
+    };
+
+    this->start_exec_async(state, [this, counted_stop_condition]() { this->exec_sync(counted_stop_condition); });
+    return Sequence_handle(state);
+}
+
+Sequence_handle
+Sequence::exec_async(std::function<bool()> stop_condition)
+{
+    auto state = this->new_exec_async_state();
+    std::function<bool()> counted_stop_condition = [state, stop_condition]()
+    {
+        state->n_execs.fetch_add(1, std::memory_order_relaxed);
+        return stop_condition();
+    };
+
+    this->start_exec_async(state, [this, counted_stop_condition]() { this->exec_sync(counted_stop_condition); });
+    return Sequence_handle(state);
+}
+
+Sequence_handle
+Sequence::exec_async()
+{
+    return this->exec_async([]() { return false; });
+}
+
+std::shared_ptr<exec_async_state_t>
+Sequence::new_exec_async_state()
+{
+    if (this->async_state)
+    {
+        bool running;
+        {
+            std::lock_guard<std::mutex> lock(this->async_state->mtx);
+            running = this->async_state->running;
+        }
+        if (running)
+        {
+            std::stringstream message;
+            message << "An asynchronous execution of the sequence is already running, it has to be over before to "
+                       "start a new one.";
+            throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+        }
+        if (this->async_state->driver.joinable()) this->async_state->driver.join();
+    }
+
+    this->async_state.reset(new exec_async_state_t(this));
+    return this->async_state;
+}
+
+void
+Sequence::start_exec_async(std::shared_ptr<exec_async_state_t> state, std::function<void()> exec_func)
+{
+    std::shared_ptr<std::promise<void>> promise(new std::promise<void>());
+    state->done = promise->get_future().share();
+
+    state->driver = std::thread(
+      [this, state, promise, exec_func]()
+      {
+          bool canceled;
+          {
+              std::lock_guard<std::mutex> lock(state->mtx);
+              canceled = state->canceled;
+          }
+
+          std::exception_ptr exception;
+          if (!canceled)
+          {
+              try
+              {
+                  exec_func();
+              }
+              catch (...)
+              {
+                  exception = std::current_exception();
+              }
+          }
+
+          {
+              // once 'running' is false, 'cancel()' does not touch the sequence anymore: the cancellation can be
+              // undone safely, the sequence is ready for the next execution when the handles are notified
+              std::lock_guard<std::mutex> lock(state->mtx);
+              state->running = false;
+              if (state->canceled)
+              {
+                  *this->force_exit_loop = false;
+                  for (auto& m : this->get_modules<tools::Interface_waiting>())
+                      m->reset();
+              }
+          }
+
+          if (exception)
+              promise->set_exception(exception);
+          else
+              promise->set_value();
+      });
+}
+
+void
+Sequence::stop_exec_async()
+{
+    if (!this->async_state) return;
+
+    {
+        std::lock_guard<std::mutex> lock(this->async_state->mtx);
+        if (this->async_state->running && !this->async_state->canceled)
+        {
+            this->async_state->canceled = true;
+            this->cancel_exec();
+        }
+    }
+    if (this->async_state->driver.joinable()) this->async_state->driver.join();
+
+    std::lock_guard<std::mutex> lock(this->async_state->mtx);
+    this->async_state->sequence = nullptr;
+}
+
+void
+Sequence::cancel_exec()
+{
+    *this->force_exit_loop = true;
+    for (auto& m : this->get_modules<tools::Interface_waiting>())
+        m->cancel_waiting();
+}
+
 void
 Sequence::exec_seq(const size_t tid, const int frame_id)
 {
+    this->check_no_exec_async("Executing the sequence");
+
     if (tid >= this->sequences.size())
     {
         std::stringstream message;
@@ -926,31 +1184,18 @@ Sequence::exec_seq(const size_t tid, const int frame_id)
         throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
     }
 
-    std::function<void(tools::Digraph_node<Sub_sequence>*)> exec_sequence =
-      [&exec_sequence, frame_id](tools::Digraph_node<Sub_sequence>* cur_ss)
-    {
-        auto type = cur_ss->get_c()->type;
-        auto& tasks = cur_ss->get_c()->tasks;
-        if (type == subseq_t::COMMUTE)
-        {
-            const int path = tasks[0]->exec(frame_id)[0];
-            if (cur_ss->get_children().size() > (size_t)path) exec_sequence(cur_ss->get_children()[path]);
-        }
-        else
-        {
-            for (size_t ta = 0; ta < tasks.size(); ta++)
-                tasks[ta]->exec(frame_id);
-            for (auto c : cur_ss->get_children())
-                exec_sequence(c);
-        }
-    };
+    // the tasks are directly executed, the sockets can't stay rebound by the no-copy processes
+    if (!this->is_part_of_pipeline) this->leave_no_copy_processes();
 
-    exec_sequence(this->sequences[tid]);
+    this->exec_plan(tid,
+                    [frame_id](const plan_instr_t& instr) -> const int* { return instr.task->exec(frame_id).data(); });
 }
 
 runtime::Task*
 Sequence::exec_step(const size_t tid, const int frame_id)
 {
+    this->check_no_exec_async("Executing the sequence");
+
     if (tid >= this->sequences.size())
     {
         std::stringstream message;
@@ -959,6 +1204,9 @@ Sequence::exec_step(const size_t tid, const int frame_id)
         throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
     }
 
+    // the tasks are directly executed, the sockets can't stay rebound by the no-copy processes
+    if (!this->is_part_of_pipeline) this->leave_no_copy_processes();
+
     runtime::Task* executed_task = nullptr;
     if (this->next_round_is_over[tid])
     {
@@ -1391,7 +1639,7 @@ Sequence::init_recursive(tools::Digraph_node<SS>* cur_subseq,
 
 template<class SS, class MO>
 void
-Sequence::replicate(const tools::Digraph_node<SS>* sequence)
+Sequence::replicate(const tools::Digraph_node<SS>* sequence, const size_t first_tid)
 {
     std::set<MO*> modules_set;
     std::vector<const runtime::Task*> tsks_vec; // get a vector of tasks included in the tasks graph
@@ -1415,8 +1663,12 @@ Sequence::replicate(const tools::Digraph_node<SS>* sequence)
     std::vector<const tools::Digraph_node<SS>*> already_parsed_nodes;
     collect_modules_list(sequence, already_parsed_nodes);
 
+    // the replicated sequences are created for the threads from 'first_tid' to 'n_threads - 1', the thread 0 uses the
+    // original modules when 'tasks_inplace' is true
+    const size_t first_clone_tid = std::max(first_tid, (size_t)(this->tasks_inplace ? 1 : 0));
+
     // check if all the tasks of the sequence are replicable before to perform the modules clones
-    if (this->n_threads - (this->tasks_inplace ? 1 : 0))
+    if (this->n_threads > first_clone_tid)
         for (auto& t : tsks_vec)
             if (!t->is_replicable())
             {
@@ -1427,16 +1679,21 @@ Sequence::replicate(const tools::Digraph_node<SS>* sequence)
                 throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
             }
 
+    // the modules of the new replicated sequences have to be in the same order than the modules of the existing ones
     std::vector<MO*> modules_vec;
-    for (auto m : modules_set)
-        modules_vec.push_back(m);
+    if (first_tid)
+        for (auto m : this->all_modules[0])
+            modules_vec.push_back(m);
+    else
+        for (auto m : modules_set)
+            modules_vec.push_back(m);
 
     // clone the modules
-    for (size_t tid = 0; tid < this->n_threads - (this->tasks_inplace ? 1 : 0); tid++)
+    for (size_t real_tid = first_clone_tid; real_tid < this->n_threads; real_tid++)
     {
+        const auto tid = real_tid - (this->tasks_inplace ? 1 : 0);
         if (this->is_thread_pinning())
         {
-            const auto real_tid = tid + (this->tasks_inplace ? 1 : 0);
             if (!this->puids.empty())
                 tools::Thread_pinning::pin(this->puids[real_tid]);
             else
@@ -1444,7 +1701,7 @@ Sequence::replicate(const tools::Digraph_node<SS>* sequence)
         }
 
         this->modules[tid].resize(modules_vec.size());
-        this->all_modules[tid + (this->tasks_inplace ? 1 : 0)].resize(modules_vec.size());
+        this->all_modules[real_tid].resize(modules_vec.size());
         for (size_t m = 0; m < modules_vec.size(); m++)
         {
             try
@@ -1459,7 +1716,7 @@ Sequence::replicate(const tools::Digraph_node<SS>* sequence)
 
                 throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
             }
-            this->all_modules[tid + (this->tasks_inplace ? 1 : 0)][m] = this->modules[tid][m].get();
+            this->all_modules[real_tid][m] = this->modules[tid][m].get();
         }
 
         if (this->is_thread_pinning()) tools::Thread_pinning::unpin();
@@ -1650,7 +1907,7 @@ Sequence::replicate(const tools::Digraph_node<SS>* sequence)
         }
     };
 
-    for (size_t thread_id = (this->tasks_inplace ? 1 : 0); thread_id < this->sequences.size(); thread_id++)
+    for (size_t thread_id = first_clone_tid; thread_id < this->sequences.size(); thread_id++)
     {
         if (this->is_thread_pinning())
         {
@@ -1673,9 +1930,11 @@ Sequence::replicate(const tools::Digraph_node<SS>* sequence)
 
 template void
 runtime::Sequence::replicate<runtime::Sub_sequence_const, const module::Module>(
-  const tools::Digraph_node<runtime::Sub_sequence_const>*);
+  const tools::Digraph_node<runtime::Sub_sequence_const>*,
+  const size_t);
 template void
-runtime::Sequence::replicate<runtime::Sub_sequence, module::Module>(const tools::Digraph_node<runtime::Sub_sequence>*);
+runtime::Sequence::replicate<runtime::Sub_sequence, module::Module>(const tools::Digraph_node<runtime::Sub_sequence>*,
+                                                                    const size_t);
 
 template<class SS>
 void
@@ -1899,6 +2158,11 @@ Sequence::export_dot(tools::Digraph_node<SS>* root, std::ostream& stream) const
 void
 Sequence::gen_processes(const bool no_copy_mode)
 {
+    // the sockets rebound by the previous no-copy processes have to be restored before to explore the bindings
+    if (this->no_copy_processes) this->reset_no_copy_mode();
+    this->no_copy_processes = no_copy_mode;
+    this->no_copy_bindings_generation = Socket::get_bindings_generation();
+
     std::function<void(Socket * socket, std::vector<runtime::Socket*> & list_fwd)> explore_thread_rec =
       [&explore_thread_rec](Socket* socket, std::vector<runtime::Socket*>& list_fwd)
     {
@@ -1931,7 +2195,7 @@ Sequence::gen_processes(const bool no_copy_mode)
 
     std::function<void(tools::Digraph_node<Sub_sequence>*, std::vector<tools::Digraph_node<Sub_sequence>*>&)>
       gen_processes_recursive =
-        [&gen_processes_recursive, no_copy_mode, &explore_thread_rec, &explore_thread_rec_reverse](
+        [this, &gen_processes_recursive, no_copy_mode, &explore_thread_rec, &explore_thread_rec_reverse](
           tools::Digraph_node<Sub_sequence>* cur_node,
           std::vector<tools::Digraph_node<Sub_sequence>*>& already_parsed_nodes)
     {
@@ -1947,11 +2211,20 @@ Sequence::gen_processes(const bool no_copy_mode)
             contents->rebind_dataptrs.clear();
             for (auto task : contents->tasks)
             {
-                if (dynamic_cast<module::Switcher*>(&task->get_module()) &&
-                    task->get_name().find("select") != std::string::npos && no_copy_mode)
+                // the module of the task is identified once, the processes are only generated again when the sequence
+                // is modified (see 'no_copy_processes')
+                auto switcher = no_copy_mode ? dynamic_cast<module::Switcher*>(&task->get_module()) : nullptr;
+                auto adaptor =
+                  no_copy_mode && !switcher ? dynamic_cast<module::Adaptor_m_to_n*>(&task->get_module()) : nullptr;
+                // the slots of a placed adaptor are kept out of the no-copy swaps, otherwise they would be replaced by
+                // socket buffers allocated on any NUMA node after one lap of the ring
+                if (adaptor && !adaptor->get_pull_placement().empty()) adaptor = nullptr;
+                if (!switcher && !adaptor) continue;
+                const auto& task_name = task->get_name();
+
+                if (switcher && task_name.find("select") != std::string::npos)
                 {
                     auto select_task = task;
-                    auto switcher = dynamic_cast<module::Switcher*>(&select_task->get_module());
                     switcher->set_no_copy_select(true);
 
                     const auto rebind_id = contents->rebind_sockets.size();
@@ -1979,7 +2252,14 @@ Sequence::gen_processes(const bool no_copy_mode)
                         }
                     }
 
-                    modified_tasks[select_task] = [contents, select_task, switcher, rebind_id]() -> const int*
+                    // the data pointers to rebind are flattened once here, the process does not go through the
+                    // nested vectors of sockets
+                    std::vector<void**> targets;
+                    for (auto& sockets : contents->rebind_sockets[rebind_id])
+                        for (auto sck : sockets)
+                            targets.push_back(&sck->dataptr);
+
+                    modified_tasks[select_task] = [select_task, switcher, targets]() -> const int*
                     {
                         select_task->exec();
                         const int* status = select_task->sockets.back()->get_dataptr<int>();
@@ -1988,21 +2268,16 @@ Sequence::gen_processes(const bool no_copy_mode)
                         const auto in_dataptr = select_task->sockets[path]->_get_dataptr();
 
                         // rebind input sockets on the fly
-                        // there should be only one output socket at this time (sout_id == 0)
-                        for (size_t sout_id = 0; sout_id < contents->rebind_sockets[rebind_id].size(); sout_id++)
-                            for (size_t sin_id = 0; sin_id < contents->rebind_sockets[rebind_id][sout_id].size();
-                                 sin_id++)
-                                contents->rebind_sockets[rebind_id][sout_id][sin_id]->dataptr = in_dataptr;
+                        for (auto target : targets)
+                            *target = in_dataptr;
 
                         return status;
                     };
                 }
 
-                if (dynamic_cast<module::Switcher*>(&task->get_module()) &&
-                    task->get_name().find("commute") != std::string::npos && no_copy_mode)
+                if (switcher && task_name.find("commute") != std::string::npos)
                 {
                     auto commute_task = task;
-                    auto switcher = dynamic_cast<module::Switcher*>(&commute_task->get_module());
                     switcher->set_no_copy_commute(true);
 
                     const auto rebind_id = contents->rebind_sockets.size();
@@ -2029,7 +2304,18 @@ Sequence::gen_processes(const bool no_copy_mode)
                         }
                     }
 
-                    modified_tasks[commute_task] = [contents, commute_task, switcher, rebind_id]() -> const int*
+                    // the data pointers to rebind are flattened once here: the ones of the path 'p' are in
+                    // 'targets[paths_offsets[p]]' to 'targets[paths_offsets[p + 1] - 1]'
+                    std::vector<void**> targets;
+                    std::vector<size_t> paths_offsets(1, 0);
+                    for (auto& sockets : contents->rebind_sockets[rebind_id])
+                    {
+                        for (auto sck : sockets)
+                            targets.push_back(&sck->dataptr);
+                        paths_offsets.push_back(targets.size());
+                    }
+
+                    modified_tasks[commute_task] = [commute_task, switcher, targets, paths_offsets]() -> const int*
                     {
                         commute_task->exec();
                         const int* status = commute_task->sockets.back()->get_dataptr<int>();
@@ -2037,18 +2323,17 @@ Sequence::gen_processes(const bool no_copy_mode)
                         const auto path = switcher->get_path();
 
                         // rebind input sockets on the fly
-                        for (size_t sin_id = 0; sin_id < contents->rebind_sockets[rebind_id][path].size(); sin_id++)
-                            contents->rebind_sockets[rebind_id][path][sin_id]->dataptr = in_dataptr;
+                        for (size_t t = paths_offsets[path]; t < paths_offsets[path + 1]; t++)
+                            *targets[t] = in_dataptr;
 
                         return status;
                     };
                 }
 
-                if (dynamic_cast<module::Adaptor_m_to_n*>(&task->get_module()) &&
-                    task->get_name().find("pull") != std::string::npos && no_copy_mode)
+                if (adaptor && task_name.find("pull") != std::string::npos)
                 {
                     auto pull_task = task;
-                    auto adp_pull = dynamic_cast<module::Adaptor_m_to_n*>(&pull_task->get_module());
+                    auto adp_pull = adaptor;
                     adp_pull->set_no_copy_pull(true);
                     const auto rebind_id = contents->rebind_sockets.size();
                     contents->rebind_sockets.resize(rebind_id + 1);
@@ -2102,11 +2387,10 @@ Sequence::gen_processes(const bool no_copy_mode)
                     };
                 }
 
-                if (dynamic_cast<module::Adaptor_m_to_n*>(&task->get_module()) &&
-                    task->get_name().find("push") != std::string::npos && no_copy_mode)
+                if (adaptor && task_name.find("push") != std::string::npos)
                 {
                     auto push_task = task;
-                    auto adp_push = dynamic_cast<module::Adaptor_m_to_n*>(&push_task->get_module());
+                    auto adp_push = adaptor;
                     adp_push->set_no_copy_push(true);
                     const auto rebind_id = contents->rebind_sockets.size();
                     contents->rebind_sockets.resize(rebind_id + 1);
@@ -2160,17 +2444,14 @@ Sequence::gen_processes(const bool no_copy_mode)
                 }
             }
 
+            if (this->fusion) this->gen_fused_processes(contents, modified_tasks);
+            if (this->frames_tiling) this->gen_tiled_processes(contents, modified_tasks);
+
             for (auto task : contents->tasks)
                 if (modified_tasks.count(task))
                     contents->processes.push_back(modified_tasks[task]);
                 else
-                    contents->processes.push_back(
-                      [task]() -> const int*
-                      {
-                          task->exec();
-                          const int* status = task->sockets.back()->get_dataptr<int>();
-                          return status;
-                      });
+                    contents->processes.push_back(std::function<const int*()>());
 
             for (auto c : cur_node->get_children())
                 gen_processes_recursive(c, already_parsed_nodes);
@@ -2192,80 +2473,603 @@ Sequence::gen_processes(const bool no_copy_mode)
 
         if (this->is_thread_pinning()) tools::Thread_pinning::unpin();
     }
+
+    this->gen_plans();
 }
 
+// the chains of adjacent element-wise tasks of a sub-sequence, where each task is the only reader of the output of
+// the previous one, are executed by the process of their first task: the frames are processed by tiles and each tile
+// goes through all the tasks of the chain before the next one, then the intermediate outputs are only written in
+// small tile buffers that stay in the cache (the output sockets of the intermediate tasks are left untouched), the
+// processes of the other tasks of the chain only return their status
 void
-Sequence::reset_no_copy_mode()
+Sequence::gen_fused_processes(Sub_sequence* contents,
+                              std::map<runtime::Task*, std::function<const int*()>>& modified_tasks) const
 {
-    std::function<void(tools::Digraph_node<Sub_sequence>*, std::vector<tools::Digraph_node<Sub_sequence>*>&)>
-      reset_no_copy_mode_recursive =
-        [&reset_no_copy_mode_recursive](tools::Digraph_node<Sub_sequence>* cur_node,
-                                        std::vector<tools::Digraph_node<Sub_sequence>*>& already_parsed_nodes)
+    // size of the tile buffers of a chain, they have to fit in the L1 data cache with the tiles of the inputs
+    size_t l1_bytes = tools::get_cache_size(1);
+    if (l1_bytes == 0) l1_bytes = 32 * 1024;
+    const size_t tile_bytes = l1_bytes / 2;
+
+    struct fused_stage_t
+    {
+        runtime::Task* task;
+        const tools::Interface_elementwise* elmtwise;
+        std::vector<Socket*> ins; // nullptr for the input bound to the output of the previous stage
+        std::vector<const void*> ins_ptrs;
+        Socket* out;
+    };
+
+    struct fused_chain_t
     {
-        if (cur_node != nullptr &&
-            std::find(already_parsed_nodes.begin(), already_parsed_nodes.end(), cur_node) == already_parsed_nodes.end())
+        std::vector<fused_stage_t> stages;
+        size_t n_tile_elmts;
+        std::vector<int8_t, tools::aligned_allocator<int8_t>> tiles;
+        std::vector<void*> tiles_ptrs; // one tile per stage but the last one
+        std::vector<uint8_t> timed;    // the stages whose current call is timed (see 'Task::set_stats_sampling()')
+    };
+
+    auto get_stage = [&modified_tasks](runtime::Task* task, fused_stage_t& stage) -> bool
+    {
+        auto elmtwise = dynamic_cast<const tools::Interface_elementwise*>(&task->get_module());
+        if (elmtwise == nullptr || !elmtwise->is_elementwise(*task) || modified_tasks.count(task) ||
+            task->is_debug() || task->is_frame_meta() ||
+            task->get_module().get_n_frames_per_wave() != 1)
+            return false;
+
+        stage.task = task;
+        stage.elmtwise = elmtwise;
+        stage.ins.clear();
+        stage.out = nullptr;
+        for (size_t s = 0; s < task->sockets.size() - 1; s++)
         {
-            already_parsed_nodes.push_back(cur_node);
-            auto contents = cur_node->get_c();
-            for (auto task : contents->tasks)
+            auto sck = task->sockets[s].get();
+            if (sck->get_type() == socket_t::SIN)
+                stage.ins.push_back(sck);
+            else if (sck->get_type() == socket_t::SOUT && stage.out == nullptr)
+                stage.out = sck;
+            else
+                return false;
+        }
+        if (stage.out == nullptr) return false;
+
+        const size_t n_frames = task->get_module().get_n_frames();
+        for (auto sck : stage.ins)
+            if (sck->get_n_elmts() != stage.out->get_n_elmts() && sck->get_n_elmts() != n_frames) return false;
+        stage.ins_ptrs.resize(stage.ins.size());
+        return true;
+    };
+
+    // returns the position of the input of 'next' bound to the output of 'prev' or -1 if the stages can't be chained
+    auto get_link = [](const fused_stage_t& prev, const fused_stage_t& next) -> int
+    {
+        auto& readers = prev.out->get_bound_sockets();
+        if (readers.size() != 1 || prev.out->get_n_elmts() != next.out->get_n_elmts() ||
+            prev.task->get_module().get_n_frames() != next.task->get_module().get_n_frames())
+            return -1;
+        for (size_t i = 0; i < next.ins.size(); i++)
+            if (next.ins[i] == readers[0] && next.ins[i]->get_n_elmts() == next.out->get_n_elmts()) return (int)i;
+        return -1;
+    };
+
+    size_t t = 0;
+    while (t < contents->tasks.size())
+    {
+        std::shared_ptr<fused_chain_t> chain(new fused_chain_t());
+        fused_stage_t stage;
+        if (get_stage(contents->tasks[t], stage))
+        {
+            chain->stages.push_back(stage);
+            int link;
+            while (t + chain->stages.size() < contents->tasks.size() &&
+                   get_stage(contents->tasks[t + chain->stages.size()], stage) &&
+                   (link = get_link(chain->stages.back(), stage)) >= 0)
             {
-                if (dynamic_cast<module::Switcher*>(&task->get_module()) &&
-                    task->get_name().find("select") != std::string::npos)
-                {
-                    auto select_task = task;
-                    auto switcher = dynamic_cast<module::Switcher*>(&select_task->get_module());
-                    switcher->set_no_copy_select(false);
-                }
+                stage.ins[link] = nullptr;
+                chain->stages.push_back(stage);
+            }
+        }
 
-                if (dynamic_cast<module::Switcher*>(&task->get_module()) &&
-                    task->get_name().find("commute") != std::string::npos)
-                {
-                    auto commute_task = task;
-                    auto switcher = dynamic_cast<module::Switcher*>(&commute_task->get_module());
-                    switcher->set_no_copy_commute(false);
-                }
+        if (chain->stages.size() < 2)
+        {
+            t++;
+            continue;
+        }
+        t += chain->stages.size();
+
+        const size_t n_frames = chain->stages[0].task->get_module().get_n_frames();
+        const size_t n_elmts = chain->stages[0].out->get_n_elmts() / n_frames;
+        size_t elmt_bytes = 0;
+        for (size_t s = 0; s < chain->stages.size() - 1; s++)
+            elmt_bytes += chain->stages[s].out->get_datatype_size();
+        chain->n_tile_elmts = std::min(n_elmts, std::max((size_t)1, tile_bytes / elmt_bytes));
+
+        // the tiles are aligned on cache lines
+        const size_t cl = tools::cache_line_size;
+        std::vector<size_t> tiles_offsets;
+        size_t offset = 0;
+        for (size_t s = 0; s < chain->stages.size() - 1; s++)
+        {
+            tiles_offsets.push_back(offset);
+            offset += (chain->n_tile_elmts * chain->stages[s].out->get_datatype_size() + cl - 1) / cl * cl;
+        }
+        chain->tiles.resize(offset);
+        for (auto o : tiles_offsets)
+            chain->tiles_ptrs.push_back(chain->tiles.data() + o);
+        chain->timed.resize(chain->stages.size());
 
-                if (dynamic_cast<module::Adaptor_m_to_n*>(&task->get_module()) &&
-                    task->get_name().find("pull") != std::string::npos)
-                {
-                    auto pull_task = task;
-                    auto adp_pull = dynamic_cast<module::Adaptor_m_to_n*>(&pull_task->get_module());
-                    adp_pull->set_no_copy_pull(false);
-                    adp_pull->reset_buffer();
-                }
+        modified_tasks[chain->stages[0].task] = [chain]() -> const int*
+        {
+            auto& stages = chain->stages;
+            // the tasks of the chain are interleaved: a timed call records the duration of the whole chain divided
+            // by the number of stages
+            bool timed = false;
+            for (size_t s = 0; s < stages.size(); s++)
+            {
+                chain->timed[s] = stages[s].task->is_stats() && stages[s].task->sample_call();
+                timed |= (bool)chain->timed[s];
+            }
+            const auto t_start = timed ? tools::Clock::now() : tools::Clock::time_point();
 
-                if (dynamic_cast<module::Adaptor_m_to_n*>(&task->get_module()) &&
-                    task->get_name().find("push") != std::string::npos)
+            const size_t n_frames = stages[0].task->get_module().get_n_frames();
+            const size_t n_elmts = stages[0].out->get_n_elmts() / n_frames;
+            for (size_t f = 0; f < n_frames; f++)
+                for (size_t e = 0; e < n_elmts; e += chain->n_tile_elmts)
                 {
-                    auto push_task = task;
-                    auto adp_push = dynamic_cast<module::Adaptor_m_to_n*>(&push_task->get_module());
-                    adp_push->set_no_copy_push(false);
-                    adp_push->reset_buffer();
+                    const size_t n = std::min(chain->n_tile_elmts, n_elmts - e);
+                    const void* prev_tile = nullptr;
+                    for (size_t s = 0; s < stages.size(); s++)
+                    {
+                        auto& stage = stages[s];
+                        for (size_t i = 0; i < stage.ins.size(); i++)
+                        {
+                            auto in = stage.ins[i];
+                            if (in == nullptr)
+                                stage.ins_ptrs[i] = prev_tile;
+                            else
+                            {
+                                const size_t pos = in->get_n_elmts() == n_frames ? f : f * n_elmts + e;
+                                stage.ins_ptrs[i] = (const int8_t*)in->_get_dataptr() + pos * in->get_datatype_size();
+                            }
+                        }
+                        void* out = s < stages.size() - 1 ? chain->tiles_ptrs[s]
+                                                          : (int8_t*)stage.out->_get_dataptr() +
+                                                              (f * n_elmts + e) * stage.out->get_datatype_size();
+                        stage.elmtwise->perform_elmts(*stage.task, stage.ins_ptrs.data(), out, n);
+                        prev_tile = out;
+                    }
                 }
-            }
 
-            for (size_t rebind_id = 0; rebind_id < contents->rebind_sockets.size(); rebind_id++)
-                for (size_t s = 0; s < contents->rebind_sockets[rebind_id].size(); s++)
-                    for (size_t ta = 0; ta < contents->rebind_sockets[rebind_id][s].size(); ta++)
-                        contents->rebind_sockets[rebind_id][s][ta]->dataptr =
-                          contents->rebind_dataptrs[rebind_id][s][ta];
+            const std::chrono::nanoseconds duration =
+              timed ? (tools::Clock::now() - t_start) / (int64_t)stages.size() : std::chrono::nanoseconds(0);
+            for (size_t s = 0; s < stages.size(); s++)
+            {
+                auto task = stages[s].task;
+                int* status = task->sockets.back()->get_dataptr<int>();
+                for (size_t w = 0; w < n_frames; w++)
+                    status[w] = (int)status_t::SUCCESS;
+                if (chain->timed[s]) task->record_duration(duration);
+                task->n_calls++;
+            }
+            return stages[0].task->sockets.back()->get_dataptr<int>();
+        };
 
-            for (auto c : cur_node->get_children())
-                reset_no_copy_mode_recursive(c, already_parsed_nodes);
+        for (size_t s = 1; s < chain->stages.size(); s++)
+        {
+            auto task = chain->stages[s].task;
+            modified_tasks[task] = [task]() -> const int* { return task->sockets.back()->get_dataptr<int>(); };
         }
+    }
+}
+
+// the runs of adjacent tasks of a sub-sequence that process the frames by waves are executed by the process of their
+// first task: the waves are grouped in tiles and all the tasks of the run process a tile before the next one. The
+// tiles are sized from the bytes of the sockets so that the data of a tile fit in the half of the L2 cache, then the
+// data produced by a task are still in the cache when the next tasks read them. The processes of the other tasks of
+// the run only return their status
+void
+Sequence::gen_tiled_processes(Sub_sequence* contents,
+                              std::map<runtime::Task*, std::function<const int*()>>& modified_tasks) const
+{
+    if (contents->type == subseq_t::COMMUTE) return;
+
+    size_t l2_bytes = tools::get_cache_size(2);
+    if (l2_bytes == 0) l2_bytes = 256 * 1024; // conservative size when the L2 cache can't be detected
+    const size_t tile_bytes = l2_bytes / 2;
+
+    auto is_tilable = [&modified_tasks](runtime::Task* task) -> bool
+    {
+        auto& mdl = task->get_module();
+        // the control flow, the synchronizations and the nested sequences have to process all the frames at once
+        return !modified_tasks.count(task) && !task->is_debug() && !task->is_stats() && !task->is_frame_meta() &&
+               mdl.get_n_waves() > 1 && dynamic_cast<module::Switcher*>(&mdl) == nullptr &&
+               dynamic_cast<module::Adaptor_m_to_n*>(&mdl) == nullptr && dynamic_cast<module::Set*>(&mdl) == nullptr;
     };
 
-    for (auto& sequence : this->sequences)
+    auto same_waves = [](runtime::Task* t1, runtime::Task* t2) -> bool
+    {
+        return t1->get_module().get_n_frames() == t2->get_module().get_n_frames() &&
+               t1->get_module().get_n_frames_per_wave() == t2->get_module().get_n_frames_per_wave();
+    };
+
+    size_t t = 0;
+    while (t < contents->tasks.size())
+    {
+        size_t e = t;
+        while (e < contents->tasks.size() && is_tilable(contents->tasks[e]) &&
+               same_waves(contents->tasks[t], contents->tasks[e]))
+            e++;
+        if (e - t < 2)
+        {
+            t = std::max(t + 1, e);
+            continue;
+        }
+        const std::vector<runtime::Task*> run(contents->tasks.begin() + t, contents->tasks.begin() + e);
+        t = e;
+
+        // upper bound of the data accessed by the run for one wave (the inputs bound to an output of the run share its
+        // data)
+        auto& mdl = run[0]->get_module();
+        size_t wave_bytes = 0;
+        for (auto task : run)
+            for (size_t s = 0; s < task->sockets.size() - 1; s++)
+            {
+                auto sck = task->sockets[s].get();
+                if (sck->get_type() == socket_t::SIN && sck->bound_socket != nullptr &&
+                    std::find(run.begin(), run.end(), &sck->bound_socket->get_task()) != run.end())
+                    continue;
+                wave_bytes += sck->get_databytes() / mdl.get_n_frames() * mdl.get_n_frames_per_wave();
+            }
+
+        const size_t n_waves_per_tile = std::max((size_t)1, tile_bytes / std::max((size_t)1, wave_bytes));
+        if (n_waves_per_tile >= mdl.get_n_waves()) continue; // all the frames already fit in the cache
+
+        modified_tasks[run[0]] = [run, n_waves_per_tile]() -> const int*
+        {
+            const size_t n_waves = run[0]->get_module().get_n_waves();
+            for (size_t w = 0; w < n_waves; w += n_waves_per_tile)
+                for (auto task : run)
+                    task->exec_waves(w, std::min(w + n_waves_per_tile, n_waves));
+
+            // the first status that is not a success is returned (the tasks of the run are executed together)
+            for (auto task : run)
+            {
+                const int* status = task->sockets.back()->get_dataptr<int>();
+                for (size_t w = 0; w < n_waves; w++)
+                    if (status[w] != (int)status_t::SUCCESS) return status;
+            }
+            return run[0]->sockets.back()->get_dataptr<int>();
+        };
+
+        for (size_t r = 1; r < run.size(); r++)
+        {
+            auto task = run[r];
+            modified_tasks[task] = [task]() -> const int* { return task->sockets.back()->get_dataptr<int>(); };
+        }
+    }
+}
+
+// the digraph of each thread is compiled into a linear array of instructions: the tasks of a sub-sequence are
+// followed by a call to each of its children but the last one, the last child is reached with a jump (or directly
+// placed after its parent when it has not been compiled yet). Then the chains of sub-sequences and the loops are
+// executed without growing the return stack
+void
+Sequence::gen_plans()
+{
+    this->plans.resize(this->sequences.size());
+    this->ret_stacks.resize(this->sequences.size());
+    this->dag_blocks.resize(this->sequences.size());
+    this->dag_states.resize(this->n_dag_workers ? this->sequences.size() : 0);
+    for (size_t tid = 0; tid < this->sequences.size(); tid++)
+    {
+        auto& plan = this->plans[tid];
+        auto& blocks = this->dag_blocks[tid];
+        plan.clear();
+        blocks.clear();
+        std::map<tools::Digraph_node<Sub_sequence>*, size_t> entries;
+
+        auto task_instr = [](Sub_sequence* contents, const plan_op_t op, const size_t p) -> plan_instr_t
+        {
+            const bool has_process = p < contents->processes.size() && contents->processes[p];
+            return {
+                op, contents->tasks_id[p], 0, contents->tasks[p], has_process ? &contents->processes[p] : nullptr
+            };
+        };
+
+        std::function<size_t(tools::Digraph_node<Sub_sequence>*)> gen_plan_recursive =
+          [this, &gen_plan_recursive, &plan, &blocks, &entries, &task_instr](
+            tools::Digraph_node<Sub_sequence>* cur_node) -> size_t
+        {
+            auto it = entries.find(cur_node);
+            if (it != entries.end()) return it->second;
+
+            const size_t entry = plan.size();
+            entries[cur_node] = entry;
+
+            auto contents = cur_node->get_c();
+            auto& children = cur_node->get_children();
+            if (contents->type == subseq_t::COMMUTE)
+            {
+                plan.push_back(task_instr(contents, plan_op_t::COMMUTE, 0));
+                plan.back().n_paths = children.size();
+                const size_t table = plan.size();
+                plan.resize(table + children.size(), { plan_op_t::JUMP, 0, 0, nullptr, nullptr });
+                for (size_t c = 0; c < children.size(); c++)
+                {
+                    const size_t child_entry = gen_plan_recursive(children[c]);
+                    plan[table + c].arg = child_entry;
+                }
+            }
+            else
+            {
+                // the tasks without specialized process are grouped in PAR blocks when they are not all dependent
+                size_t p = 0;
+                while (p < contents->tasks.size())
+                {
+                    size_t e = p;
+                    while (e < contents->tasks.size() && !task_instr(contents, plan_op_t::EXEC, e).process)
+                        e++;
+
+                    dag_block_t block;
+                    if (this->n_dag_workers && e - p >= 2 &&
+                        this->gen_dag_block(
+                          std::vector<runtime::Task*>(contents->tasks.begin() + p, contents->tasks.begin() + e),
+                          block))
+                    {
+                        plan.push_back({ plan_op_t::PAR, blocks.size(), e - p, nullptr, nullptr });
+                        block.first = plan.size();
+                        blocks.push_back(block);
+                    }
+                    for (; p < e; p++)
+                        plan.push_back(task_instr(contents, plan_op_t::EXEC, p));
+                    if (p < contents->tasks.size()) plan.push_back(task_instr(contents, plan_op_t::EXEC, p++));
+                }
+
+                if (children.empty())
+                    plan.push_back({ plan_op_t::RET, 0, 0, nullptr, nullptr });
+                else
+                {
+                    const size_t calls = plan.size();
+                    plan.resize(calls + children.size() - 1, { plan_op_t::CALL, 0, 0, nullptr, nullptr });
+                    auto last_child = children.back();
+                    if (entries.count(last_child))
+                        plan.push_back({ plan_op_t::JUMP, entries[last_child], 0, nullptr, nullptr });
+                    else
+                        gen_plan_recursive(last_child);
+                    for (size_t c = 0; c < children.size() - 1; c++)
+                    {
+                        const size_t child_entry = gen_plan_recursive(children[c]);
+                        plan[calls + c].arg = child_entry;
+                    }
+                }
+            }
+            return entry;
+        };
+
+        if (this->sequences[tid] != nullptr) gen_plan_recursive(this->sequences[tid]);
+        this->ret_stacks[tid].clear();
+        this->ret_stacks[tid].reserve(
+          std::count_if(plan.begin(), plan.end(), [](const plan_instr_t& i) { return i.op == plan_op_t::CALL; }));
+
+        if (this->n_dag_workers)
+        {
+            size_t capacity = 0;
+            for (auto& block : blocks)
+                capacity = std::max(capacity, block.n_preds.size());
+            this->dag_states[tid].reset(new dag_state_t(capacity));
+        }
+    }
+}
+
+bool
+Sequence::gen_dag_block(const std::vector<runtime::Task*>& tasks, dag_block_t& block) const
+{
+    // the data of an input or a forward socket are the data of the first socket of the chain of bindings, an output
+    // socket owns its data
+    auto data_of = [](const Socket* s) -> const void*
+    {
+        while (s->get_type() != socket_t::SOUT && s->bound_socket != nullptr)
+            s = s->bound_socket;
+        return (s->get_type() == socket_t::SOUT || s->dataptr == nullptr) ? (const void*)s : (const void*)s->dataptr;
+    };
+
+    // for each data: the last task that wrote it and the tasks that read it since then
+    std::map<const void*, std::pair<int32_t, std::vector<uint32_t>>> accesses;
+    std::map<const module::Module*, uint32_t> last_of_module;
+    std::vector<std::set<uint32_t>> preds(tasks.size());
+    for (uint32_t t = 0; t < (uint32_t)tasks.size(); t++)
+    {
+        const module::Module* mdl = &tasks[t]->get_module();
+        if (last_of_module.count(mdl)) preds[t].insert(last_of_module[mdl]);
+        last_of_module[mdl] = t;
+
+        for (auto& s : tasks[t]->sockets)
+        {
+            auto it = accesses.insert(std::make_pair(data_of(s.get()), std::make_pair(-1, std::vector<uint32_t>())));
+            auto& access = it.first->second;
+            if (access.first >= 0) preds[t].insert((uint32_t)access.first);
+            if (s->get_type() != socket_t::SIN)
+            {
+                preds[t].insert(access.second.begin(), access.second.end());
+                access.first = (int32_t)t;
+                access.second.clear();
+            }
+            else
+                access.second.push_back(t);
+        }
+        preds[t].erase(t);
+    }
+
+    // when each task depends on the previous one, the tasks can only be executed sequentially
+    bool parallel = false;
+    for (size_t t = 1; t < tasks.size() && !parallel; t++)
+        parallel = !preds[t].count((uint32_t)(t - 1));
+    if (!parallel) return false;
+
+    block.n_preds.resize(tasks.size());
+    block.succs.assign(tasks.size(), std::vector<uint32_t>());
+    block.roots.clear();
+    for (uint32_t t = 0; t < (uint32_t)tasks.size(); t++)
+    {
+        block.n_preds[t] = (uint32_t)preds[t].size();
+        for (auto p : preds[t])
+            block.succs[p].push_back(t);
+        if (preds[t].empty()) block.roots.push_back(t);
+    }
+    return true;
+}
+
+void
+Sequence::dag_work(const size_t tid)
+{
+    auto& state = *this->dag_states[tid];
+    const auto& block = *state.block;
+    const size_t spin_budget = tools::Thread_barrier_standard::default_spin_budget();
+    while (!state.aborted.load(std::memory_order_relaxed))
+    {
+        const size_t slot = state.n_claimed.fetch_add(1, std::memory_order_relaxed);
+        if (slot >= state.n_tasks) return;
+
+        // the slot will be filled: the tasks in the previous slots are executed or being executed and one of them
+        // makes the next task ready
+        int32_t t;
+        size_t n_spins = 0;
+        while ((t = state.ready[slot].load(std::memory_order_acquire)) < 0)
+        {
+            if (state.aborted.load(std::memory_order_relaxed)) return;
+            if (n_spins++ < spin_budget)
+                tools::cpu_relax();
+            else
+                std::this_thread::yield();
+        }
+
+        try
+        {
+            state.exec_fn(state.exec_ctx, state.instrs[t]);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(state.mtx_exception);
+            if (!state.exception) state.exception = std::current_exception();
+            state.aborted = true;
+            return;
+        }
+
+        for (auto s : block.succs[t])
+            if (state.remaining[s].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                state.ready[state.n_ready.fetch_add(1, std::memory_order_relaxed)].store(
+                  (int32_t)s, std::memory_order_release);
+    }
+}
+
+void
+Sequence::reset_no_copy_mode(const size_t first_tid)
+{
+    // the saved data pointers are outdated for the sockets that have been bound again since the generation of the
+    // processes, they have to take the data pointer of their new bound socket
+    const bool bindings_modified = this->no_copy_bindings_generation != Socket::get_bindings_generation();
+    std::vector<runtime::Socket*> restored_sockets;
+
+    std::function<void(tools::Digraph_node<Sub_sequence>*, std::vector<tools::Digraph_node<Sub_sequence>*>&)>
+      reset_no_copy_mode_recursive =
+        [&reset_no_copy_mode_recursive, bindings_modified, &restored_sockets](
+          tools::Digraph_node<Sub_sequence>* cur_node,
+          std::vector<tools::Digraph_node<Sub_sequence>*>& already_parsed_nodes)
+    {
+        if (cur_node != nullptr &&
+            std::find(already_parsed_nodes.begin(), already_parsed_nodes.end(), cur_node) == already_parsed_nodes.end())
+        {
+            already_parsed_nodes.push_back(cur_node);
+            auto contents = cur_node->get_c();
+            for (auto task : contents->tasks)
+            {
+                if (dynamic_cast<module::Switcher*>(&task->get_module()) &&
+                    task->get_name().find("select") != std::string::npos)
+                {
+                    auto select_task = task;
+                    auto switcher = dynamic_cast<module::Switcher*>(&select_task->get_module());
+                    switcher->set_no_copy_select(false);
+                }
+
+                if (dynamic_cast<module::Switcher*>(&task->get_module()) &&
+                    task->get_name().find("commute") != std::string::npos)
+                {
+                    auto commute_task = task;
+                    auto switcher = dynamic_cast<module::Switcher*>(&commute_task->get_module());
+                    switcher->set_no_copy_commute(false);
+                }
+
+                if (dynamic_cast<module::Adaptor_m_to_n*>(&task->get_module()) &&
+                    task->get_name().find("pull") != std::string::npos)
+                {
+                    auto pull_task = task;
+                    auto adp_pull = dynamic_cast<module::Adaptor_m_to_n*>(&pull_task->get_module());
+                    adp_pull->set_no_copy_pull(false);
+                    adp_pull->reset_buffer();
+                }
+
+                if (dynamic_cast<module::Adaptor_m_to_n*>(&task->get_module()) &&
+                    task->get_name().find("push") != std::string::npos)
+                {
+                    auto push_task = task;
+                    auto adp_push = dynamic_cast<module::Adaptor_m_to_n*>(&push_task->get_module());
+                    adp_push->set_no_copy_push(false);
+                    adp_push->reset_buffer();
+                }
+            }
+
+            for (size_t rebind_id = 0; rebind_id < contents->rebind_sockets.size(); rebind_id++)
+                for (size_t s = 0; s < contents->rebind_sockets[rebind_id].size(); s++)
+                    for (size_t ta = 0; ta < contents->rebind_sockets[rebind_id][s].size(); ta++)
+                    {
+                        contents->rebind_sockets[rebind_id][s][ta]->dataptr =
+                          contents->rebind_dataptrs[rebind_id][s][ta];
+                        if (bindings_modified) restored_sockets.push_back(contents->rebind_sockets[rebind_id][s][ta]);
+                    }
+
+            for (auto c : cur_node->get_children())
+                reset_no_copy_mode_recursive(c, already_parsed_nodes);
+        }
+    };
+
+    for (size_t tid = first_tid; tid < this->sequences.size(); tid++)
     {
         std::vector<tools::Digraph_node<Sub_sequence>*> already_parsed_nodes;
-        reset_no_copy_mode_recursive(sequence, already_parsed_nodes);
+        reset_no_copy_mode_recursive(this->sequences[tid], already_parsed_nodes);
+    }
+
+    // the bindings do not contain cycles: the data pointers are propagated from the output sockets to the input
+    // sockets until nothing changes
+    bool propagated = !restored_sockets.empty();
+    while (propagated)
+    {
+        propagated = false;
+        for (auto sck : restored_sockets)
+            if (sck->bound_socket != nullptr && sck->dataptr != sck->bound_socket->dataptr)
+            {
+                sck->dataptr = sck->bound_socket->dataptr;
+                propagated = true;
+            }
+    }
+    this->no_copy_processes = false;
+}
+
+void
+Sequence::leave_no_copy_processes()
+{
+    if (this->no_copy_processes)
+    {
+        this->reset_no_copy_mode();
+        this->gen_processes(false);
     }
 }
 
 void
 Sequence::set_no_copy_mode(const bool no_copy_mode)
 {
+    this->check_no_exec_async("Modifying the no-copy mode");
     this->no_copy_mode = no_copy_mode;
+    if (!no_copy_mode) this->leave_no_copy_processes();
 }
 
 bool
@@ -2286,6 +3090,71 @@ Sequence::is_auto_stop() const
     return this->auto_stop;
 }
 
+void
+Sequence::set_n_dag_workers(const size_t n_dag_workers, const std::vector<size_t>& dag_puids)
+{
+    if (!dag_puids.empty() && dag_puids.size() != this->n_threads * n_dag_workers)
+    {
+        std::stringstream message;
+        message << "'dag_puids.size()' has to be equal to 'n_threads' * 'n_dag_workers' or to 0 ('dag_puids.size()' = "
+                << dag_puids.size() << ", 'n_threads' = " << this->n_threads
+                << ", 'n_dag_workers' = " << n_dag_workers << ").";
+        throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    this->n_dag_workers = n_dag_workers;
+    this->dag_puids = dag_puids;
+    this->dag_pools.clear();
+    this->dag_pools.resize(n_dag_workers ? this->sequences.size() : 0);
+    for (size_t tid = 0; tid < this->dag_pools.size(); tid++)
+    {
+        // each worker is pinned on its own PU, the workers are left unpinned when no PU is given (pinning them like
+        // the thread of the replicated sequence would run all the independent tasks on the same PU)
+        std::function<void(const size_t)> func_init = [this, tid](const size_t wid)
+        {
+            if (!this->dag_puids.empty()) tools::Thread_pinning::pin(this->dag_puids[tid * this->n_dag_workers + wid]);
+        };
+        std::function<void(const size_t)> func_deinit = [this](const size_t)
+        {
+            if (!this->dag_puids.empty()) tools::Thread_pinning::unpin();
+        };
+        std::function<void(const size_t)> func_exec = [this, tid](const size_t) { this->dag_work(tid); };
+
+        this->dag_pools[tid].reset(new tools::Thread_pool_standard(n_dag_workers));
+        this->dag_pools[tid]->set_func_init(func_init);
+        this->dag_pools[tid]->set_func_deinit(func_deinit);
+        this->dag_pools[tid]->set_func_exec(func_exec);
+        this->dag_pools[tid]->init(); // threads are spawned here
+    }
+    this->gen_plans();
+}
+
+void
+Sequence::set_fusion(const bool fusion)
+{
+    this->fusion = fusion;
+    this->gen_processes();
+}
+
+bool
+Sequence::is_fusion() const
+{
+    return this->fusion;
+}
+
+void
+Sequence::set_frames_tiling(const bool frames_tiling)
+{
+    this->frames_tiling = frames_tiling;
+    this->gen_processes();
+}
+
+bool
+Sequence::is_frames_tiling() const
+{
+    return this->frames_tiling;
+}
+
 Sub_sequence*
 Sequence::get_last_subsequence(const size_t tid)
 {
@@ -2414,6 +3283,302 @@ Sequence::update_firsts_and_lasts_tasks()
     }
 }
 
+void
+Sequence::check_no_exec_async(const std::string& action) const
+{
+    if (this->async_state)
+    {
+        std::lock_guard<std::mutex> lock(this->async_state->mtx);
+        if (this->async_state->running)
+        {
+            std::stringstream message;
+            message << action << " during an asynchronous execution of the sequence is not possible.";
+            throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+        }
+    }
+}
+
+void
+Sequence::set_n_threads(const size_t n_threads)
+{
+    if (n_threads == 0)
+    {
+        std::stringstream message;
+        message << "'n_threads' has to be strictly greater than 0.";
+        throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (n_threads == this->n_threads) return;
+
+    if (this->is_part_of_pipeline)
+    {
+        std::stringstream message;
+        message << "The number of threads of a pipeline stage can't be modified.";
+        throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (this->is_thread_pinning())
+    {
+        const auto n_pins = this->puids.empty() ? this->pin_objects_per_thread.size() : this->puids.size();
+        if (n_pins < n_threads)
+        {
+            std::stringstream message;
+            message << "The thread pinning has to be defined for each thread ('n_pins' = " << n_pins
+                    << ", 'n_threads' = " << n_threads << ").";
+            throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+        }
+    }
+
+    this->check_no_exec_async("Modifying the number of threads");
+    this->leave_no_copy_processes();
+
+    const auto old_n_threads = this->n_threads;
+    const size_t n_inplace = this->tasks_inplace ? 1 : 0;
+    if (n_threads < old_n_threads)
+    {
+        // the last replicated sequences are deleted, the others are kept as is
+        for (size_t tid = n_threads; tid < old_n_threads; tid++)
+        {
+            std::vector<tools::Digraph_node<Sub_sequence>*> already_deleted_nodes;
+            this->delete_tree(this->sequences[tid], already_deleted_nodes);
+            this->modules[tid - n_inplace].clear();
+        }
+        this->n_threads = n_threads;
+        this->sequences.resize(n_threads);
+        this->modules.resize(n_threads);
+        this->all_modules.resize(n_threads);
+    }
+    else
+    {
+        // only the new replicated sequences are created, from the first one
+        this->n_threads = n_threads;
+        this->sequences.resize(n_threads, nullptr);
+        this->modules.resize(n_threads);
+        this->all_modules.resize(n_threads);
+        this->replicate<runtime::Sub_sequence, module::Module>(this->sequences[0], old_n_threads);
+    }
+
+    this->switchers_reset.resize(n_threads);
+    for (size_t tid = old_n_threads; tid < n_threads; tid++)
+        for (auto& mdl : this->all_modules[tid])
+            if (auto swi = dynamic_cast<module::Switcher*>(mdl))
+                this->switchers_reset[tid].push_back(dynamic_cast<tools::Interface_reset*>(swi));
+
+    this->next_round_is_over.resize(n_threads, false);
+    this->cur_task_id.resize(n_threads, 0);
+    this->cur_ss.resize(n_threads, nullptr);
+    for (size_t tid = old_n_threads; tid < n_threads; tid++)
+        this->cur_ss[tid] = this->sequences[tid];
+
+    this->update_firsts_and_lasts_tasks();
+    this->donners = get_modules<tools::Interface_is_done>(true);
+    if (this->n_dag_workers)
+    {
+        // the PUs of the workers of the removed replicated sequences are dropped, all the workers are left unpinned
+        // when replicated sequences are added (the PUs of their workers are unknown)
+        std::vector<size_t> dag_puids;
+        if (this->dag_puids.size() >= n_threads * this->n_dag_workers)
+            dag_puids.assign(this->dag_puids.begin(), this->dag_puids.begin() + n_threads * this->n_dag_workers);
+        this->set_n_dag_workers(this->n_dag_workers, dag_puids);
+    }
+    this->gen_processes();
+
+    this->thread_pool.reset(new tools::Thread_pool_standard(this->n_threads - 1));
+    this->thread_pool->init(); // threads are spawned here
+}
+
+void
+Sequence::replace_module(const module::Module& old_module, module::Module& new_module)
+{
+    size_t mid = 0;
+    while (mid < this->all_modules[0].size() && this->all_modules[0][mid] != &old_module)
+        mid++;
+
+    if (mid == this->all_modules[0].size())
+    {
+        std::stringstream message;
+        message << "'old_module' can't be found in the sequence ('old_module.get_custom_name()' = "
+                << old_module.get_custom_name() << ").";
+        throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (this->is_part_of_pipeline)
+    {
+        std::stringstream message;
+        message << "The modules of a pipeline stage can't be replaced.";
+        throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (dynamic_cast<const module::Switcher*>(&old_module) || dynamic_cast<module::Switcher*>(&new_module) ||
+        dynamic_cast<const module::Adaptor_m_to_n*>(&old_module) ||
+        dynamic_cast<module::Adaptor_m_to_n*>(&new_module) || dynamic_cast<const module::Set*>(&old_module) ||
+        dynamic_cast<module::Set*>(&new_module))
+    {
+        std::stringstream message;
+        message << "The 'Switcher', 'Adaptor_m_to_n' and 'Set' modules can't be replaced ('old_module.get_name()' = "
+                << old_module.get_name() << ", 'new_module.get_name()' = " << new_module.get_name() << ").";
+        throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (new_module.get_n_frames() != old_module.get_n_frames()) new_module.set_n_frames(old_module.get_n_frames());
+
+    // the two modules have to expose the same tasks and the same sockets, the sockets of the new module can't be bound
+    bool match = old_module.tasks.size() == new_module.tasks.size() &&
+                 old_module.get_n_frames_per_wave() == new_module.get_n_frames_per_wave();
+    for (size_t ta = 0; match && ta < old_module.tasks.size(); ta++)
+    {
+        auto& t_old = *old_module.tasks[ta];
+        auto& t_new = *new_module.tasks[ta];
+        match = t_old.get_name() == t_new.get_name() && t_old.sockets.size() == t_new.sockets.size() &&
+                t_new.fake_input_sockets.empty();
+        for (size_t s = 0; match && s < t_old.sockets.size(); s++)
+        {
+            auto& s_old = *t_old.sockets[s];
+            auto& s_new = *t_new.sockets[s];
+            match = s_old.get_name() == s_new.get_name() && s_old.get_type() == s_new.get_type() &&
+                    s_old.get_datatype() == s_new.get_datatype() && s_old.get_databytes() == s_new.get_databytes() &&
+                    s_new.bound_socket == nullptr && s_new.bound_sockets.empty();
+        }
+    }
+
+    if (!match)
+    {
+        std::stringstream message;
+        message << "The tasks, the sockets and the number of frames per wave of 'new_module' have to match the ones "
+                << "of 'old_module' and the sockets of 'new_module' can't be bound ('old_module.get_name()' = "
+                << old_module.get_name() << ", 'new_module.get_name()' = " << new_module.get_name() << ").";
+        throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    this->check_no_exec_async("Replacing a module");
+    this->leave_no_copy_processes();
+
+    std::function<void(tools::Digraph_node<Sub_sequence>*,
+                       const module::Module*,
+                       module::Module*,
+                       std::vector<tools::Digraph_node<Sub_sequence>*>&)>
+      replace_tasks_recursive = [&replace_tasks_recursive](tools::Digraph_node<Sub_sequence>* cur_node,
+                                                           const module::Module* old_m,
+                                                           module::Module* new_m,
+                                                           std::vector<tools::Digraph_node<Sub_sequence>*>& parsed)
+    {
+        if (cur_node != nullptr && std::find(parsed.begin(), parsed.end(), cur_node) == parsed.end())
+        {
+            parsed.push_back(cur_node);
+            for (auto& t : cur_node->get_c()->tasks)
+                if (&t->get_module() == old_m)
+                    for (size_t ta = 0; ta < old_m->tasks.size(); ta++)
+                        if (old_m->tasks[ta].get() == t)
+                        {
+                            t = new_m->tasks[ta].get();
+                            break;
+                        }
+            for (auto c : cur_node->get_children())
+                replace_tasks_recursive(c, old_m, new_m, parsed);
+        }
+    };
+
+    for (size_t tid = 0; tid < this->n_threads; tid++)
+    {
+        auto old_m = this->all_modules[tid][mid];
+
+        // the old clone is kept alive until its sockets are unbound
+        std::shared_ptr<module::Module> old_clone;
+        module::Module* new_m = &new_module;
+        if (tid != 0 || !this->tasks_inplace)
+        {
+            if (this->is_thread_pinning())
+            {
+                if (!this->puids.empty())
+                    tools::Thread_pinning::pin(this->puids[tid]);
+                else
+                    tools::Thread_pinning::pin(this->pin_objects_per_thread[tid]);
+            }
+
+            auto& slot = this->modules[tid - (this->tasks_inplace ? 1 : 0)][mid];
+            old_clone = slot;
+            slot.reset(new_module.clone());
+            new_m = slot.get();
+
+            if (this->is_thread_pinning()) tools::Thread_pinning::unpin();
+        }
+
+        for (size_t ta = 0; ta < old_m->tasks.size(); ta++)
+        {
+            auto& t_old = *old_m->tasks[ta];
+            auto& t_new = *new_m->tasks[ta];
+            // the new task is configured like the old one (the statistics start from zero)
+            if (t_new.is_autoalloc() != t_old.is_autoalloc()) t_new.set_autoalloc(t_old.is_autoalloc());
+            t_new.set_stats(t_old.is_stats());
+            t_new.set_stats_sampling(t_old.get_stats_period(), t_old.stats_random);
+            t_new.set_fast(t_old.is_fast());
+            t_new.set_debug(t_old.is_debug());
+            t_new.set_debug_hex(t_old.is_debug_hex());
+            t_new.set_debug_limit((uint32_t)t_old.debug_limit);
+            t_new.set_debug_precision(t_old.debug_precision);
+            t_new.set_debug_frame_max((uint32_t)t_old.debug_frame_max);
+            if (t_new.is_frame_meta() != t_old.is_frame_meta()) t_new.set_frame_meta(t_old.is_frame_meta());
+
+            for (size_t s = 0; s < t_old.sockets.size(); s++)
+            {
+                auto& s_old = *t_old.sockets[s];
+                auto& s_new = *t_new.sockets[s];
+
+                // the socket that feeds the old socket now feeds the new one
+                if ((s_old.get_type() == socket_t::SIN || s_old.get_type() == socket_t::SFWD) &&
+                    s_old.bound_socket != nullptr)
+                {
+                    auto& s_out = *s_old.bound_socket;
+                    s_old.unbind(s_out);
+                    s_new = s_out;
+                }
+
+                // the sockets (and the tasks) fed by the old socket are now fed by the new one
+                if (s_old.get_type() == socket_t::SOUT || s_old.get_type() == socket_t::SFWD)
+                {
+                    auto bound_sockets_cpy = s_old.get_bound_sockets();
+                    for (auto s_in : bound_sockets_cpy)
+                    {
+                        auto& t_in = s_in->get_task();
+                        auto is_fake = std::find_if(t_in.fake_input_sockets.begin(),
+                                                    t_in.fake_input_sockets.end(),
+                                                    [s_in](const std::shared_ptr<runtime::Socket>& fsi)
+                                                    { return fsi.get() == s_in; }) != t_in.fake_input_sockets.end();
+                        if (is_fake)
+                        {
+                            t_in.unbind(s_old);
+                            t_in = s_new;
+                        }
+                        else
+                        {
+                            s_in->unbind(s_old);
+                            *s_in = s_new;
+                        }
+                    }
+                }
+            }
+
+            // the tasks bindings of the old task
+            std::vector<runtime::Socket*> fake_bound_sockets;
+            for (auto& fsi : t_old.fake_input_sockets)
+                fake_bound_sockets.push_back(fsi->bound_socket);
+            for (auto s_out : fake_bound_sockets)
+            {
+                t_old.unbind(*s_out);
+                t_new = *s_out;
+            }
+        }
+
+        std::vector<tools::Digraph_node<Sub_sequence>*> already_parsed_nodes;
+        replace_tasks_recursive(this->sequences[tid], old_m, new_m, already_parsed_nodes);
+        this->all_modules[tid][mid] = new_m;
+    }
+
+    this->update_firsts_and_lasts_tasks();
+    this->donners = get_modules<tools::Interface_is_done>(true);
+    this->gen_processes();
+}
+
 void
 Sequence::_set_n_frames_unbind(std::vector<std::pair<runtime::Socket*, runtime::Socket*>>& unbind_sockets,
                                std::vector<std::pair<runtime::Task*, runtime::Socket*>>& unbind_tasks)
@@ -2490,6 +3655,94 @@ Sequence::_set_n_frames(const size_t n_frames)
             m->set_n_frames(n_frames);
 }
 
+bool
+Sequence::_set_n_frames_in_place(const size_t n_frames)
+{
+    // the bindings are kept when the output buffers already have the capacity for 'n_frames' frames (their data
+    // pointers do not move) and when no socket is bound to a socket of another sequence
+    const size_t old_n_frames = this->get_n_frames();
+    std::set<const module::Module*> modules;
+    for (auto& mm : this->all_modules)
+        for (auto& m : mm)
+            modules.insert(m);
+
+    std::vector<runtime::Socket*> sockets;
+    std::vector<runtime::Socket*> fake_sockets;
+    for (auto& mm : this->all_modules)
+        for (auto& m : mm)
+            for (auto& tsk : m->tasks)
+            {
+                size_t sout_id = 0;
+                for (auto& s : tsk->sockets)
+                {
+                    if (tsk->is_autoalloc() && s->get_type() == socket_t::SOUT && s->get_name() != "status")
+                    {
+                        const size_t new_databytes = (s->get_databytes() / old_n_frames) * n_frames;
+                        if (tsk->out_buffers[sout_id++].capacity() < new_databytes) return false;
+                    }
+                    sockets.push_back(s.get());
+                }
+                for (auto& fs : tsk->fake_input_sockets)
+                    fake_sockets.push_back(fs.get());
+            }
+
+    for (auto s : sockets)
+    {
+        if (s->bound_socket != nullptr && !modules.count(&s->bound_socket->get_task().get_module())) return false;
+        for (auto bs : s->bound_sockets)
+            if (!modules.count(&bs->get_task().get_module())) return false;
+    }
+    for (auto fs : fake_sockets)
+        if (fs->bound_socket != nullptr && !modules.count(&fs->bound_socket->get_task().get_module())) return false;
+
+    // the bindings are hidden during the update of the modules (a bound socket can't be resized) and restored after
+    std::vector<runtime::Socket*> bound_socket(sockets.size());
+    std::vector<std::vector<runtime::Socket*>> bound_sockets(sockets.size());
+    for (size_t i = 0; i < sockets.size(); i++)
+    {
+        bound_socket[i] = sockets[i]->bound_socket;
+        sockets[i]->bound_socket = nullptr;
+        std::swap(bound_sockets[i], sockets[i]->bound_sockets);
+    }
+    auto restore = [&sockets, &bound_socket, &bound_sockets]()
+    {
+        for (size_t i = 0; i < sockets.size(); i++)
+        {
+            sockets[i]->bound_socket = bound_socket[i];
+            std::swap(bound_sockets[i], sockets[i]->bound_sockets);
+        }
+    };
+
+    try
+    {
+        this->_set_n_frames(n_frames);
+    }
+    catch (...)
+    {
+        restore();
+        throw;
+    }
+    restore();
+
+    // the fake input sockets of the tasks are not updated by the modules
+    for (auto fs : fake_sockets)
+        if (fs->bound_socket != nullptr) fs->databytes = fs->bound_socket->databytes;
+
+    // a module can reallocate its own buffers: in this case the bound sockets are refreshed by a full rebinding
+    bool moved = false;
+    for (auto s : sockets)
+        moved |= s->bound_socket != nullptr && s->dataptr != s->bound_socket->dataptr;
+    if (moved)
+    {
+        std::vector<std::pair<runtime::Socket*, runtime::Socket*>> unbind_sockets;
+        std::vector<std::pair<runtime::Task*, runtime::Socket*>> unbind_tasks;
+        this->_set_n_frames_unbind(unbind_sockets, unbind_tasks);
+        this->_set_n_frames_rebind(unbind_sockets, unbind_tasks);
+    }
+
+    return true;
+}
+
 void
 Sequence::_set_n_frames_rebind(const std::vector<std::pair<runtime::Socket*, runtime::Socket*>>& unbind_sockets,
                                const std::vector<std::pair<runtime::Task*, runtime::Socket*>>& unbind_tasks)
@@ -2506,9 +3759,13 @@ Sequence::_set_n_frames_rebind(const std::vector<std::pair<runtime::Socket*, run
 void
 Sequence::set_n_frames(const size_t n_frames)
 {
+    this->check_no_exec_async("Modifying the number of frames");
     const auto old_n_frames = this->get_n_frames();
     if (old_n_frames != n_frames)
     {
+        this->leave_no_copy_processes();
+        if (this->_set_n_frames_in_place(n_frames)) return;
+
         std::vector<std::pair<runtime::Socket*, runtime::Socket*>> unbind_sockets;
         std::vector<std::pair<runtime::Task*, runtime::Socket*>> unbind_tasks;
         this->_set_n_frames_unbind(unbind_sockets, unbind_tasks);
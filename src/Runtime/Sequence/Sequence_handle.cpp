@@ -0,0 +1,50 @@
+#include "Runtime/Sequence/Sequence_handle.hpp"
+#include "Runtime/Sequence/Sequence.hpp"
+
+using namespace spu;
+using namespace spu::runtime;
+
+Sequence_handle::Sequence_handle(std::shared_ptr<exec_async_state_t> state)
+  : state(state)
+{
+}
+
+void
+Sequence_handle::wait() const
+{
+    this->state->done.get();
+}
+
+bool
+Sequence_handle::wait_for(const std::chrono::nanoseconds timeout) const
+{
+    return this->state->done.wait_for(timeout) == std::future_status::ready;
+}
+
+void
+Sequence_handle::cancel()
+{
+    std::lock_guard<std::mutex> lock(this->state->mtx);
+    if (this->state->canceled) return;
+    this->state->canceled = true;
+    if (this->state->running && this->state->sequence) this->state->sequence->cancel_exec();
+}
+
+bool
+Sequence_handle::is_done() const
+{
+    return this->wait_for(std::chrono::nanoseconds(0));
+}
+
+bool
+Sequence_handle::is_canceled() const
+{
+    std::lock_guard<std::mutex> lock(this->state->mtx);
+    return this->state->canceled;
+}
+
+size_t
+Sequence_handle::get_n_execs() const
+{
+    return this->state->n_execs.load(std::memory_order_relaxed);
+}
@@ -10,6 +10,7 @@
 #include "Runtime/Socket/Socket.hpp"
 #include "Runtime/Task/Task.hpp"
 #include "Tools/Exception/exception.hpp"
+#include "Tools/System/Clock.hpp"
 
 using namespace spu;
 using namespace spu::runtime;
@@ -28,6 +29,7 @@ Task::Task(module::Module& module,
   , debug(debug)
   , debug_hex(false)
   , replicable(module.is_clonable())
+  , partial_waves(false)
   , debug_limit(-1)
   , debug_precision(2)
   , debug_frame_max(-1)
@@ -42,11 +44,20 @@ Task::Task(module::Module& module,
   , n_fwd_sockets(0)
   , status(module.get_n_waves())
   , n_calls(0)
+  , n_calls_stats(0)
+  , n_calls_timed(0)
+  , stats_period(1)
+  , stats_random(false)
+  , stats_countdown(1)
+  , stats_rng(2463534242u)
   , duration_total(std::chrono::nanoseconds(0))
   , duration_min(std::chrono::nanoseconds(0))
   , duration_max(std::chrono::nanoseconds(0))
   , last_input_socket(nullptr)
+  , frames_meta_seq(0)
+  , n_frames_cur_wave(module.get_n_frames_per_wave())
 {
+    if (this->stats) this->duration_hist.allocate();
 }
 
 Socket&
@@ -98,6 +109,22 @@ void
 Task::set_stats(const bool stats)
 {
     this->stats = stats;
+    if (this->stats) this->duration_hist.allocate();
+}
+
+void
+Task::set_stats_sampling(const uint32_t period, const bool random)
+{
+    if (period == 0)
+    {
+        std::stringstream message;
+        message << "'period' has to be greater than 0.";
+        throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    this->stats_period = period;
+    this->stats_random = random;
+    this->stats_countdown = 1;
 }
 
 void
@@ -259,9 +286,65 @@ display_data(const T* data,
     std::cout.flags(f);
 }
 
+void
+Task::record_duration(const std::chrono::nanoseconds& duration)
+{
+    this->duration_total += duration;
+    this->duration_hist.record((uint64_t)duration.count());
+    if (this->n_calls_timed)
+    {
+        this->duration_min = std::min(this->duration_min, duration);
+        this->duration_max = std::max(this->duration_max, duration);
+    }
+    else
+    {
+        this->duration_min = duration;
+        this->duration_max = duration;
+    }
+    this->n_calls_timed++;
+}
+
+void
+Task::update_frame_meta(const int frame_id)
+{
+    const size_t n_frames = this->get_module().get_n_frames();
+    const size_t f_start = frame_id < 0 ? 0 : (size_t)frame_id % n_frames;
+    const size_t f_stop = frame_id < 0 ? n_frames : f_start + 1;
+
+    // the metadata are forwarded from the first input socket bound to a task that carries metadata
+    const frame_meta_t* meta_in = nullptr;
+    for (auto& s : this->sockets)
+        if ((s->type == socket_t::SIN || s->type == socket_t::SFWD) && s->bound_socket != nullptr &&
+            (meta_in = s->bound_socket->task.get_frame_meta()) != nullptr)
+            break;
+    if (meta_in == nullptr)
+        for (auto& s : this->fake_input_sockets)
+            if (s->bound_socket != nullptr && (meta_in = s->bound_socket->task.get_frame_meta()) != nullptr) break;
+
+    if (meta_in != nullptr)
+        std::copy(meta_in + f_start, meta_in + f_stop, this->frames_meta.begin() + f_start);
+    else // there is no metadata upstream: the frames are ingested by this task
+    {
+        const int64_t ts = (int64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::steady_clock::now().time_since_epoch())
+                             .count();
+        for (size_t f = f_start; f < f_stop; f++)
+            this->frames_meta[f] = { this->frames_meta_seq++, ts };
+    }
+}
+
+void
+Task::copy_frame_meta(const frame_meta_t* meta)
+{
+    if (meta != nullptr && !this->frames_meta.empty())
+        std::copy(meta, meta + this->frames_meta.size(), this->frames_meta.begin());
+}
+
 void
 Task::_exec(const int frame_id, const bool managed_memory)
 {
+    if (!this->frames_meta.empty()) this->update_frame_meta(frame_id);
+
     const auto n_frames = this->get_module().get_n_frames();
     const auto n_frames_per_wave = this->get_module().get_n_frames_per_wave();
     const auto n_waves = this->get_module().get_n_waves();
@@ -279,8 +362,25 @@ Task::_exec(const int frame_id, const bool managed_memory)
     {
         const auto real_frame_id = frame_id == -1 ? 0 : frame_id;
         const size_t w = (real_frame_id % n_frames) / n_frames_per_wave;
+        this->n_frames_cur_wave = n_frames_per_wave;
         status[w] = this->codelet(*this->module, *this, real_frame_id);
     }
+    else if (frame_id > 0 && managed_memory == true && n_frames_per_wave > 1 && this->partial_waves)
+    {
+        // the codelet processes the single frame in place
+        const size_t f = frame_id % n_frames;
+        for (size_t sid = 0; sid < this->sockets.size() - 1; sid++)
+        {
+            sockets_dataptr_init[sid] = (int8_t*)this->sockets[sid]->_get_dataptr();
+            this->sockets[sid]->dataptr = (void*)(sockets_dataptr_init[sid] + f * sockets_databytes_per_frame[sid]);
+        }
+
+        this->n_frames_cur_wave = 1;
+        status[f / n_frames_per_wave] = this->codelet(*this->module, *this, f);
+
+        for (size_t sid = 0; sid < this->sockets.size() - 1; sid++)
+            this->sockets[sid]->dataptr = (void*)sockets_dataptr_init[sid];
+    }
     else
     {
         // save the initial dataptr of the sockets
@@ -302,6 +402,7 @@ Task::_exec(const int frame_id, const bool managed_memory)
                 this->sockets[sid]->dataptr = (void*)sockets_data[sid].data();
             }
 
+            this->n_frames_cur_wave = n_frames_per_wave;
             status[w] = this->codelet(*this->module, *this, w * n_frames_per_wave);
 
             for (size_t sid = 0; sid < this->sockets.size() - 1; sid++)
@@ -314,64 +415,109 @@ Task::_exec(const int frame_id, const bool managed_memory)
         {
             const size_t w_start = (frame_id < 0) ? 0 : frame_id % n_waves;
             const size_t w_stop = (frame_id < 0) ? n_waves : w_start + 1;
+            this->_exec_waves(w_start, w_stop);
+        }
 
-            size_t w = 0;
-            auto exec_status = status_t::SUCCESS;
-            for (w = w_start; w < w_stop - 1 && exec_status != status_t::FAILURE_STOP; w++)
-            {
-                for (size_t sid = 0; sid < this->sockets.size() - 1; sid++)
-                    this->sockets[sid]->dataptr =
-                      (void*)(sockets_dataptr_init[sid] + w * n_frames_per_wave * sockets_databytes_per_frame[sid]);
+        // restore the initial dataptr of the sockets
+        for (size_t sid = 0; sid < this->sockets.size() - 1; sid++)
+            this->sockets[sid]->dataptr = (void*)sockets_dataptr_init[sid];
+    }
+}
 
-                status[w] = this->codelet(*this->module, *this, w * n_frames_per_wave);
-                exec_status = (status_t)status[w];
-            }
+void
+Task::_exec_waves(const size_t w_start, const size_t w_stop)
+{
+    const auto n_frames = this->get_module().get_n_frames();
+    const auto n_frames_per_wave = this->get_module().get_n_frames_per_wave();
+    const auto n_waves = this->get_module().get_n_waves();
+    const auto n_frames_per_wave_rest = this->get_module().get_n_frames_per_wave_rest();
 
-            if (exec_status != status_t::FAILURE_STOP)
-            {
-                if (n_frames_per_wave_rest == 0)
-                {
-                    for (size_t sid = 0; sid < this->sockets.size() - 1; sid++)
-                        this->sockets[sid]->dataptr =
-                          (void*)(sockets_dataptr_init[sid] + w * n_frames_per_wave * sockets_databytes_per_frame[sid]);
+    int* status = this->sockets.back()->get_dataptr<int>();
+    auto exec_status = status_t::SUCCESS;
+    for (size_t w = w_start; w < w_stop && exec_status != status_t::FAILURE_STOP; w++)
+    {
+        // the last wave is incomplete when 'n_frames' is not a multiple of 'n_frames_per_wave', it is processed in
+        // place if the codelet supports the partial waves
+        const bool partial_wave = n_frames_per_wave_rest != 0 && w == n_waves - 1;
+        if (!partial_wave || this->partial_waves)
+        {
+            for (size_t sid = 0; sid < this->sockets.size() - 1; sid++)
+                this->sockets[sid]->dataptr =
+                  (void*)(sockets_dataptr_init[sid] + w * n_frames_per_wave * sockets_databytes_per_frame[sid]);
 
-                    status[w] = this->codelet(*this->module, *this, w * n_frames_per_wave);
-                }
-                else
-                {
-                    for (size_t sid = 0; sid < this->sockets.size() - 1; sid++)
-                    {
-                        if (sockets[sid]->get_type() == socket_t::SIN || sockets[sid]->get_type() == socket_t::SFWD)
-                            std::copy(sockets_dataptr_init[sid] +
-                                        w * n_frames_per_wave * sockets_databytes_per_frame[sid],
-                                      sockets_dataptr_init[sid] + n_frames * sockets_databytes_per_frame[sid],
-                                      sockets_data[sid].begin());
-                        this->sockets[sid]->dataptr = (void*)sockets_data[sid].data();
-                    }
+            this->n_frames_cur_wave = partial_wave ? n_frames_per_wave_rest : n_frames_per_wave;
+            status[w] = this->codelet(*this->module, *this, w * n_frames_per_wave);
+        }
+        else
+        {
+            for (size_t sid = 0; sid < this->sockets.size() - 1; sid++)
+            {
+                if (sockets[sid]->get_type() == socket_t::SIN || sockets[sid]->get_type() == socket_t::SFWD)
+                    std::copy(sockets_dataptr_init[sid] + w * n_frames_per_wave * sockets_databytes_per_frame[sid],
+                              sockets_dataptr_init[sid] + n_frames * sockets_databytes_per_frame[sid],
+                              sockets_data[sid].begin());
+                this->sockets[sid]->dataptr = (void*)sockets_data[sid].data();
+            }
 
-                    status[w] = this->codelet(*this->module, *this, w * n_frames_per_wave);
+            this->n_frames_cur_wave = n_frames_per_wave;
+            status[w] = this->codelet(*this->module, *this, w * n_frames_per_wave);
 
-                    for (size_t sid = 0; sid < this->sockets.size() - 1; sid++)
-                        if (sockets[sid]->get_type() == socket_t::SOUT || sockets[sid]->get_type() == socket_t::SFWD)
-                            std::copy(
-                              sockets_data[sid].begin(),
+            for (size_t sid = 0; sid < this->sockets.size() - 1; sid++)
+                if (sockets[sid]->get_type() == socket_t::SOUT || sockets[sid]->get_type() == socket_t::SFWD)
+                    std::copy(sockets_data[sid].begin(),
                               sockets_data[sid].begin() + n_frames_per_wave_rest * sockets_databytes_per_frame[sid],
                               sockets_dataptr_init[sid] + w * n_frames_per_wave * sockets_databytes_per_frame[sid]);
-                }
-            }
         }
+        exec_status = (status_t)status[w];
+    }
+}
+
+const std::vector<int>&
+Task::exec_waves(const size_t w_start, const size_t w_stop)
+{
+    const auto n_waves = this->get_module().get_n_waves();
+    if (w_start >= w_stop || w_stop > n_waves)
+    {
+        std::stringstream message;
+        message << "'w_start' has to be smaller than 'w_stop' and 'w_stop' can't be greater than 'n_waves' "
+                << "('w_start' = " << w_start << ", 'w_stop' = " << w_stop << ", 'n_waves' = " << n_waves << ").";
+        throw tools::out_of_range(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    // the call is counted on its first wave, then it is counted even if it is not executed until the last wave
+    if (w_start == 0)
+    {
+        if (!this->frames_meta.empty()) this->update_frame_meta(-1);
+        this->n_calls++;
+    }
+
+    int* status = this->sockets.back()->get_dataptr<int>();
+    for (size_t w = w_start; w < w_stop; w++)
+        status[w] = (int)status_t::UNKNOWN;
+
+    // the next waves are not executed once a wave returned 'FAILURE_STOP' (like in the 'exec' method)
+    const bool stopped = w_start > 0 && (status[w_start - 1] == (int)status_t::FAILURE_STOP ||
+                                         status[w_start - 1] == (int)status_t::UNKNOWN);
+    if (!stopped)
+    {
+        for (size_t sid = 0; sid < this->sockets.size() - 1; sid++)
+            sockets_dataptr_init[sid] = (int8_t*)this->sockets[sid]->_get_dataptr();
+
+        this->_exec_waves(w_start, w_stop);
 
-        // restore the initial dataptr of the sockets
         for (size_t sid = 0; sid < this->sockets.size() - 1; sid++)
             this->sockets[sid]->dataptr = (void*)sockets_dataptr_init[sid];
     }
+
+    return this->get_status();
 }
 
 const std::vector<int>&
 Task::exec(const int frame_id, const bool managed_memory)
 {
 #ifndef SPU_FAST
-    if (this->is_fast() && !this->is_debug() && !this->is_stats())
+    const bool timed = this->is_stats() && this->sample_call();
+    if (this->is_fast() && !this->is_debug() && !timed)
     {
 #endif
         this->_exec(frame_id, managed_memory);
@@ -537,23 +683,11 @@ Task::exec(const int frame_id, const bool managed_memory)
             }
         }
 
-        if (this->is_stats())
+        if (timed)
         {
-            auto t_start = std::chrono::steady_clock::now();
+            auto t_start = tools::Clock::now();
             this->_exec(frame_id, managed_memory);
-            auto duration = std::chrono::steady_clock::now() - t_start;
-
-            this->duration_total += duration;
-            if (n_calls)
-            {
-                this->duration_min = std::min(this->duration_min, duration);
-                this->duration_max = std::max(this->duration_max, duration);
-            }
-            else
-            {
-                this->duration_min = duration;
-                this->duration_max = duration;
-            }
+            this->record_duration(tools::Clock::now() - t_start);
         }
         else
         {
@@ -1079,6 +1213,8 @@ Task::create_codelet(std::function<int(module::Module& m, Task& t, const size_t
 void
 Task::update_n_frames(const size_t old_n_frames, const size_t new_n_frames)
 {
+    if (!this->frames_meta.empty()) this->frames_meta.resize(new_n_frames, { 0, 0 });
+
     size_t sout_id = 0;
     for (auto& s : this->sockets)
     {
@@ -1145,13 +1281,18 @@ Task::can_exec() const
 std::chrono::nanoseconds
 Task::get_duration_total() const
 {
-    return this->duration_total;
+    if (this->n_calls_timed == this->n_calls_stats) return this->duration_total;
+    if (this->n_calls_timed == 0) return std::chrono::nanoseconds(0);
+
+    // the calls are sampled: estimation of the duration of all the calls made with the stats enabled
+    const double scale = (double)this->n_calls_stats / (double)this->n_calls_timed;
+    return std::chrono::nanoseconds((std::chrono::nanoseconds::rep)((double)this->duration_total.count() * scale));
 }
 
 std::chrono::nanoseconds
 Task::get_duration_avg() const
 {
-    return this->duration_total / this->n_calls;
+    return this->n_calls_timed ? this->duration_total / this->n_calls_timed : std::chrono::nanoseconds(0);
 }
 
 std::chrono::nanoseconds
@@ -1166,6 +1307,18 @@ Task::get_duration_max() const
     return this->duration_max;
 }
 
+std::chrono::nanoseconds
+Task::get_duration_percentile(const float percentile) const
+{
+    return std::chrono::nanoseconds(this->duration_hist.get_percentile(percentile));
+}
+
+const tools::Histogram&
+Task::get_duration_histogram() const
+{
+    return this->duration_hist;
+}
+
 const std::vector<std::string>&
 Task::get_timers_name() const
 {
@@ -1228,9 +1381,13 @@ void
 Task::reset()
 {
     this->n_calls = 0;
+    this->n_calls_stats = 0;
+    this->n_calls_timed = 0;
+    this->stats_countdown = 1;
     this->duration_total = std::chrono::nanoseconds(0);
     this->duration_min = std::chrono::nanoseconds(0);
     this->duration_max = std::chrono::nanoseconds(0);
+    this->duration_hist.clear();
 
     for (auto& x : this->timers_n_calls)
         x = 0;
@@ -1488,6 +1645,21 @@ Task::set_replicability(const bool replicable)
     // this->replicable = replicable ? this->module->is_clonable() : false;
 }
 
+void
+Task::set_frame_meta(const bool frame_meta)
+{
+    if (frame_meta)
+        this->frames_meta.resize(this->get_module().get_n_frames(), { 0, 0 });
+    else
+        this->frames_meta.clear();
+}
+
+void
+Task::set_partial_waves(const bool partial_waves)
+{
+    this->partial_waves = partial_waves;
+}
+
 // ==================================================================================== explicit template instantiation
 template size_t
 Task::create_2d_socket_in<int8_t>(const std::string&, const size_t, const size_t);
@@ -42,6 +42,7 @@ Scheduler_from_file::Scheduler_from_file(runtime::Sequence& sequence, const std:
     }
 
     this->sync_buff_sizes_from_file.resize(sched_data.size() - 1, 1);
+    this->sync_buff_sizes_max_from_file.resize(sched_data.size() - 1, 0);
     this->sync_active_waitings_from_file.resize(sched_data.size() - 1, false);
 
     size_t n_tasks_json = 0;
@@ -106,6 +107,25 @@ Scheduler_from_file::Scheduler_from_file(runtime::Sequence& sequence, const std:
             this->sync_buff_sizes_from_file[d] = cur_buff_size;
         }
 
+        if (sched_data[d].contains("sync_buff_size_max"))
+        {
+            if (d == sched_data.size() - 1)
+            {
+                std::stringstream message;
+                message << "The 'sync_buff_size_max' field cannot be set on the last stage.";
+                throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+            }
+            if (!sched_data[d]["sync_buff_size_max"].is_number_unsigned())
+            {
+                std::stringstream message;
+                message << "Unexpected type for 'sync_buff_size_max' field (should be unsigned integer).";
+                throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+            }
+
+            size_t cur_buff_size_max(sched_data[d]["sync_buff_size_max"]);
+            this->sync_buff_sizes_max_from_file[d] = cur_buff_size_max;
+        }
+
         if (sched_data[d].contains("sync_waiting_type"))
         {
             if (d == sched_data.size() - 1)
@@ -165,6 +185,18 @@ Scheduler_from_file::get_sync_buff_sizes() const
     return this->sync_buff_sizes_from_file;
 }
 
+// the buffer sizes are fixed unless a 'sync_buff_size_max' field is given
+std::vector<std::pair<size_t, size_t>>
+Scheduler_from_file::get_sync_buff_size_bounds() const
+{
+    std::vector<std::pair<size_t, size_t>> bounds;
+    for (size_t s = 0; s < this->sync_buff_sizes_from_file.size(); s++)
+        bounds.push_back(std::make_pair(
+          this->sync_buff_sizes_from_file[s],
+          std::max(this->sync_buff_sizes_from_file[s], this->sync_buff_sizes_max_from_file[s])));
+    return bounds;
+}
+
 std::vector<bool>
 Scheduler_from_file::get_sync_active_waitings() const
 {
@@ -11,12 +11,18 @@ using namespace spu::sched;
 
 Scheduler::Scheduler(runtime::Sequence& sequence)
   : sequence(&sequence)
+  , profiling_period(1)
+  , profiling_random(false)
+  , sync_buff_size_max_factor(1)
 {
     this->sequence = &sequence;
 }
 
 Scheduler::Scheduler(runtime::Sequence* sequence)
   : sequence(sequence)
+  , profiling_period(1)
+  , profiling_random(false)
+  , sync_buff_size_max_factor(1)
 {
     if (sequence == nullptr)
     {
@@ -58,6 +64,7 @@ Scheduler::_profile(const int puid, const size_t n_exec)
         {
             tsk->reset();
             tsk->set_stats(true); // enable the statistics
+            tsk->set_stats_sampling(this->profiling_period, this->profiling_random);
             tsk->set_fast(true);  // enable the fast mode (= disable the useless verifs
                                   // in the tasks)
         }
@@ -161,6 +168,33 @@ Scheduler::profile(const std::vector<size_t>& puids, const size_t n_exec)
     this->profiled_puids = puids;
 }
 
+void
+Scheduler::set_profiling_sampling(const uint32_t period, const bool random)
+{
+    if (period == 0)
+    {
+        std::stringstream message;
+        message << "'period' has to be greater than 0.";
+        throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    this->profiling_period = period;
+    this->profiling_random = random;
+}
+
+void
+Scheduler::set_sync_buff_size_max_factor(const size_t factor)
+{
+    if (factor == 0)
+    {
+        std::stringstream message;
+        message << "'factor' has to be greater than 0.";
+        throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    this->sync_buff_size_max_factor = factor;
+}
+
 void
 Scheduler::print_profiling(std::ostream& stream)
 {
@@ -201,6 +235,17 @@ Scheduler::get_sync_buff_sizes() const
     return std::vector<size_t>(this->solution.size() - 1, 1);
 }
 
+// the buffer sizes are fixed by default, the adaptors are only allowed to grow when a factor greater than 1 has been
+// given by the user (see 'set_sync_buff_size_max_factor')
+std::vector<std::pair<size_t, size_t>>
+Scheduler::get_sync_buff_size_bounds() const
+{
+    std::vector<std::pair<size_t, size_t>> bounds;
+    for (auto buff_size : this->get_sync_buff_sizes())
+        bounds.push_back(std::make_pair(buff_size, this->sync_buff_size_max_factor * buff_size));
+    return bounds;
+}
+
 std::vector<bool>
 Scheduler::get_sync_active_waitings() const
 {
@@ -238,7 +283,8 @@ runtime::Pipeline*
 Scheduler::instantiate_pipeline(const std::vector<size_t> synchro_buffer_sizes,
                                 const std::vector<bool> synchro_active_waitings,
                                 const std::vector<bool> thread_pinings,
-                                const std::string& pinning_policy)
+                                const std::string& pinning_policy,
+                                const std::vector<std::pair<size_t, size_t>> synchro_buffer_size_bounds)
 {
     if (this->solution.size() == 0)
     {
@@ -296,7 +342,11 @@ Scheduler::instantiate_pipeline(const std::vector<size_t> synchro_buffer_sizes,
                                  synchro_buffer_sizes,
                                  synchro_active_waitings,
                                  thread_pinings,
-                                 pinning_policy);
+                                 pinning_policy,
+                                 {}, // lock-free rings
+                                 {}, // spin budgets
+                                 {}, // batch sizes
+                                 synchro_buffer_size_bounds);
 }
 
 runtime::Pipeline*
@@ -328,7 +378,8 @@ Scheduler::generate_pipeline()
     return this->instantiate_pipeline(this->get_sync_buff_sizes(),
                                       this->get_sync_active_waitings(),
                                       this->get_thread_pinnings(),
-                                      this->get_threads_mapping());
+                                      this->get_threads_mapping(),
+                                      this->get_sync_buff_size_bounds());
 }
 
 size_t
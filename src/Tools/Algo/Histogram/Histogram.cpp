@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+#include "Tools/Algo/Histogram/Histogram.hpp"
+#include "Tools/Exception/exception.hpp"
+
+using namespace spu;
+using namespace spu::tools;
+
+Histogram::Histogram()
+  : n_values(0)
+{
+}
+
+void
+Histogram::allocate()
+{
+    if (!this->is_allocated()) this->counts.resize(Histogram::n_buckets, 0);
+}
+
+void
+Histogram::clear()
+{
+    std::fill(this->counts.begin(), this->counts.end(), 0);
+    this->n_values = 0;
+}
+
+void
+Histogram::merge(const Histogram& other)
+{
+    if (!other.is_allocated()) return;
+
+    this->allocate();
+    for (size_t b = 0; b < Histogram::n_buckets; b++)
+        this->counts[b] += other.counts[b];
+    this->n_values += other.n_values;
+}
+
+uint64_t
+Histogram::get_bucket_min(const size_t bucket)
+{
+    if (bucket >= Histogram::n_buckets)
+    {
+        std::stringstream message;
+        message << "'bucket' has to be smaller than 'n_buckets' ('bucket' = " << bucket
+                << ", 'n_buckets' = " << Histogram::n_buckets << ").";
+        throw tools::out_of_range(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (bucket < Histogram::n_sub_buckets) return (uint64_t)bucket;
+
+    const size_t shift = (bucket >> Histogram::n_sub_bits) - 1;
+    const uint64_t sub = (uint64_t)(bucket & (Histogram::n_sub_buckets - 1)) + Histogram::n_sub_buckets;
+    return sub << shift;
+}
+
+uint64_t
+Histogram::get_bucket_max(const size_t bucket)
+{
+    if (bucket < Histogram::n_sub_buckets) return Histogram::get_bucket_min(bucket);
+
+    const size_t shift = (bucket >> Histogram::n_sub_bits) - 1;
+    return Histogram::get_bucket_min(bucket) + ((uint64_t)1 << shift) - 1;
+}
+
+uint64_t
+Histogram::get_percentile(const float percentile) const
+{
+    if (percentile < 0.f || percentile > 100.f)
+    {
+        std::stringstream message;
+        message << "'percentile' has to be in [0, 100] ('percentile' = " << percentile << ").";
+        throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (this->n_values == 0) return 0;
+
+    // rank of the value (starting from 1) below which 'percentile' % of the recorded values are
+    const uint64_t rank =
+      std::max((uint64_t)1, (uint64_t)std::ceil((double)percentile / 100. * (double)this->n_values));
+
+    uint64_t n_values = 0;
+    for (size_t b = 0; b < Histogram::n_buckets; b++)
+    {
+        n_values += this->counts[b];
+        // the middle of the bucket minimizes the error
+        if (n_values >= rank) return (Histogram::get_bucket_min(b) + Histogram::get_bucket_max(b) + 1) / 2;
+    }
+
+    return Histogram::get_bucket_max(Histogram::n_buckets - 1);
+}
@@ -126,6 +126,12 @@ Pipeline_builder::build()
     std::vector<bool> pinning;
     std::vector<size_t> buffer_sizes;
     std::vector<bool> waitings;
+    std::vector<bool> lock_frees;
+    std::vector<size_t> spin_budgets;
+    std::vector<size_t> batch_sizes;
+    std::vector<std::pair<size_t, size_t>> buffer_size_bounds;
+    std::vector<bool> work_stealings;
+    std::vector<size_t> reorder_windows;
     std::string pinning_policy("");
 
     // Build stages
@@ -154,16 +160,39 @@ Pipeline_builder::build()
         {
             buffer_sizes.push_back(this->synchros[stage_id]->get_buffer_size());
             waitings.push_back(this->synchros[stage_id]->is_active_waiting());
+            lock_frees.push_back(this->synchros[stage_id]->is_lock_free());
+            spin_budgets.push_back(this->synchros[stage_id]->get_spin_budget());
+            batch_sizes.push_back(this->synchros[stage_id]->get_batch_size());
+            buffer_size_bounds.push_back(this->synchros[stage_id]->get_buffer_size_bounds());
+            work_stealings.push_back(this->synchros[stage_id]->is_work_stealing());
+            reorder_windows.push_back(this->synchros[stage_id]->get_reorder_window());
         }
         else
         {
             buffer_sizes.push_back(synchro_default.get_buffer_size());
             waitings.push_back(synchro_default.is_active_waiting());
+            lock_frees.push_back(synchro_default.is_lock_free());
+            spin_budgets.push_back(synchro_default.get_spin_budget());
+            batch_sizes.push_back(synchro_default.get_batch_size());
+            buffer_size_bounds.push_back(synchro_default.get_buffer_size_bounds());
+            work_stealings.push_back(synchro_default.is_work_stealing());
+            reorder_windows.push_back(synchro_default.get_reorder_window());
         }
     }
 
-    return runtime::Pipeline(
-      this->get_tasks_for_checking(), built_stages, threads, buffer_sizes, waitings, pinning, pinning_policy);
+    return runtime::Pipeline(this->get_tasks_for_checking(),
+                             built_stages,
+                             threads,
+                             buffer_sizes,
+                             waitings,
+                             pinning,
+                             pinning_policy,
+                             lock_frees,
+                             spin_budgets,
+                             batch_sizes,
+                             buffer_size_bounds,
+                             work_stealings,
+                             reorder_windows);
 }
 
 Pipeline_builder::Stage_builder&
@@ -392,4 +421,109 @@ const size_t
 Pipeline_builder::Synchro_builder::get_buffer_size()
 {
     return this->buffer_size;
-}
\ No newline at end of file
+}
+
+Pipeline_builder::Synchro_builder&
+Pipeline_builder::Synchro_builder::enable_lock_free()
+{
+    this->lock_free = true;
+    return *this;
+}
+
+Pipeline_builder::Synchro_builder&
+Pipeline_builder::Synchro_builder::disable_lock_free()
+{
+    this->lock_free = false;
+    return *this;
+}
+
+Pipeline_builder::Synchro_builder&
+Pipeline_builder::Synchro_builder::set_lock_free(bool lock_free)
+{
+    return (lock_free) ? this->enable_lock_free() : this->disable_lock_free();
+}
+
+const bool
+Pipeline_builder::Synchro_builder::is_lock_free()
+{
+    return this->lock_free;
+}
+
+Pipeline_builder::Synchro_builder&
+Pipeline_builder::Synchro_builder::set_spin_budget(size_t spin_budget)
+{
+    this->spin_budget = spin_budget;
+    return *this;
+}
+
+const size_t
+Pipeline_builder::Synchro_builder::get_spin_budget()
+{
+    return this->spin_budget;
+}
+
+Pipeline_builder::Synchro_builder&
+Pipeline_builder::Synchro_builder::set_batch_size(size_t batch_size)
+{
+    this->batch_size = batch_size;
+    return *this;
+}
+
+size_t
+Pipeline_builder::Synchro_builder::get_batch_size() const
+{
+    return this->batch_size;
+}
+
+Pipeline_builder::Synchro_builder&
+Pipeline_builder::Synchro_builder::set_buffer_size_bounds(size_t buffer_size_min, size_t buffer_size_max)
+{
+    this->buffer_size_min = buffer_size_min;
+    this->buffer_size_max = buffer_size_max;
+    return *this;
+}
+
+const std::pair<size_t, size_t>
+Pipeline_builder::Synchro_builder::get_buffer_size_bounds()
+{
+    return std::make_pair(this->buffer_size_min, this->buffer_size_max);
+}
+
+Pipeline_builder::Synchro_builder&
+Pipeline_builder::Synchro_builder::enable_work_stealing()
+{
+    this->work_stealing = true;
+    return *this;
+}
+
+Pipeline_builder::Synchro_builder&
+Pipeline_builder::Synchro_builder::disable_work_stealing()
+{
+    this->work_stealing = false;
+    return *this;
+}
+
+Pipeline_builder::Synchro_builder&
+Pipeline_builder::Synchro_builder::set_work_stealing(bool work_stealing)
+{
+    return (work_stealing) ? this->enable_work_stealing() : this->disable_work_stealing();
+}
+
+bool
+Pipeline_builder::Synchro_builder::is_work_stealing() const
+{
+    return this->work_stealing;
+}
+
+Pipeline_builder::Synchro_builder&
+Pipeline_builder::Synchro_builder::set_reorder_window(size_t reorder_window)
+{
+    this->reorder_window = reorder_window;
+    return *this;
+}
+
+size_t
+Pipeline_builder::Synchro_builder::get_reorder_window() const
+{
+    return this->reorder_window;
+}
@@ -236,6 +236,72 @@ Statistics::show_timer(const float total_sec,
     // clang-format on
 }
 
+void
+Statistics::show_percentiles_header(std::ostream& stream)
+{
+    // clang-format off
+    stream << "# " << rang::style::bold << "---------------------------------------||----------||------------------------------------------------------" << rang::style::reset << std::endl;
+    stream << "# " << rang::style::bold << "         Latency distribution          ||  Timed   ||             Measured latency percentiles             " << rang::style::reset << std::endl;
+    stream << "# " << rang::style::bold << "          of the given task            ||  calls   ||          (merged over the replicated tasks)          " << rang::style::reset << std::endl;
+    stream << "# " << rang::style::bold << "---------------------------------------||----------||------------------------------------------------------" << rang::style::reset << std::endl;
+    stream << "# " << rang::style::bold << "-------------------|-------------------||----------||----------|----------|----------|----------|----------" << rang::style::reset << std::endl;
+    stream << "# " << rang::style::bold << "       MODULE NAME |         TASK NAME ||    CALLS ||      P50 |      P90 |      P99 |    P99.9 |  MAXIMUM " << rang::style::reset << std::endl;
+    stream << "# " << rang::style::bold << "                   |                   ||          ||     (us) |     (us) |     (us) |     (us) |     (us) " << rang::style::reset << std::endl;
+    stream << "# " << rang::style::bold << "-------------------|-------------------||----------||----------|----------|----------|----------|----------" << rang::style::reset << std::endl;
+    // clang-format on
+}
+
+void
+Statistics::show_percentiles(const std::string& module_name,
+                             const std::string& task_name,
+                             const tools::Histogram& task_duration_hist,
+                             const std::chrono::nanoseconds task_max_duration,
+                             std::ostream& stream)
+{
+    // clang-format off
+    const uint64_t n_values = task_duration_hist.get_n_values();
+    if (n_values == 0)
+        return;
+
+    const float percentiles[4] = { 50.f, 90.f, 99.f, 99.9f };
+    float lats[5];
+    for (size_t p = 0; p < 4; p++)
+        lats[p] = (float)(task_duration_hist.get_percentile(percentiles[p]) * 0.001f);
+    // the percentiles are approximated by the histogram, the maximum is exact
+    lats[4] = (float)(task_max_duration.count() * 0.001f);
+    for (size_t p = 0; p < 4; p++)
+        lats[p] = std::min(lats[p], lats[4]);
+
+#ifdef _WIN32
+    auto P = 1;
+#else
+    auto P = 2;
+#endif
+
+    unsigned l1 = 99999999;
+    float    l2 = 99999.99f;
+
+    std::stringstream ssmodule, ssprocess, ssn_values, sslats[5];
+
+    ssmodule   << std::setprecision(                    2) <<                                    std::fixed  << std::setw(18) << module_name;
+    ssprocess  << std::setprecision(                    2) <<                                    std::fixed  << std::setw(17) << task_name;
+    ssn_values << std::setprecision(n_values > l1 ? P : 2) << (n_values > l1 ? std::scientific : std::fixed) << std::setw( 8) << n_values;
+    for (size_t p = 0; p < 5; p++)
+        sslats[p] << std::setprecision(lats[p] > l1 ? P : 2) << (lats[p] > l2 ? std::scientific : std::fixed) << std::setw( 8) << lats[p];
+
+    stream << "# ";
+    stream << ssmodule  .str() << rang::style::bold << " | "  << rang::style::reset
+           << ssprocess .str() << rang::style::bold << " || " << rang::style::reset
+           << ssn_values.str() << rang::style::bold << " || " << rang::style::reset
+           << sslats[0] .str() << rang::style::bold << " | "  << rang::style::reset
+           << sslats[1] .str() << rang::style::bold << " | "  << rang::style::reset
+           << sslats[2] .str() << rang::style::bold << " | "  << rang::style::reset
+           << sslats[3] .str() << rang::style::bold << " | "  << rang::style::reset
+           << sslats[4] .str() << ""
+           << std::endl;
+    // clang-format on
+}
+
 template<class MODULE_OR_TASK>
 void
 Statistics::show(std::vector<MODULE_OR_TASK*> modules_or_tasks,
@@ -431,6 +497,23 @@ Statistics::show_tasks(std::vector<TASK*> tasks, const bool ordered, const bool
                               ttask_max_duration,
                               display_thr,
                               stream);
+
+        bool has_hist = false;
+        for (auto* t : tasks)
+            has_hist |= t->get_duration_histogram().get_n_values() > 0;
+
+        if (has_hist)
+        {
+            stream << "#" << std::endl;
+            Statistics::show_percentiles_header(stream);
+            for (auto* t : tasks)
+            {
+                auto module_name = t->get_module().get_custom_name().empty() ? t->get_module().get_short_name()
+                                                                             : t->get_module().get_custom_name();
+                Statistics::show_percentiles(
+                  module_name, t->get_name(), t->get_duration_histogram(), t->get_duration_max(), stream);
+            }
+        }
     }
     else
     {
@@ -683,6 +766,34 @@ Statistics::show_tasks(std::vector<std::vector<TASK*>> tasks,
                               ttask_max_duration,
                               display_thr,
                               stream);
+
+        // the histograms of the replicated tasks are merged here (and not when the tasks are executed), there is no
+        // contention between the threads during the execution
+        std::vector<tools::Histogram> tasks_hist(tasks.size());
+        bool has_hist = false;
+        for (size_t vt = 0; vt < tasks.size(); vt++)
+        {
+            for (auto* t : tasks[vt])
+                tasks_hist[vt].merge(t->get_duration_histogram());
+            has_hist |= tasks_hist[vt].get_n_values() > 0;
+        }
+
+        if (has_hist)
+        {
+            stream << "#" << std::endl;
+            Statistics::show_percentiles_header(stream);
+            for (size_t vt = 0; vt < tasks.size(); vt++)
+            {
+                auto& t0 = tasks[vt][0];
+                auto module_name = t0->get_module().get_custom_name().empty() ? t0->get_module().get_short_name()
+                                                                              : t0->get_module().get_custom_name();
+                auto task_max_duration = nanoseconds(0);
+                for (auto* t : tasks[vt])
+                    task_max_duration = std::max(task_max_duration, t->get_duration_max());
+
+                Statistics::show_percentiles(module_name, t0->get_name(), tasks_hist[vt], task_max_duration, stream);
+            }
+        }
     }
     else
     {
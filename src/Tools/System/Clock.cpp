@@ -0,0 +1,129 @@
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/System/Clock.hpp"
+
+using namespace spu;
+using namespace spu::tools;
+
+uint64_t Clock::tsc_origin = 0;
+int64_t Clock::tsc_origin_ns = 0;
+double Clock::tsc_ns_per_tick = 0.;
+std::atomic<bool> Clock::tsc_calibrated(false);
+clock_backend_t Clock::backend = Clock::init_backend();
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+static void
+cpuid(const unsigned int leaf, unsigned int regs[4])
+{
+#if defined(_MSC_VER)
+    int r[4];
+    __cpuid(r, (int)leaf);
+    for (size_t i = 0; i < 4; i++)
+        regs[i] = (unsigned int)r[i];
+#else
+    regs[0] = regs[1] = regs[2] = regs[3] = 0;
+    __get_cpuid(leaf, &regs[0], &regs[1], &regs[2], &regs[3]);
+#endif
+}
+#endif
+
+bool
+Clock::is_tsc_available()
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    unsigned int regs[4];
+    cpuid(0x80000000, regs);
+    if (regs[0] < 0x80000007) return false;
+    cpuid(0x80000001, regs);
+    const bool rdtscp = (regs[3] >> 27) & 1;
+    cpuid(0x80000007, regs);
+    const bool invariant_tsc = (regs[3] >> 8) & 1; // constant rate in all the P-, C- and T-states
+    return rdtscp && invariant_tsc;
+#elif defined(__aarch64__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+void
+Clock::calibrate_tsc()
+{
+#if defined(__aarch64__)
+    // the frequency of the generic timer is given by the system
+    uint64_t freq;
+    __asm__ __volatile__("mrs %0, cntfrq_el0" : "=r"(freq));
+    Clock::tsc_ns_per_tick = 1e9 / (double)freq;
+    const auto s_start = std::chrono::steady_clock::now();
+    Clock::tsc_origin = Clock::read_tsc();
+#else
+    // count the ticks during 10 ms of the steady clock, the relative error is about 1e-5
+    const auto s_start = std::chrono::steady_clock::now();
+    Clock::tsc_origin = Clock::read_tsc();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    const auto s_stop = std::chrono::steady_clock::now();
+    const uint64_t tsc_stop = Clock::read_tsc();
+    const auto s_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(s_stop - s_start);
+    Clock::tsc_ns_per_tick = (double)s_duration.count() / (double)(tsc_stop - Clock::tsc_origin);
+#endif
+    Clock::tsc_origin_ns = std::chrono::duration_cast<duration>(s_start.time_since_epoch()).count();
+}
+
+void
+Clock::calibrate_tsc_once()
+{
+    static std::once_flag once;
+    std::call_once(once,
+                   []()
+                   {
+                       Clock::calibrate_tsc();
+                       Clock::tsc_calibrated.store(true, std::memory_order_release);
+                   });
+}
+
+clock_backend_t
+Clock::init_backend()
+{
+    // the counter is calibrated on its first use (see 'now()'), not during the static initialization
+#ifdef SPU_TSC_CLOCK
+    if (Clock::is_tsc_available()) return clock_backend_t::TSC;
+#endif
+    return clock_backend_t::STEADY;
+}
+
+void
+Clock::set_backend(const clock_backend_t backend)
+{
+    if (backend == clock_backend_t::TSC && !Clock::tsc_calibrated.load(std::memory_order_acquire))
+    {
+        if (!Clock::is_tsc_available())
+        {
+            std::stringstream message;
+            message << "The time-stamp counter of the CPU is not available (or its rate is not constant).";
+            throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+        }
+        Clock::calibrate_tsc_once();
+    }
+    Clock::backend = backend;
+}
+
+clock_backend_t
+Clock::get_backend()
+{
+    return Clock::backend;
+}
+
+double
+Clock::get_tsc_frequency()
+{
+    return Clock::tsc_calibrated.load(std::memory_order_acquire) ? 1. / Clock::tsc_ns_per_tick : 0.;
+}
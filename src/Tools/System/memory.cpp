@@ -1,5 +1,11 @@
 #include <cstdint>
 #include <cstdlib>
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+#ifdef SPU_HWLOC
+#include <hwloc.h>
+#endif
 
 #include "Tools/System/memory.hpp"
 
@@ -56,5 +62,45 @@ mem_free(void* ptr)
 #endif
 }
 
+static std::vector<std::size_t>
+detect_cache_sizes()
+{
+    std::vector<std::size_t> sizes(3, 0);
+#ifdef SPU_HWLOC
+    hwloc_topology_t topology;
+    if (hwloc_topology_init(&topology) == 0)
+    {
+        if (hwloc_topology_load(topology) == 0)
+        {
+            const hwloc_obj_type_t types[3] = { HWLOC_OBJ_L1CACHE, HWLOC_OBJ_L2CACHE, HWLOC_OBJ_L3CACHE };
+            for (size_t l = 0; l < sizes.size(); l++)
+            {
+                hwloc_obj_t cache = hwloc_get_obj_by_type(topology, types[l], 0);
+                if (cache != nullptr && cache->attr != nullptr) sizes[l] = (std::size_t)cache->attr->cache.size;
+            }
+        }
+        hwloc_topology_destroy(topology);
+    }
+#endif
+#if defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE) && defined(_SC_LEVEL3_CACHE_SIZE)
+    const int names[3] = { _SC_LEVEL1_DCACHE_SIZE, _SC_LEVEL2_CACHE_SIZE, _SC_LEVEL3_CACHE_SIZE };
+    for (size_t l = 0; l < sizes.size(); l++)
+        if (sizes[l] == 0)
+        {
+            const long size = sysconf(names[l]);
+            if (size > 0) sizes[l] = (std::size_t)size;
+        }
+#endif
+    return sizes;
+}
+
+std::size_t
+get_cache_size(const unsigned level)
+{
+    // the topology is only detected once
+    static const std::vector<std::size_t> sizes = detect_cache_sizes();
+    return (level >= 1 && level <= sizes.size()) ? sizes[level - 1] : 0;
+}
+
 }
 }
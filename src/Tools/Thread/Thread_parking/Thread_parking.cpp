@@ -0,0 +1,43 @@
+#include <climits>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "Tools/Thread/Thread_parking/Thread_parking.hpp"
+
+using namespace spu;
+using namespace spu::tools;
+
+#ifdef __linux__
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "The futex word has to be a plain 32-bit integer.");
+
+void
+Thread_parking::park(const uint32_t epoch)
+{
+    // returns immediately if the epoch has already changed, spurious wake-ups are handled by the caller
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&this->epoch), FUTEX_WAIT_PRIVATE, epoch, nullptr, nullptr, 0);
+}
+
+void
+Thread_parking::unpark_all()
+{
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&this->epoch), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+}
+#else
+void
+Thread_parking::park(const uint32_t epoch)
+{
+    std::unique_lock<std::mutex> lock(this->mtx);
+    this->cnd.wait(lock, [this, epoch]() { return this->epoch.load() != epoch; });
+}
+
+void
+Thread_parking::unpark_all()
+{
+    std::lock_guard<std::mutex> lock(this->mtx);
+    this->cnd.notify_all();
+}
+#endif
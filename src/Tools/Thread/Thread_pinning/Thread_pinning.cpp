@@ -280,6 +280,193 @@ Thread_pinning::unpin()
     g_mtx.unlock();
 }
 
+#ifdef SPU_HWLOC
+// the NUMA nodes close to the PUs of the 'hwloc_objects', returns nullptr when one of the objects does not exist (the
+// returned nodeset has to be freed by the caller)
+static hwloc_nodeset_t
+objects_to_nodeset(const std::string& hwloc_objects, std::string& missing_object)
+{
+    std::vector<std::string> hwloc_objects_vector = Thread_pinning_utils::thread_parser(hwloc_objects);
+
+    hwloc_bitmap_t all_pus = hwloc_bitmap_alloc();
+    hwloc_bitmap_zero(all_pus);
+    for (auto& obj_str : hwloc_objects_vector)
+    {
+        auto obj_number = Thread_pinning_utils::str_to_hwloc_object(obj_str);
+        int obj_depth = hwloc_get_type_or_below_depth(g_topology, obj_number.first);
+        hwloc_obj_t obj = hwloc_get_obj_by_depth(g_topology, obj_depth, obj_number.second);
+        if (obj == nullptr)
+        {
+            hwloc_bitmap_free(all_pus);
+            missing_object = obj_str;
+            return nullptr;
+        }
+        hwloc_bitmap_or(all_pus, all_pus, obj->cpuset);
+    }
+
+    hwloc_nodeset_t nodeset = hwloc_bitmap_alloc();
+    hwloc_cpuset_to_nodeset(g_topology, all_pus, nodeset);
+    hwloc_bitmap_free(all_pus);
+    return nodeset;
+}
+#endif
+
+bool
+Thread_pinning::bind_memory(const void* ptr, const size_t size, const std::string hwloc_objects)
+{
+    bool is_bound = false;
+    g_mtx.lock();
+#ifdef SPU_HWLOC
+    if (Thread_pinning::is_init())
+    {
+        // the memory is bound to the NUMA nodes close to the PUs of the objects
+        std::string missing_object;
+        hwloc_nodeset_t nodeset = objects_to_nodeset(hwloc_objects, missing_object);
+        if (nodeset == nullptr)
+        {
+            g_mtx.unlock();
+            std::stringstream message;
+            message << "obj is nullptr ('Type' = " << missing_object << ").";
+            throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+        }
+
+        if (g_enable_logs)
+        {
+            char c[128];
+            hwloc_bitmap_snprintf(c, 128, nodeset);
+            std::clog << "Memory binding info -- objects = " << hwloc_objects << " -- size = " << size << " bytes -- "
+                      << "nodeset: " << c << std::endl;
+        }
+
+        if (hwloc_set_area_membind(g_topology,
+                                   ptr,
+                                   size,
+                                   nodeset,
+                                   HWLOC_MEMBIND_BIND,
+                                   HWLOC_MEMBIND_MIGRATE | HWLOC_MEMBIND_BYNODESET))
+        {
+            if (g_enable_logs)
+            {
+                char* str;
+                int error = errno;
+                hwloc_bitmap_asprintf(&str, nodeset);
+                std::clog << "Couldn't bind the memory to nodeset " << str << ": " << strerror(error) << std::endl;
+                free(str);
+            }
+        }
+        else
+            is_bound = true;
+
+        hwloc_bitmap_free(nodeset);
+    }
+    else
+    {
+        if (g_enable_logs)
+        {
+            std::clog << "You can't call the 'bind_memory' method if you have not call the 'init' method before, "
+                      << "nothing will be done." << std::endl;
+        }
+    }
+#else
+    if (g_enable_logs)
+    {
+        std::clog << "'bind_memory' method do nothing as StreamPU has not been linked with the 'hwloc' library."
+                  << std::endl;
+    }
+#endif
+    g_mtx.unlock();
+    return is_bound;
+}
+
+void*
+Thread_pinning::alloc_memory(const size_t size, const std::string hwloc_objects)
+{
+    void* ptr = nullptr;
+    g_mtx.lock();
+#ifdef SPU_HWLOC
+    if (Thread_pinning::is_init())
+    {
+        std::string missing_object;
+        hwloc_nodeset_t nodeset = objects_to_nodeset(hwloc_objects, missing_object);
+        if (nodeset == nullptr)
+        {
+            g_mtx.unlock();
+            std::stringstream message;
+            message << "obj is nullptr ('Type' = " << missing_object << ").";
+            throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+        }
+
+        // the area is made of whole pages, then the binding can't spill over the neighbouring allocations
+        ptr = hwloc_alloc_membind(g_topology, size, nodeset, HWLOC_MEMBIND_BIND, HWLOC_MEMBIND_BYNODESET);
+        if (ptr == nullptr && g_enable_logs)
+        {
+            char* str;
+            int error = errno;
+            hwloc_bitmap_asprintf(&str, nodeset);
+            std::clog << "Couldn't allocate the memory on nodeset " << str << ": " << strerror(error) << std::endl;
+            free(str);
+        }
+
+        hwloc_bitmap_free(nodeset);
+    }
+    else
+    {
+        if (g_enable_logs)
+        {
+            std::clog << "You can't call the 'alloc_memory' method if you have not call the 'init' method before, "
+                      << "nothing will be done." << std::endl;
+        }
+    }
+#else
+    if (g_enable_logs)
+    {
+        std::clog << "'alloc_memory' method do nothing as StreamPU has not been linked with the 'hwloc' library."
+                  << std::endl;
+    }
+#endif
+    g_mtx.unlock();
+    return ptr;
+}
+
+void
+Thread_pinning::free_memory(void* ptr, const size_t size)
+{
+#ifdef SPU_HWLOC
+    if (ptr != nullptr) hwloc_free(g_topology, ptr, size);
+#endif
+}
+
+bool
+Thread_pinning::is_memory_bound(const void* ptr, const size_t size, const std::string hwloc_objects)
+{
+    bool is_bound = false;
+    g_mtx.lock();
+#ifdef SPU_HWLOC
+    if (Thread_pinning::is_init())
+    {
+        std::string missing_object;
+        hwloc_nodeset_t nodeset = objects_to_nodeset(hwloc_objects, missing_object);
+        if (nodeset == nullptr)
+        {
+            g_mtx.unlock();
+            std::stringstream message;
+            message << "obj is nullptr ('Type' = " << missing_object << ").";
+            throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+        }
+
+        hwloc_nodeset_t area_nodeset = hwloc_bitmap_alloc();
+        hwloc_membind_policy_t policy;
+        if (!hwloc_get_area_membind(g_topology, ptr, size, area_nodeset, &policy, HWLOC_MEMBIND_BYNODESET))
+            is_bound = policy == HWLOC_MEMBIND_BIND && hwloc_bitmap_isincluded(area_nodeset, nodeset);
+
+        hwloc_bitmap_free(area_nodeset);
+        hwloc_bitmap_free(nodeset);
+    }
+#endif
+    g_mtx.unlock();
+    return is_bound;
+}
+
 std::string
 Thread_pinning::get_cur_cpuset_str()
 {
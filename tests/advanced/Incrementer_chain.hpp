@@ -0,0 +1,79 @@
+/*!
+ * \file
+ * \brief Chain of incrementers shared by the sequence tests.
+ */
+#ifndef INCREMENTER_CHAIN_HPP_
+#define INCREMENTER_CHAIN_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <streampu.hpp>
+
+// 'initializer' -> 'incs' -> 'finalizer': when the initial data are 0, the finalizers receive the number of
+// incrementers (modulo 256). The finalizer is left unbound when 'bind_finalizer' is false, so a module can be inserted
+// after the last incrementer ('get_out()').
+struct Incrementer_chain
+{
+    spu::module::Initializer<uint8_t> initializer;
+    spu::module::Finalizer<uint8_t> finalizer;
+    std::vector<std::shared_ptr<spu::module::Incrementer<uint8_t>>> incs;
+
+    Incrementer_chain(const size_t data_length,
+                      const size_t n_incs,
+                      const size_t sleep_time_ns = 0,
+                      const bool bind_finalizer = true)
+      : initializer(data_length)
+      , finalizer(data_length)
+      , incs(n_incs)
+    {
+        for (size_t s = 0; s < incs.size(); s++)
+        {
+            incs[s].reset(new spu::module::Incrementer<uint8_t>(data_length, sleep_time_ns));
+            incs[s]->set_custom_name("Inc" + std::to_string(s));
+        }
+
+        (*incs[0])["increment::in"] = initializer["initialize::out"];
+        for (size_t s = 0; s < incs.size() - 1; s++)
+            (*incs[s + 1])["increment::in"] = (*incs[s])["increment::out"];
+        if (bind_finalizer) finalizer["finalize::in"] = get_out();
+    }
+
+    spu::runtime::Socket& get_out() { return (*incs[incs.size() - 1])["increment::out"]; }
+
+    // each frame of each finalizer of 'sequence' has to contain 'expected'
+    bool check(spu::runtime::Sequence& sequence, const int expected)
+    {
+        for (auto cur_finalizer : sequence.get_cloned_modules<spu::module::Finalizer<uint8_t>>(finalizer))
+            for (auto& frame : cur_finalizer->get_final_data())
+                for (auto d : frame)
+                    if (d != expected) return false;
+        return true;
+    }
+
+    // number of executions of the 'finalize' task, all the replicated sequences included
+    size_t get_n_execs(spu::runtime::Sequence& sequence)
+    {
+        size_t n_execs = 0;
+        for (auto cur_finalizer : sequence.get_cloned_modules<spu::module::Finalizer<uint8_t>>(finalizer))
+            n_execs += (*cur_finalizer)("finalize").get_n_calls();
+        return n_execs;
+    }
+
+    // reset the counters of the tasks, disable their statistics and enable their fast mode
+    static void reset_tasks(spu::runtime::Sequence& sequence)
+    {
+        for (auto& mod : sequence.get_modules<spu::module::Module>(false))
+            for (auto& tsk : mod->tasks)
+            {
+                tsk->reset();
+                tsk->set_stats(false);
+                tsk->set_fast(true);
+            }
+    }
+};
+
+#endif /* INCREMENTER_CHAIN_HPP_ */
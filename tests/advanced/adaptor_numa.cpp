@@ -0,0 +1,306 @@
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <getopt.h>
+#include <hwloc.h>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <streampu.hpp>
+using namespace spu;
+using namespace spu::runtime;
+
+// run one pusher thread pinned on 'push_objects' and one puller thread pinned on 'pull_objects' through an adaptor
+// whose synchronization buffers are bound to the NUMA node(s) of 'mem_objects' (the buffers are first-touched by the
+// main thread when 'mem_objects' is empty), each frame contains its index so the order can be checked by the puller
+static bool
+run_adaptor(const size_t n_pushes,
+            const size_t data_length,
+            const size_t buffer_size,
+            const bool active_waiting,
+            const std::string& push_objects,
+            const std::string& pull_objects,
+            const std::string& mem_objects,
+            double& pushes_per_sec)
+{
+    // the same adaptor is the pusher and the puller (as in a pipeline between two single-threaded stages)
+    std::unique_ptr<module::Adaptor_m_to_n> adp(
+      new module::Adaptor_m_to_n(data_length, typeid(int32_t), buffer_size, active_waiting));
+    if (!mem_objects.empty()) adp->set_pull_placement({ mem_objects });
+    adp->alloc_buffers();
+
+    std::vector<int32_t> in_data(data_length, 0);
+    (*adp)("push").set_fast(true);
+    (*adp)["push::in0"] = in_data;
+    (*adp)("pull").set_fast(true);
+
+    bool tests_passed = true;
+    auto t_start = std::chrono::steady_clock::now();
+    std::thread push_thread(
+      [&]()
+      {
+          tools::Thread_pinning::pin(push_objects);
+          auto& push = (*adp)("push");
+          for (size_t i = 0; i < n_pushes; i++)
+          {
+              in_data[0] = (int32_t)i;
+              push.exec();
+          }
+          tools::Thread_pinning::unpin();
+      });
+    std::thread pull_thread(
+      [&]()
+      {
+          tools::Thread_pinning::pin(pull_objects);
+          auto& pull = (*adp)("pull");
+          for (size_t i = 0; i < n_pushes; i++)
+          {
+              pull.exec();
+              if (pull.sockets[0]->get_dataptr<const int32_t>()[0] != (int32_t)i) tests_passed = false;
+          }
+          tools::Thread_pinning::unpin();
+      });
+    push_thread.join();
+    pull_thread.join();
+    std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - t_start;
+
+    pushes_per_sec = (double)n_pushes / ((double)duration.count() * 1e-9);
+    return tests_passed;
+}
+
+// run a two-stage pipeline (initializer -> incrementer | finalizer) whose stages are pinned on 'push_objects' and on
+// 'pull_objects', in the no-copy mode the slots of the adaptor would be swapped with the buffers of the sockets: after
+// 'n_laps' laps of the ring, all the slots have to be still bound to the NUMA node(s) of the puller
+static bool
+run_pipeline(const size_t n_laps,
+             const size_t data_length,
+             const size_t buffer_size,
+             const bool active_waiting,
+             const std::string& push_objects,
+             const std::string& pull_objects)
+{
+    module::Initializer<int32_t> initializer(data_length);
+    module::Incrementer<int32_t> incrementer(data_length);
+    module::Finalizer<int32_t> finalizer(data_length);
+    incrementer["increment::in"] = initializer["initialize::out"];
+    finalizer["finalize::in"] = incrementer["increment::out"];
+
+    runtime::Pipeline pipeline(initializer("initialize"),
+                               {
+                                 { { &initializer("initialize") }, { &incrementer("increment") } },
+                                 { { &finalizer("finalize") }, {} },
+                               },
+                               { 1, 1 },
+                               { buffer_size },
+                               { active_waiting },
+                               { true, true },
+                               push_objects + " | " + pull_objects);
+
+    for (auto& mod : pipeline.get_modules<module::Module>(false))
+        for (auto& tsk : mod->tasks)
+            tsk->set_fast(true);
+
+    std::vector<module::Adaptor_m_to_n*> placed_adaptors;
+    for (auto adp : pipeline.get_modules<module::Adaptor_m_to_n>(false))
+        if (!adp->get_pull_placement().empty()) placed_adaptors.push_back(adp);
+
+    // the slots are checked by the puller once the pusher is over, when the last 'buffer_size' frames have been pushed
+    // the puller has not released them yet, this way nobody swaps the slots during the check (the adaptor is reset at
+    // the end of the execution)
+    const size_t n_exec = n_laps * buffer_size;
+    std::atomic<size_t> n_pushes(0);
+    size_t n_pulls = 0;
+    bool placement_kept = !placed_adaptors.empty();
+    pipeline.exec({ [&n_pushes, n_exec]() { return ++n_pushes >= n_exec; },
+                    [&]()
+                    {
+                        if (++n_pulls == n_exec - buffer_size)
+                        {
+                            while (n_pushes < n_exec)
+                                std::this_thread::yield();
+                            for (auto adp : placed_adaptors)
+                                placement_kept &= adp->check_pull_placement();
+                        }
+                        return false;
+                    } });
+
+    return placement_kept;
+}
+
+int
+main(int argc, char** argv)
+{
+    tools::Signal_handler::init();
+
+    option longopts[] = { { "n-pushes", required_argument, NULL, 'e' },
+                          { "data-length", required_argument, NULL, 'd' },
+                          { "buffer-size", required_argument, NULL, 'u' },
+                          { "active-waiting", no_argument, NULL, 'w' },
+                          { "push-objects", required_argument, NULL, 'P' },
+                          { "pull-objects", required_argument, NULL, 'Q' },
+                          { "remote-objects", required_argument, NULL, 'R' },
+                          { "help", no_argument, NULL, 'h' },
+                          { 0 } };
+
+    size_t n_pushes = 100000;
+    size_t data_length = 4096;
+    size_t buffer_size = 16;
+    bool active_waiting = false;
+    std::string push_objects = "PU_0";
+    std::string pull_objects;
+    std::string remote_objects;
+
+    while (1)
+    {
+        const int opt = getopt_long(argc, argv, "e:d:u:P:Q:R:wh", longopts, 0);
+        if (opt == -1) break;
+        switch (opt)
+        {
+            case 'e':
+                n_pushes = atoi(optarg);
+                break;
+            case 'd':
+                data_length = atoi(optarg);
+                break;
+            case 'u':
+                buffer_size = atoi(optarg);
+                break;
+            case 'w':
+                active_waiting = true;
+                break;
+            case 'P':
+                push_objects = std::string(optarg);
+                break;
+            case 'Q':
+                pull_objects = std::string(optarg);
+                break;
+            case 'R':
+                remote_objects = std::string(optarg);
+                break;
+            case 'h':
+                std::cout << "usage: " << argv[0] << " [options]" << std::endl;
+                std::cout << std::endl;
+                std::cout << "  -e, --n-pushes        "
+                          << "Total number of pushes                                                "
+                          << "[" << n_pushes << "]" << std::endl;
+                std::cout << "  -d, --data-length     "
+                          << "Number of 32-bit elements in one frame                                "
+                          << "[" << data_length << "]" << std::endl;
+                std::cout << "  -u, --buffer-size     "
+                          << "Size of the buffer between the pusher and the puller                  "
+                          << "[" << buffer_size << "]" << std::endl;
+                std::cout << "  -w, --active-waiting  "
+                          << "Enable active waiting in the synchronizations                         "
+                          << "[" << (active_waiting ? "true" : "false") << "]" << std::endl;
+                std::cout << "  -P, --push-objects    "
+                          << "hwloc objects of the pusher thread                                    "
+                          << "[\"" << push_objects << "\"]" << std::endl;
+                std::cout << "  -Q, --pull-objects    "
+                          << "hwloc objects of the puller thread (the last PU if empty)             "
+                          << "[" << (pull_objects.empty() ? "empty" : "\"" + pull_objects + "\"") << "]" << std::endl;
+                std::cout << "  -R, --remote-objects  "
+                          << "hwloc objects remote to the puller (the last NUMA node if empty)      "
+                          << "[" << (remote_objects.empty() ? "empty" : "\"" + remote_objects + "\"") << "]"
+                          << std::endl;
+                std::cout << "  -h, --help            "
+                          << "This help                                                             "
+                          << "[false]" << std::endl;
+                exit(0);
+                break;
+            default:
+                break;
+        }
+    }
+
+    // by default the puller runs on the last PU and the remote memory is the last NUMA node that is not the one of
+    // the puller (or the only NUMA node on a UMA machine)
+    hwloc_topology_t topology;
+    hwloc_topology_init(&topology);
+    hwloc_topology_load(topology);
+    const int n_pus = hwloc_get_nbobjs_by_type(topology, HWLOC_OBJ_PU);
+    const int n_numa_nodes = hwloc_get_nbobjs_by_type(topology, HWLOC_OBJ_NUMANODE);
+    if (pull_objects.empty()) pull_objects = "PU_" + std::to_string(n_pus - 1);
+    if (remote_objects.empty())
+    {
+        hwloc_obj_t pull_pu = hwloc_get_obj_by_type(topology, HWLOC_OBJ_PU, n_pus - 1);
+        int remote_node = n_numa_nodes - 1;
+        for (int n = n_numa_nodes - 1; n >= 0; n--)
+            if (!hwloc_bitmap_intersects(hwloc_get_obj_by_type(topology, HWLOC_OBJ_NUMANODE, n)->cpuset,
+                                         pull_pu->cpuset))
+            {
+                remote_node = n;
+                break;
+            }
+        remote_objects = "NUMA_" + std::to_string(remote_node);
+    }
+    hwloc_topology_destroy(topology);
+
+    std::cout << "###############################################" << std::endl;
+    std::cout << "# Micro-benchmark: Adaptor buffers placement #" << std::endl;
+    std::cout << "###############################################" << std::endl;
+    std::cout << "#" << std::endl;
+
+    std::cout << "# Command line arguments:" << std::endl;
+    std::cout << "#   - n_pushes       = " << n_pushes << std::endl;
+    std::cout << "#   - data_length    = " << data_length << std::endl;
+    std::cout << "#   - buffer_size    = " << buffer_size << std::endl;
+    std::cout << "#   - active_waiting = " << (active_waiting ? "true" : "false") << std::endl;
+    std::cout << "#   - push_objects   = " << push_objects << std::endl;
+    std::cout << "#   - pull_objects   = " << pull_objects << std::endl;
+    std::cout << "#   - remote_objects = " << remote_objects << std::endl;
+    std::cout << "#   - n_numa_nodes   = " << n_numa_nodes << std::endl;
+    std::cout << "#" << std::endl;
+
+    if (n_numa_nodes < 2)
+        std::cout << "# (i) Only one NUMA node has been detected, the local and the remote placements are the same."
+                  << std::endl
+                  << "#" << std::endl;
+
+    tools::Thread_pinning::init();
+
+    double pushes_per_sec_ft = 0., pushes_per_sec_local = 0., pushes_per_sec_remote = 0.;
+    bool tests_passed = true;
+    tests_passed &= run_adaptor(
+      n_pushes, data_length, buffer_size, active_waiting, push_objects, pull_objects, "", pushes_per_sec_ft);
+    tests_passed &= run_adaptor(n_pushes,
+                                data_length,
+                                buffer_size,
+                                active_waiting,
+                                push_objects,
+                                pull_objects,
+                                pull_objects,
+                                pushes_per_sec_local);
+    tests_passed &= run_adaptor(n_pushes,
+                                data_length,
+                                buffer_size,
+                                active_waiting,
+                                push_objects,
+                                pull_objects,
+                                remote_objects,
+                                pushes_per_sec_remote);
+    const bool placement_kept = run_pipeline(4, data_length, buffer_size, active_waiting, push_objects, pull_objects);
+    tests_passed &= placement_kept;
+
+    tools::Thread_pinning::destroy();
+
+    const double frame_bytes = (double)(data_length * sizeof(int32_t));
+    std::cout << "# First touch:      " << pushes_per_sec_ft / 1e6 << " Mpushes/s ("
+              << pushes_per_sec_ft * frame_bytes / 1e9 << " GB/s)" << std::endl;
+    std::cout << "# Local placement:  " << pushes_per_sec_local / 1e6 << " Mpushes/s ("
+              << pushes_per_sec_local * frame_bytes / 1e9 << " GB/s)" << std::endl;
+    std::cout << "# Remote placement: " << pushes_per_sec_remote / 1e6 << " Mpushes/s ("
+              << pushes_per_sec_remote * frame_bytes / 1e9 << " GB/s)" << std::endl;
+    std::cout << "# Local/remote:     " << pushes_per_sec_local / pushes_per_sec_remote << std::endl;
+    std::cout << "# Placement kept in pipeline: " << (placement_kept ? "yes" : "no") << std::endl;
+
+    if (tests_passed)
+        std::cout << "# " << rang::style::bold << rang::fg::green << "Tests passed!" << rang::style::reset << std::endl;
+    else
+        std::cout << "# " << rang::style::bold << rang::fg::red << "Tests failed :-(" << rang::style::reset
+                  << std::endl;
+
+    return !tests_passed;
+}
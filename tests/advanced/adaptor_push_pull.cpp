@@ -0,0 +1,362 @@
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <getopt.h>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <streampu.hpp>
+using namespace spu;
+using namespace spu::runtime;
+
+// global index of the 'i'-th frame of the thread 'tid' among 'n_threads' threads, the frames are distributed to the
+// threads in round-robin by batches of 'batch_size' frames
+static int32_t
+frame_index(const size_t i, const size_t tid, const size_t n_threads, const size_t batch_size)
+{
+    return (int32_t)(((i / batch_size) * n_threads + tid) * batch_size + i % batch_size);
+}
+
+// run 'n_pushers' threads pushing 'n_pushes' frames in total in an adaptor and 'n_pullers' threads pulling them, each
+// frame contains its global index so the round-robin order can be checked on the pullers side (in work-stealing mode
+// the pullers pull until the waiting is canceled and only the fact that each frame is pulled once is checked, the
+// order is checked again when the single puller reorders the frames)
+static bool
+run_adaptor(const size_t n_pushers,
+            const size_t n_pullers,
+            const size_t n_pushes,
+            const size_t data_length,
+            const size_t buffer_size,
+            const bool active_waiting,
+            const bool lock_free,
+            const size_t spin_budget,
+            const size_t batch_size,
+            const size_t buffer_size_max,
+            const bool work_stealing,
+            const size_t reorder_window,
+            double& pushes_per_sec,
+            size_t& final_depth,
+            size_t& n_late_frames)
+{
+    std::unique_ptr<module::Adaptor_m_to_n> adp(new module::Adaptor_m_to_n(data_length,
+                                                                           typeid(int32_t),
+                                                                           buffer_size,
+                                                                           active_waiting,
+                                                                           lock_free,
+                                                                           spin_budget,
+                                                                           batch_size,
+                                                                           0,
+                                                                           buffer_size_max,
+                                                                           work_stealing,
+                                                                           reorder_window));
+
+    std::vector<std::unique_ptr<module::Adaptor_m_to_n>> clones;
+    for (size_t c = 0; c < (n_pushers - 1) + (n_pullers - 1); c++)
+        clones.push_back(std::unique_ptr<module::Adaptor_m_to_n>(adp->clone()));
+
+    std::vector<module::Adaptor_m_to_n*> pushers(1, adp.get());
+    std::vector<module::Adaptor_m_to_n*> pullers(1, adp.get());
+    for (size_t c = 0; c < clones.size(); c++)
+    {
+        if (c < n_pushers - 1)
+        {
+            clones[c]->add_pusher();
+            pushers.push_back(clones[c].get());
+        }
+        else
+        {
+            clones[c]->add_puller();
+            pullers.push_back(clones[c].get());
+        }
+    }
+    adp->alloc_buffers();
+
+    std::vector<std::vector<int32_t>> in_data(n_pushers, std::vector<int32_t>(data_length));
+    for (size_t p = 0; p < n_pushers; p++)
+    {
+        (*pushers[p])("push").set_fast(true);
+        (*pushers[p])["push::in0"] = in_data[p];
+    }
+    for (size_t p = 0; p < n_pullers; p++)
+        (*pullers[p])("pull").set_fast(true);
+
+    std::atomic<bool> tests_passed(true);
+    std::vector<std::thread> threads;
+    std::vector<std::vector<int32_t>> pulled_frames(n_pullers);
+
+    auto t_start = std::chrono::steady_clock::now();
+    for (size_t p = 0; p < n_pushers; p++)
+        threads.push_back(std::thread(
+          [&, p]()
+          {
+              auto& push = (*pushers[p])("push");
+              for (size_t i = 0; i < n_pushes / n_pushers; i++)
+              {
+                  in_data[p][0] = frame_index(i, p, n_pushers, batch_size);
+                  push.exec();
+              }
+          }));
+    for (size_t p = 0; p < n_pullers; p++)
+        threads.push_back(std::thread(
+          [&, p]()
+          {
+              auto& pull = (*pullers[p])("pull");
+              if (work_stealing)
+              {
+                  try
+                  {
+                      while (true)
+                      {
+                          pull.exec();
+                          pulled_frames[p].push_back(pull.sockets[0]->get_dataptr<const int32_t>()[0]);
+                          if ((uint64_t)pulled_frames[p].back() != pullers[p]->get_pull_tag()) tests_passed = false;
+                      }
+                  }
+                  catch (tools::waiting_canceled const&)
+                  {
+                  }
+                  return;
+              }
+              for (size_t i = 0; i < n_pushes / n_pullers; i++)
+              {
+                  pull.exec();
+                  if (pull.sockets[0]->get_dataptr<const int32_t>()[0] != frame_index(i, p, n_pullers, batch_size))
+                      tests_passed = false;
+              }
+          }));
+    for (size_t p = 0; p < n_pushers; p++)
+        threads[p].join();
+    // the pullers are stopped once all the frames have been pushed (they stop by themselves otherwise), each clone
+    // has its own cancel flag
+    if (work_stealing)
+        for (auto puller : pullers)
+            puller->cancel_waiting();
+    for (size_t p = n_pushers; p < threads.size(); p++)
+        threads[p].join();
+    std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - t_start;
+
+    pushes_per_sec = (double)n_pushes / ((double)duration.count() * 1e-9);
+    final_depth = adp->get_depth();
+    n_late_frames = pullers[0]->get_n_late_frames();
+
+    if (work_stealing)
+    {
+        std::vector<size_t> n_pulls(n_pushes, 0);
+        for (auto& frames : pulled_frames)
+            for (auto f : frames)
+                if (f >= 0 && (size_t)f < n_pushes) n_pulls[f]++;
+        for (auto n : n_pulls)
+            if (n != 1) tests_passed = false;
+
+        // the frames that are not in order have to be the late frames of the reorder window
+        if (reorder_window)
+        {
+            size_t n_unordered = 0;
+            int32_t f_max = -1;
+            for (auto f : pulled_frames[0])
+                if (f < f_max)
+                    n_unordered++;
+                else
+                    f_max = f;
+            if (n_unordered != n_late_frames) tests_passed = false;
+        }
+    }
+
+    return tests_passed;
+}
+
+int
+main(int argc, char** argv)
+{
+    tools::Signal_handler::init();
+
+    option longopts[] = { { "n-pushers", required_argument, NULL, 'm' },
+                          { "n-pullers", required_argument, NULL, 'n' },
+                          { "n-pushes", required_argument, NULL, 'e' },
+                          { "data-length", required_argument, NULL, 'd' },
+                          { "buffer-size", required_argument, NULL, 'u' },
+                          { "active-waiting", no_argument, NULL, 'w' },
+                          { "spin-budget", required_argument, NULL, 'k' },
+                          { "batch-size", required_argument, NULL, 'b' },
+                          { "buffer-size-max", required_argument, NULL, 'x' },
+                          { "work-stealing", no_argument, NULL, 's' },
+                          { "reorder-window", required_argument, NULL, 'r' },
+                          { "help", no_argument, NULL, 'h' },
+                          { 0 } };
+
+    size_t n_pushers = 1;
+    size_t n_pullers = 1;
+    size_t n_pushes = 1000000;
+    size_t data_length = 16;
+    size_t buffer_size = 16;
+    bool active_waiting = false;
+    size_t spin_budget = 0;
+    size_t batch_size = 1;
+    size_t buffer_size_max = 0;
+    bool work_stealing = false;
+    size_t reorder_window = 0;
+
+    while (1)
+    {
+        const int opt = getopt_long(argc, argv, "m:n:e:d:u:k:b:x:r:wsh", longopts, 0);
+        if (opt == -1) break;
+        switch (opt)
+        {
+            case 'm':
+                n_pushers = atoi(optarg);
+                break;
+            case 'n':
+                n_pullers = atoi(optarg);
+                break;
+            case 'e':
+                n_pushes = atoi(optarg);
+                break;
+            case 'd':
+                data_length = atoi(optarg);
+                break;
+            case 'u':
+                buffer_size = atoi(optarg);
+                break;
+            case 'w':
+                active_waiting = true;
+                break;
+            case 'k':
+                spin_budget = atoi(optarg);
+                break;
+            case 'b':
+                batch_size = atoi(optarg);
+                break;
+            case 'x':
+                buffer_size_max = atoi(optarg);
+                break;
+            case 's':
+                work_stealing = true;
+                break;
+            case 'r':
+                reorder_window = atoi(optarg);
+                break;
+            case 'h':
+                std::cout << "usage: " << argv[0] << " [options]" << std::endl;
+                std::cout << std::endl;
+                std::cout << "  -m, --n-pushers       "
+                          << "Number of pushing threads                                             "
+                          << "[" << n_pushers << "]" << std::endl;
+                std::cout << "  -n, --n-pullers       "
+                          << "Number of pulling threads                                             "
+                          << "[" << n_pullers << "]" << std::endl;
+                std::cout << "  -e, --n-pushes        "
+                          << "Total number of pushes (rounded to a multiple of the batches)         "
+                          << "[" << n_pushes << "]" << std::endl;
+                std::cout << "  -d, --data-length     "
+                          << "Number of 32-bit elements in one frame                                "
+                          << "[" << data_length << "]" << std::endl;
+                std::cout << "  -u, --buffer-size     "
+                          << "Size of the buffer between the pushers and the pullers                "
+                          << "[" << buffer_size << "]" << std::endl;
+                std::cout << "  -w, --active-waiting  "
+                          << "Enable active waiting in the synchronizations                         "
+                          << "[" << (active_waiting ? "true" : "false") << "]" << std::endl;
+                std::cout << "  -k, --spin-budget     "
+                          << "Spinning iterations before parking in the passive synchronizations    "
+                          << "[" << spin_budget << "]" << std::endl;
+                std::cout << "  -b, --batch-size      "
+                          << "Number of slots claimed at once by the pushers and the pullers        "
+                          << "[" << batch_size << "]" << std::endl;
+                std::cout << "  -x, --buffer-size-max "
+                          << "Maximum adaptive buffer depth (0 = fixed depth)                       "
+                          << "[" << buffer_size_max << "]" << std::endl;
+                std::cout << "  -s, --work-stealing   "
+                          << "Enable the pullers to pull from any sub-buffer (the order is lost)    "
+                          << "[" << (work_stealing ? "true" : "false") << "]" << std::endl;
+                std::cout << "  -r, --reorder-window  "
+                          << "Size of the reorder window of the puller (requires a single puller)   "
+                          << "[" << reorder_window << "]" << std::endl;
+                std::cout << "  -h, --help            "
+                          << "This help                                                             "
+                          << "[false]" << std::endl;
+                exit(0);
+                break;
+            default:
+                break;
+        }
+    }
+
+    const size_t n_sub_buffers = tools::find_smallest_common_multiple(n_pushers, n_pullers);
+    const size_t round_size = n_sub_buffers * batch_size;
+    n_pushes = ((n_pushes + round_size - 1) / round_size) * round_size;
+
+    std::cout << "######################################" << std::endl;
+    std::cout << "# Micro-benchmark: Adaptor push/pull #" << std::endl;
+    std::cout << "######################################" << std::endl;
+    std::cout << "#" << std::endl;
+
+    std::cout << "# Command line arguments:" << std::endl;
+    std::cout << "#   - n_pushers      = " << n_pushers << std::endl;
+    std::cout << "#   - n_pullers      = " << n_pullers << std::endl;
+    std::cout << "#   - n_pushes       = " << n_pushes << std::endl;
+    std::cout << "#   - data_length    = " << data_length << std::endl;
+    std::cout << "#   - buffer_size    = " << buffer_size << std::endl;
+    std::cout << "#   - active_waiting = " << (active_waiting ? "true" : "false") << std::endl;
+    std::cout << "#   - spin_budget    = " << spin_budget << std::endl;
+    std::cout << "#   - batch_size     = " << batch_size << std::endl;
+    std::cout << "#   - buffer_size_max = " << buffer_size_max << std::endl;
+    std::cout << "#   - work_stealing  = " << (work_stealing ? "true" : "false") << std::endl;
+    std::cout << "#   - reorder_window = " << reorder_window << std::endl;
+    std::cout << "#" << std::endl;
+
+    double pushes_per_sec_std = 0., pushes_per_sec_lf = 0.;
+    size_t final_depth_std = 0, final_depth_lf = 0;
+    size_t n_late_frames_std = 0, n_late_frames_lf = 0;
+    bool tests_passed = true;
+    tests_passed &= run_adaptor(n_pushers,
+                                n_pullers,
+                                n_pushes,
+                                data_length,
+                                buffer_size,
+                                active_waiting,
+                                false,
+                                spin_budget,
+                                batch_size,
+                                buffer_size_max,
+                                work_stealing,
+                                reorder_window,
+                                pushes_per_sec_std,
+                                final_depth_std,
+                                n_late_frames_std);
+    tests_passed &= run_adaptor(n_pushers,
+                                n_pullers,
+                                n_pushes,
+                                data_length,
+                                buffer_size,
+                                active_waiting,
+                                true,
+                                spin_budget,
+                                batch_size,
+                                buffer_size_max,
+                                work_stealing,
+                                reorder_window,
+                                pushes_per_sec_lf,
+                                final_depth_lf,
+                                n_late_frames_lf);
+
+    std::cout << "# Standard adaptor:  " << pushes_per_sec_std / 1e6 << " Mpushes/s" << std::endl;
+    std::cout << "# Lock-free adaptor: " << pushes_per_sec_lf / 1e6 << " Mpushes/s" << std::endl;
+    std::cout << "# Speedup:           " << pushes_per_sec_lf / pushes_per_sec_std << std::endl;
+    if (reorder_window)
+        std::cout << "# Late frames:       " << n_late_frames_std << " (standard), " << n_late_frames_lf
+                  << " (lock-free)" << std::endl;
+    if (buffer_size_max)
+        std::cout << "# Final depths:      " << final_depth_std << " (standard), " << final_depth_lf << " (lock-free)"
+                  << std::endl;
+
+    if (tests_passed)
+        std::cout << "# " << rang::style::bold << rang::fg::green << "Tests passed!" << rang::style::reset << std::endl;
+    else
+        std::cout << "# " << rang::style::bold << rang::fg::red << "Tests failed :-(" << rang::style::reset
+                  << std::endl;
+
+    return !tests_passed;
+}
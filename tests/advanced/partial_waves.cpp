@@ -0,0 +1,173 @@
+#include <chrono>
+#include <cstdlib>
+#include <getopt.h>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <streampu.hpp>
+using namespace spu;
+using namespace spu::runtime;
+
+// stateless module that doubles the input frames, it processes all the frames of a wave in one call
+static module::Stateless*
+create_doubler(const size_t data_length, const size_t n_frames_per_wave, const bool partial_waves)
+{
+    auto doubler = new module::Stateless();
+    doubler->set_name("Doubler");
+    doubler->set_short_name("Doubler");
+    auto& tsk = doubler->create_task("double");
+    auto s_in = doubler->create_socket_in<int32_t>(tsk, "in", data_length);
+    auto s_out = doubler->create_socket_out<int32_t>(tsk, "out", data_length);
+    doubler->create_codelet(
+      tsk,
+      [s_in, s_out, data_length](module::Module& m, runtime::Task& t, const size_t frame_id) -> int
+      {
+          const int32_t* in = t[s_in].get_dataptr<const int32_t>();
+          int32_t* out = t[s_out].get_dataptr<int32_t>();
+          const size_t n_elmts = t.get_n_frames_cur_wave() * data_length;
+          for (size_t e = 0; e < n_elmts; e++)
+              out[e] = in[e] * 2;
+          return runtime::status_t::SUCCESS;
+      });
+    doubler->set_n_frames_per_wave(n_frames_per_wave);
+    tsk.set_partial_waves(partial_waves);
+    return doubler;
+}
+
+int
+main(int argc, char** argv)
+{
+    tools::Signal_handler::init();
+
+    option longopts[] = { { "n-frames-per-wave", required_argument, NULL, 'w' },
+                          { "n-full-waves", required_argument, NULL, 'f' },
+                          { "n-exec", required_argument, NULL, 'e' },
+                          { "data-length", required_argument, NULL, 'd' },
+                          { "help", no_argument, NULL, 'h' },
+                          { 0 } };
+
+    size_t n_frames_per_wave = 8;
+    size_t n_full_waves = 1;
+    size_t n_exec = 100;
+    size_t data_length = 16384;
+
+    while (1)
+    {
+        const int opt = getopt_long(argc, argv, "w:f:e:d:h", longopts, 0);
+        if (opt == -1) break;
+        switch (opt)
+        {
+            case 'w':
+                n_frames_per_wave = atoi(optarg);
+                break;
+            case 'f':
+                n_full_waves = atoi(optarg);
+                break;
+            case 'e':
+                n_exec = atoi(optarg);
+                break;
+            case 'd':
+                data_length = atoi(optarg);
+                break;
+            case 'h':
+                std::cout << "usage: " << argv[0] << " [options]" << std::endl;
+                std::cout << std::endl;
+                std::cout << "  -w, --n-frames-per-wave  "
+                          << "Number of frames processed by one call of the codelet              "
+                          << "[" << n_frames_per_wave << "]" << std::endl;
+                std::cout << "  -f, --n-full-waves       "
+                          << "Number of complete waves before the incomplete one                 "
+                          << "[" << n_full_waves << "]" << std::endl;
+                std::cout << "  -e, --n-exec             "
+                          << "Number of task executions for each number of frames                "
+                          << "[" << n_exec << "]" << std::endl;
+                std::cout << "  -d, --data-length        "
+                          << "Number of 32-bit integers in one frame                             "
+                          << "[" << data_length << "]" << std::endl;
+                std::cout << "  -h, --help               "
+                          << "This help                                                          "
+                          << "[false]" << std::endl;
+                exit(0);
+                break;
+            default:
+                break;
+        }
+    }
+
+    std::cout << "#########################################" << std::endl;
+    std::cout << "# Micro-benchmark: Partial waves        #" << std::endl;
+    std::cout << "#########################################" << std::endl;
+    std::cout << "#" << std::endl;
+
+    std::cout << "# Command line arguments:" << std::endl;
+    std::cout << "#   - n_frames_per_wave = " << n_frames_per_wave << std::endl;
+    std::cout << "#   - n_full_waves      = " << n_full_waves << std::endl;
+    std::cout << "#   - n_exec            = " << n_exec << std::endl;
+    std::cout << "#   - data_length       = " << data_length << std::endl;
+    std::cout << "#" << std::endl;
+
+    bool tests_passed = true;
+
+    std::cout << "# -------------|-------------------|-------------------|---------" << std::endl;
+    std::cout << "#  n_frames    | copies (us/exec)  | in place (us/exec)| speedup " << std::endl;
+    std::cout << "# -------------|-------------------|-------------------|---------" << std::endl;
+
+    // sweep 'n_frames % n_frames_per_wave'
+    for (size_t rest = 0; rest < n_frames_per_wave; rest++)
+    {
+        const size_t n_frames = n_full_waves * n_frames_per_wave + rest;
+        if (n_frames == 0) continue;
+
+        std::vector<int32_t> in(n_frames * data_length);
+        for (size_t i = 0; i < in.size(); i++)
+            in[i] = (int32_t)(i % 1000);
+
+        double durations[2];
+        std::vector<int32_t> outs[2];
+        for (size_t partial_waves = 0; partial_waves < 2; partial_waves++)
+        {
+            std::unique_ptr<module::Stateless> doubler(create_doubler(data_length, n_frames_per_wave, partial_waves));
+            doubler->set_n_frames(n_frames);
+            auto& tsk = (*doubler)("double");
+            tsk.set_stats(false);
+            tsk.set_fast(true);
+            tsk["in"].bind(in);
+            outs[partial_waves].resize(n_frames * data_length, 0);
+            tsk["out"].bind(outs[partial_waves]);
+
+            auto t_start = std::chrono::steady_clock::now();
+            for (size_t e = 0; e < n_exec; e++)
+                tsk.exec();
+            std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - t_start;
+            durations[partial_waves] = duration.count() / 1e3 / n_exec;
+
+            for (size_t i = 0; i < in.size(); i++)
+                if (outs[partial_waves][i] != in[i] * 2) tests_passed = false;
+
+            // execution of a single frame (in the middle of a wave when possible)
+            const size_t f = n_frames - 1;
+            std::fill(outs[partial_waves].begin(), outs[partial_waves].end(), 0);
+            tsk.exec((int)f);
+            for (size_t i = 0; i < in.size(); i++)
+            {
+                const int32_t expected = (i / data_length == f) ? in[i] * 2 : 0;
+                if (outs[partial_waves][i] != expected) tests_passed = false;
+            }
+        }
+
+        std::cout << "#  " << std::setw(11) << n_frames << " | " << std::setw(17) << durations[0] << " | "
+                  << std::setw(17) << durations[1] << " | " << std::setw(7) << durations[0] / durations[1]
+                  << std::endl;
+    }
+
+    if (tests_passed)
+        std::cout << "# " << rang::style::bold << rang::fg::green << "Tests passed!" << rang::style::reset << std::endl;
+    else
+        std::cout << "# " << rang::style::bold << rang::fg::red << "Tests failed :-(" << rang::style::reset
+                  << std::endl;
+
+    return !tests_passed;
+}
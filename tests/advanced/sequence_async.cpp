@@ -0,0 +1,231 @@
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <getopt.h>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <streampu.hpp>
+
+#include "Incrementer_chain.hpp"
+
+using namespace spu;
+using namespace spu::runtime;
+
+int
+main(int argc, char** argv)
+{
+    tools::Signal_handler::init();
+
+    option longopts[] = { { "n-threads", required_argument, NULL, 't' },
+                          { "n-incs", required_argument, NULL, 'n' },
+                          { "sleep-time", required_argument, NULL, 's' },
+                          { "n-exec", required_argument, NULL, 'e' },
+                          { "wait-time", required_argument, NULL, 'w' },
+                          { "data-length", required_argument, NULL, 'd' },
+                          { "dot-filepath", required_argument, NULL, 'o' },
+                          { "copy-mode", no_argument, NULL, 'c' },
+                          { "help", no_argument, NULL, 'h' },
+                          { 0 } };
+
+    size_t n_threads = 1;
+    size_t n_incs = 4;
+    size_t sleep_time_ns = 100000;
+    size_t n_exec = 100;
+    size_t wait_time_ms = 50;
+    size_t data_length = 2048;
+    std::string dot_filepath;
+    bool no_copy_mode = true;
+
+    while (1)
+    {
+        const int opt = getopt_long(argc, argv, "t:n:s:e:w:d:o:ch", longopts, 0);
+        if (opt == -1) break;
+        switch (opt)
+        {
+            case 't':
+                n_threads = atoi(optarg);
+                break;
+            case 'n':
+                n_incs = atoi(optarg);
+                break;
+            case 's':
+                sleep_time_ns = atoi(optarg);
+                break;
+            case 'e':
+                n_exec = atoi(optarg);
+                break;
+            case 'w':
+                wait_time_ms = atoi(optarg);
+                break;
+            case 'd':
+                data_length = atoi(optarg);
+                break;
+            case 'o':
+                dot_filepath = std::string(optarg);
+                break;
+            case 'c':
+                no_copy_mode = false;
+                break;
+            case 'h':
+                std::cout << "usage: " << argv[0] << " [options]" << std::endl;
+                std::cout << std::endl;
+                std::cout << "  -t, --n-threads       "
+                          << "Number of threads to run in parallel                                  "
+                          << "[" << n_threads << "]" << std::endl;
+                std::cout << "  -n, --n-incs          "
+                          << "Number of incrementers in the chain                                   "
+                          << "[" << n_incs << "]" << std::endl;
+                std::cout << "  -s, --sleep-time      "
+                          << "Duration of one incrementation (in nanoseconds)                       "
+                          << "[" << sleep_time_ns << "]" << std::endl;
+                std::cout << "  -e, --n-exec          "
+                          << "Number of sequence executions before the stop condition is met        "
+                          << "[" << n_exec << "]" << std::endl;
+                std::cout << "  -w, --wait-time       "
+                          << "Duration of the execution before its cancellation (in milliseconds)   "
+                          << "[" << wait_time_ms << "]" << std::endl;
+                std::cout << "  -d, --data-length     "
+                          << "Size of data to process in one task (in bytes)                        "
+                          << "[" << data_length << "]" << std::endl;
+                std::cout << "  -o, --dot-filepath    "
+                          << "Path to dot output file                                               "
+                          << "[" << (dot_filepath.empty() ? "empty" : "\"" + dot_filepath + "\"") << "]" << std::endl;
+                std::cout << "  -c, --copy-mode       "
+                          << "Enable to copy data in sequence (performance will be reduced)         "
+                          << "[" << (no_copy_mode ? "false" : "true") << "]" << std::endl;
+                std::cout << "  -h, --help            "
+                          << "This help                                                             "
+                          << "[false]" << std::endl;
+                exit(0);
+                break;
+            default:
+                break;
+        }
+    }
+
+    std::cout << "#########################################" << std::endl;
+    std::cout << "# Micro-benchmark: Asynchronous exec    #" << std::endl;
+    std::cout << "#########################################" << std::endl;
+    std::cout << "#" << std::endl;
+
+    std::cout << "# Command line arguments:" << std::endl;
+    std::cout << "#   - n_threads      = " << n_threads << std::endl;
+    std::cout << "#   - n_incs         = " << n_incs << std::endl;
+    std::cout << "#   - sleep_time_ns  = " << sleep_time_ns << std::endl;
+    std::cout << "#   - n_exec         = " << n_exec << std::endl;
+    std::cout << "#   - wait_time_ms   = " << wait_time_ms << std::endl;
+    std::cout << "#   - data_length    = " << data_length << std::endl;
+    std::cout << "#   - dot_filepath   = " << (dot_filepath.empty() ? "[empty]" : dot_filepath.c_str()) << std::endl;
+    std::cout << "#   - no_copy_mode   = " << (no_copy_mode ? "true" : "false") << std::endl;
+    std::cout << "#" << std::endl;
+
+    // modules creation and sockets binding
+    Incrementer_chain chain(data_length, n_incs, sleep_time_ns);
+
+    runtime::Sequence sequence(chain.initializer("initialize"), n_threads);
+    sequence.set_no_copy_mode(no_copy_mode);
+    Incrementer_chain::reset_tasks(sequence);
+
+    if (!dot_filepath.empty())
+    {
+        std::ofstream file(dot_filepath);
+        sequence.export_dot(file);
+    }
+
+    bool tests_passed = true;
+
+    // 1) endless execution, stopped by a cancellation
+    auto t_start = std::chrono::steady_clock::now();
+    auto handle = sequence.exec_async();
+    if (handle.wait_for(std::chrono::milliseconds(wait_time_ms)))
+    {
+        std::cout << "# The endless execution is over before its cancellation." << std::endl;
+        tests_passed = false;
+    }
+    const size_t n_execs_before_cancel = handle.get_n_execs();
+
+    // the other executions and the reconfigurations have to be refused while the execution is running
+    std::vector<std::pair<std::string, std::function<void()>>> refused = {
+        { "exec_async", [&sequence]() { sequence.exec_async(); } },
+        { "exec", [&sequence]() { sequence.exec([]() { return true; }); } },
+        { "exec_n", [&sequence]() { sequence.exec_n(1); } },
+        { "exec_for", [&sequence]() { sequence.exec_for(std::chrono::milliseconds(1)); } },
+        { "exec_until_done", [&sequence]() { sequence.exec_until_done(); } },
+        { "exec_seq", [&sequence]() { sequence.exec_seq(); } },
+        { "exec_step", [&sequence]() { sequence.exec_step(); } },
+        { "set_n_frames", [&sequence]() { sequence.set_n_frames(2); } },
+        { "set_no_copy_mode", [&sequence, no_copy_mode]() { sequence.set_no_copy_mode(!no_copy_mode); } },
+        { "set_n_threads", [&sequence, n_threads]() { sequence.set_n_threads(n_threads + 1); } }
+    };
+    for (auto& action : refused)
+    {
+        try
+        {
+            action.second();
+            std::cout << "# '" << action.first << "' has been called during the asynchronous execution." << std::endl;
+            tests_passed = false;
+        }
+        catch (tools::runtime_error const&)
+        {
+            // do nothing, this is expected
+        }
+    }
+
+    auto t_cancel = std::chrono::steady_clock::now();
+    handle.cancel();
+    handle.wait();
+    std::chrono::nanoseconds cancel_latency = std::chrono::steady_clock::now() - t_cancel;
+    std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - t_start;
+
+    tests_passed &= handle.is_done() && handle.is_canceled();
+    tests_passed &= handle.get_n_execs() >= n_execs_before_cancel;
+    tests_passed &= chain.check(sequence, (int)(n_incs % 256));
+
+    std::cout << "# Executions before cancellation: " << handle.get_n_execs() << " (" << duration.count() / 1e6
+              << " ms)" << std::endl;
+    std::cout << "# Cancellation latency:           " << cancel_latency.count() / 1e3 << " us" << std::endl;
+
+    // 2) the sequence can be executed again after a cancellation, the execution stops by itself
+    std::atomic<size_t> counter(0);
+    handle = sequence.exec_async([&counter, n_exec]() { return ++counter >= n_exec; });
+    handle.wait();
+    tests_passed &= handle.is_done() && !handle.is_canceled();
+    tests_passed &= handle.get_n_execs() == counter && counter >= n_exec;
+    tests_passed &= chain.check(sequence, (int)(n_incs % 256));
+
+    std::cout << "# Executions with stop condition: " << handle.get_n_execs() << std::endl;
+
+    // 3) the exceptions raised during the execution are rethrown by 'wait()'
+    counter = 0;
+    handle = sequence.exec_async(
+      [&counter]()
+      {
+          if (++counter >= 3) throw std::runtime_error("Expected exception.");
+          return false;
+      });
+    try
+    {
+        handle.wait();
+        std::cout << "# The exception raised during the execution has not been rethrown." << std::endl;
+        tests_passed = false;
+    }
+    catch (std::exception const&)
+    {
+        // do nothing, this is expected
+    }
+
+    if (tests_passed)
+        std::cout << "# " << rang::style::bold << rang::fg::green << "Tests passed!" << rang::style::reset << std::endl;
+    else
+        std::cout << "# " << rang::style::bold << rang::fg::red << "Tests failed :-(" << rang::style::reset
+                  << std::endl;
+
+    return !tests_passed;
+}
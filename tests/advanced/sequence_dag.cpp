@@ -0,0 +1,334 @@
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <getopt.h>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef SPU_HWLOC
+#include <hwloc.h>
+#include <sched.h>
+#endif
+
+#include <streampu.hpp>
+using namespace spu;
+using namespace spu::runtime;
+
+int
+main(int argc, char** argv)
+{
+    tools::Signal_handler::init();
+
+    option longopts[] = { { "n-threads", required_argument, NULL, 't' },
+                          { "n-dag-workers", required_argument, NULL, 'w' },
+                          { "n-branches", required_argument, NULL, 'k' },
+                          { "branch-length", required_argument, NULL, 'l' },
+                          { "sleep-time", required_argument, NULL, 's' },
+                          { "n-exec", required_argument, NULL, 'e' },
+                          { "data-length", required_argument, NULL, 'd' },
+                          { "dot-filepath", required_argument, NULL, 'o' },
+                          { "join", no_argument, NULL, 'j' },
+                          { "copy-mode", no_argument, NULL, 'c' },
+                          { "step-by-step", no_argument, NULL, 'b' },
+                          { "pin-workers", no_argument, NULL, 'p' },
+                          { "help", no_argument, NULL, 'h' },
+                          { 0 } };
+
+    size_t n_threads = 1;
+    size_t n_dag_workers = 0;
+    size_t n_branches = 4;
+    size_t branch_length = 4;
+    size_t sleep_time_ns = 10000;
+    size_t n_exec = 1000;
+    size_t data_length = 2048;
+    std::string dot_filepath;
+    bool join = false;
+    bool no_copy_mode = true;
+    bool step_by_step = false;
+    bool pin_workers = false;
+
+    while (1)
+    {
+        const int opt = getopt_long(argc, argv, "t:w:k:l:s:e:d:o:jcbph", longopts, 0);
+        if (opt == -1) break;
+        switch (opt)
+        {
+            case 't':
+                n_threads = atoi(optarg);
+                break;
+            case 'w':
+                n_dag_workers = atoi(optarg);
+                break;
+            case 'k':
+                n_branches = atoi(optarg);
+                break;
+            case 'l':
+                branch_length = atoi(optarg);
+                break;
+            case 's':
+                sleep_time_ns = atoi(optarg);
+                break;
+            case 'e':
+                n_exec = atoi(optarg);
+                break;
+            case 'd':
+                data_length = atoi(optarg);
+                break;
+            case 'o':
+                dot_filepath = std::string(optarg);
+                break;
+            case 'j':
+                join = true;
+                break;
+            case 'c':
+                no_copy_mode = false;
+                break;
+            case 'b':
+                step_by_step = true;
+                break;
+            case 'p':
+                pin_workers = true;
+                break;
+            case 'h':
+                std::cout << "usage: " << argv[0] << " [options]" << std::endl;
+                std::cout << std::endl;
+                std::cout << "  -t, --n-threads       "
+                          << "Number of threads to run in parallel                                  "
+                          << "[" << n_threads << "]" << std::endl;
+                std::cout << "  -w, --n-dag-workers   "
+                          << "Number of workers per thread for the independent tasks (0 = off)      "
+                          << "[" << n_dag_workers << "]" << std::endl;
+                std::cout << "  -k, --n-branches      "
+                          << "Number of independent branches fed by the initializer                 "
+                          << "[" << n_branches << "]" << std::endl;
+                std::cout << "  -l, --branch-length   "
+                          << "Number of incrementers in each branch                                 "
+                          << "[" << branch_length << "]" << std::endl;
+                std::cout << "  -s, --sleep-time      "
+                          << "Duration of one incrementation (in nanoseconds)                       "
+                          << "[" << sleep_time_ns << "]" << std::endl;
+                std::cout << "  -e, --n-exec          "
+                          << "Number of sequence executions                                         "
+                          << "[" << n_exec << "]" << std::endl;
+                std::cout << "  -d, --data-length     "
+                          << "Size of data to process in one task (in bytes)                        "
+                          << "[" << data_length << "]" << std::endl;
+                std::cout << "  -o, --dot-filepath    "
+                          << "Path to dot output file                                               "
+                          << "[" << (dot_filepath.empty() ? "empty" : "\"" + dot_filepath + "\"") << "]" << std::endl;
+                std::cout << "  -j, --join            "
+                          << "Join the branches with adders instead of one finalizer per branch     "
+                          << "[" << (join ? "true" : "false") << "]" << std::endl;
+                std::cout << "  -c, --copy-mode       "
+                          << "Enable to copy data in sequence (performance will be reduced)         "
+                          << "[" << (no_copy_mode ? "false" : "true") << "]" << std::endl;
+                std::cout << "  -b, --step-by-step    "
+                          << "Enable step-by-step sequence execution ('exec_seq')                   "
+                          << "[" << (step_by_step ? "true" : "false") << "]" << std::endl;
+                std::cout << "  -p, --pin-workers     "
+                          << "Pin the threads and the workers on their own PUs and check it (hwloc) "
+                          << "[" << (pin_workers ? "true" : "false") << "]" << std::endl;
+                std::cout << "  -h, --help            "
+                          << "This help                                                             "
+                          << "[false]" << std::endl;
+                exit(0);
+                break;
+            default:
+                break;
+        }
+    }
+
+    std::cout << "##########################################" << std::endl;
+    std::cout << "# Micro-benchmark: DAG-parallel sequence #" << std::endl;
+    std::cout << "##########################################" << std::endl;
+    std::cout << "#" << std::endl;
+
+    std::cout << "# Command line arguments:" << std::endl;
+    std::cout << "#   - n_threads      = " << n_threads << std::endl;
+    std::cout << "#   - n_dag_workers  = " << n_dag_workers << std::endl;
+    std::cout << "#   - n_branches     = " << n_branches << std::endl;
+    std::cout << "#   - branch_length  = " << branch_length << std::endl;
+    std::cout << "#   - sleep_time_ns  = " << sleep_time_ns << std::endl;
+    std::cout << "#   - n_exec         = " << n_exec << std::endl;
+    std::cout << "#   - data_length    = " << data_length << std::endl;
+    std::cout << "#   - dot_filepath   = " << (dot_filepath.empty() ? "[empty]" : dot_filepath.c_str()) << std::endl;
+    std::cout << "#   - join           = " << (join ? "true" : "false") << std::endl;
+    std::cout << "#   - no_copy_mode   = " << (no_copy_mode ? "true" : "false") << std::endl;
+    std::cout << "#   - step_by_step   = " << (step_by_step ? "true" : "false") << std::endl;
+    std::cout << "#   - pin_workers    = " << (pin_workers ? "true" : "false") << std::endl;
+    std::cout << "#" << std::endl;
+
+    // the thread of the replicated sequence 't' is pinned on the PU 't * (n_dag_workers + 1)' and its workers on the
+    // next PUs, the check is skipped when there are not enough PUs
+    std::vector<size_t> puids, dag_puids;
+    std::set<unsigned> allowed_pus; // OS indexes of the PUs
+#ifdef SPU_HWLOC
+    if (pin_workers)
+    {
+        hwloc_topology_t topology;
+        hwloc_topology_init(&topology);
+        hwloc_topology_load(topology);
+        const size_t n_pus = (size_t)hwloc_get_nbobjs_by_type(topology, HWLOC_OBJ_PU);
+        if (n_dag_workers && n_pus >= n_threads * (n_dag_workers + 1))
+        {
+            for (size_t t = 0; t < n_threads; t++)
+            {
+                puids.push_back(t * (n_dag_workers + 1));
+                for (size_t w = 0; w < n_dag_workers; w++)
+                    dag_puids.push_back(t * (n_dag_workers + 1) + 1 + w);
+            }
+            for (size_t p = 0; p < n_threads * (n_dag_workers + 1); p++)
+                allowed_pus.insert(hwloc_get_obj_by_type(topology, HWLOC_OBJ_PU, p)->os_index);
+        }
+        else
+            std::cout << "# (i) Not enough PUs to pin the threads and the workers, the pinning check is skipped."
+                      << std::endl
+                      << "#" << std::endl;
+        hwloc_topology_destroy(topology);
+    }
+#else
+    if (pin_workers)
+        std::cout << "# (i) StreamPU has not been linked with hwloc, the pinning check is skipped." << std::endl
+                  << "#" << std::endl;
+#endif
+    const bool check_pinning = !dag_puids.empty();
+    if (check_pinning) tools::Thread_pinning::init();
+
+    // modules creation: 'n_branches' chains of 'branch_length' incrementers read the output of the initializer, the
+    // chains are independent of each other
+    module::Initializer<uint8_t> initializer(data_length);
+    std::vector<std::vector<std::shared_ptr<module::Incrementer<uint8_t>>>> incs(n_branches);
+    for (size_t b = 0; b < n_branches; b++)
+    {
+        incs[b].resize(branch_length);
+        for (size_t s = 0; s < branch_length; s++)
+        {
+            incs[b][s].reset(new module::Incrementer<uint8_t>(data_length, sleep_time_ns));
+            incs[b][s]->set_custom_name("Inc" + std::to_string(b) + "_" + std::to_string(s));
+        }
+    }
+    std::vector<std::shared_ptr<module::Binaryop_add<uint8_t>>> adds(join ? n_branches - 1 : 0);
+    for (size_t a = 0; a < adds.size(); a++)
+        adds[a].reset(new module::Binaryop_add<uint8_t>(data_length));
+    std::vector<std::shared_ptr<module::Finalizer<uint8_t>>> finalizers(join ? 1 : n_branches);
+    for (size_t f = 0; f < finalizers.size(); f++)
+        finalizers[f].reset(new module::Finalizer<uint8_t>(data_length));
+
+    // sockets binding
+    for (size_t b = 0; b < n_branches; b++)
+    {
+        (*incs[b][0])["increment::in"] = initializer["initialize::out"];
+        for (size_t s = 1; s < branch_length; s++)
+            (*incs[b][s])["increment::in"] = (*incs[b][s - 1])["increment::out"];
+    }
+    if (join)
+    {
+        // the adders form a chain: ((b0 + b1) + b2) + ...
+        for (size_t a = 0; a < adds.size(); a++)
+        {
+            (*adds[a])["perform::in0"] =
+              a == 0 ? (*incs[0][branch_length - 1])["increment::out"] : (*adds[a - 1])["perform::out"];
+            (*adds[a])["perform::in1"] = (*incs[a + 1][branch_length - 1])["increment::out"];
+        }
+        (*finalizers[0])["finalize::in"] =
+          adds.empty() ? (*incs[0][branch_length - 1])["increment::out"] : (*adds.back())["perform::out"];
+    }
+    else
+        for (size_t b = 0; b < n_branches; b++)
+            (*finalizers[b])["finalize::in"] = (*incs[b][branch_length - 1])["increment::out"];
+
+    // when the pinning is checked, one probe per branch records the PUs where the independent tasks are executed
+    std::set<unsigned> used_pus;
+    std::mutex mtx_pus;
+    std::vector<std::shared_ptr<module::Stateless>> probes(check_pinning ? n_branches : 0);
+    for (size_t b = 0; b < probes.size(); b++)
+    {
+        probes[b].reset(new module::Stateless());
+        probes[b]->set_name("Probe");
+        auto& tsk = probes[b]->create_task("probe");
+        probes[b]->create_socket_in<uint8_t>(tsk, "in", data_length);
+        probes[b]->create_codelet(tsk,
+                                  [&used_pus, &mtx_pus, sleep_time_ns](module::Module&, runtime::Task&, const size_t)
+                                  {
+                                      std::this_thread::sleep_for(std::chrono::nanoseconds(sleep_time_ns));
+#ifdef SPU_HWLOC
+                                      std::lock_guard<std::mutex> lock(mtx_pus);
+                                      used_pus.insert((unsigned)sched_getcpu());
+#endif
+                                      return runtime::status_t::SUCCESS;
+                                  });
+        (*probes[b])["probe::in"] = initializer["initialize::out"];
+    }
+
+    runtime::Sequence sequence(initializer("initialize"), n_threads, check_pinning, puids);
+    sequence.set_no_copy_mode(no_copy_mode);
+    sequence.set_n_dag_workers(n_dag_workers, dag_puids);
+
+    for (auto cur_module : sequence.get_modules<tools::Interface_reset>())
+        cur_module->reset();
+
+    for (auto& mod : sequence.get_modules<module::Module>(false))
+        for (auto& tsk : mod->tasks)
+        {
+            tsk->reset();
+            tsk->set_stats(false);
+            tsk->set_fast(true);
+        }
+
+    if (!dot_filepath.empty())
+    {
+        std::ofstream file(dot_filepath);
+        sequence.export_dot(file);
+    }
+
+    std::atomic<size_t> counter(0);
+    auto t_start = std::chrono::steady_clock::now();
+    if (!step_by_step)
+        sequence.exec([&counter, n_exec]() { return ++counter >= n_exec; });
+    else
+    {
+        for (size_t e = 0; e < n_exec / n_threads; e++)
+            for (size_t tid = 0; tid < n_threads; tid++)
+                sequence.exec_seq(tid);
+        counter = (n_exec / n_threads) * n_threads;
+    }
+    std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - t_start;
+
+    std::cout << "# Elapsed time:     " << duration.count() / 1e6 << " ms" << std::endl;
+    std::cout << "# Time per exec:    " << (double)duration.count() * n_threads / (double)counter / 1e3 << " us"
+              << std::endl;
+    std::cout << "# Critical path:    " << (double)(branch_length * sleep_time_ns) / 1e3 << " us (tasks only)"
+              << std::endl;
+
+    // verification of the sequence execution
+    bool tests_passed = true;
+    const int expected = (int)((join ? n_branches * branch_length : branch_length) % 256);
+    for (auto& finalizer : finalizers)
+        for (auto cur_finalizer : sequence.get_cloned_modules<module::Finalizer<uint8_t>>(*finalizer))
+            for (auto d : cur_finalizer->get_final_data()[0])
+                if (d != expected) tests_passed = false;
+
+    // the workers have to run the independent tasks on their own PUs
+    if (check_pinning)
+    {
+        std::cout << "# Used PUs:         " << used_pus.size() << " (" << allowed_pus.size() << " allowed)"
+                  << std::endl;
+        if (used_pus.size() < 2) tests_passed = false;
+        for (auto pu : used_pus)
+            if (!allowed_pus.count(pu)) tests_passed = false;
+        tools::Thread_pinning::destroy();
+    }
+
+    if (tests_passed)
+        std::cout << "# " << rang::style::bold << rang::fg::green << "Tests passed!" << rang::style::reset << std::endl;
+    else
+        std::cout << "# " << rang::style::bold << rang::fg::red << "Tests failed :-(" << rang::style::reset
+                  << std::endl;
+
+    return !tests_passed;
+}
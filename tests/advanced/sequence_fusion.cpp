@@ -0,0 +1,269 @@
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <getopt.h>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <streampu.hpp>
+using namespace spu;
+using namespace spu::runtime;
+
+// execute the sequence 'n_exec' times and return the elapsed time in nanoseconds
+static double
+run(runtime::Sequence& sequence, const size_t n_exec)
+{
+    std::atomic<size_t> counter(0);
+    auto t_start = std::chrono::steady_clock::now();
+    sequence.exec([&counter, n_exec]() { return ++counter >= n_exec; });
+    std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - t_start;
+    return (double)duration.count();
+}
+
+// compare the data of the finalizers to the processing of 'in' by the chain: neg, add 'in', abs, sub 'scalar', neg,
+// add 'in', ...
+static bool
+check(runtime::Sequence& sequence,
+      module::Finalizer<int32_t>& finalizer,
+      const std::vector<int32_t>& in,
+      const int32_t scalar,
+      const size_t n_stages)
+{
+    std::vector<int32_t> expected(in);
+    for (size_t s = 0; s < n_stages; s++)
+        for (size_t e = 0; e < expected.size(); e++)
+            switch (s % 4)
+            {
+                case 0:
+                    expected[e] = -expected[e];
+                    break;
+                case 1:
+                    expected[e] = expected[e] + in[e];
+                    break;
+                case 2:
+                    expected[e] = std::abs(expected[e]);
+                    break;
+                case 3:
+                    expected[e] = expected[e] - scalar;
+                    break;
+            }
+
+    for (auto cur_finalizer : sequence.get_cloned_modules<module::Finalizer<int32_t>>(finalizer))
+        for (auto& frame : cur_finalizer->get_final_data())
+            if (frame != expected) return false;
+    return true;
+}
+
+int
+main(int argc, char** argv)
+{
+    tools::Signal_handler::init();
+
+    option longopts[] = { { "n-threads", required_argument, NULL, 't' },
+                          { "n-stages", required_argument, NULL, 'n' },
+                          { "n-exec", required_argument, NULL, 'e' },
+                          { "n-frames", required_argument, NULL, 'f' },
+                          { "data-length", required_argument, NULL, 'd' },
+                          { "dot-filepath", required_argument, NULL, 'o' },
+                          { "copy-mode", no_argument, NULL, 'c' },
+                          { "help", no_argument, NULL, 'h' },
+                          { 0 } };
+
+    size_t n_threads = 1;
+    size_t n_stages = 8;
+    size_t n_exec = 1000;
+    size_t n_frames = 1;
+    size_t data_length = 65536;
+    std::string dot_filepath;
+    bool no_copy_mode = true;
+
+    while (1)
+    {
+        const int opt = getopt_long(argc, argv, "t:n:e:f:d:o:ch", longopts, 0);
+        if (opt == -1) break;
+        switch (opt)
+        {
+            case 't':
+                n_threads = atoi(optarg);
+                break;
+            case 'n':
+                n_stages = atoi(optarg);
+                break;
+            case 'e':
+                n_exec = atoi(optarg);
+                break;
+            case 'f':
+                n_frames = atoi(optarg);
+                break;
+            case 'd':
+                data_length = atoi(optarg);
+                break;
+            case 'o':
+                dot_filepath = std::string(optarg);
+                break;
+            case 'c':
+                no_copy_mode = false;
+                break;
+            case 'h':
+                std::cout << "usage: " << argv[0] << " [options]" << std::endl;
+                std::cout << std::endl;
+                std::cout << "  -t, --n-threads       "
+                          << "Number of threads to run in parallel                                  "
+                          << "[" << n_threads << "]" << std::endl;
+                std::cout << "  -n, --n-stages        "
+                          << "Number of element-wise tasks in the chain                             "
+                          << "[" << n_stages << "]" << std::endl;
+                std::cout << "  -e, --n-exec          "
+                          << "Number of sequence executions                                         "
+                          << "[" << n_exec << "]" << std::endl;
+                std::cout << "  -f, --n-frames        "
+                          << "Number of frames processed in one execution of the sequence           "
+                          << "[" << n_frames << "]" << std::endl;
+                std::cout << "  -d, --data-length     "
+                          << "Number of 32-bit elements in one frame                                "
+                          << "[" << data_length << "]" << std::endl;
+                std::cout << "  -o, --dot-filepath    "
+                          << "Path to dot output file                                               "
+                          << "[" << (dot_filepath.empty() ? "empty" : "\"" + dot_filepath + "\"") << "]" << std::endl;
+                std::cout << "  -c, --copy-mode       "
+                          << "Enable to copy data in sequence (performance will be reduced)         "
+                          << "[" << (no_copy_mode ? "false" : "true") << "]" << std::endl;
+                std::cout << "  -h, --help            "
+                          << "This help                                                             "
+                          << "[false]" << std::endl;
+                exit(0);
+                break;
+            default:
+                break;
+        }
+    }
+
+    std::cout << "#########################################" << std::endl;
+    std::cout << "# Micro-benchmark: Sequence fusion      #" << std::endl;
+    std::cout << "#########################################" << std::endl;
+    std::cout << "#" << std::endl;
+
+    std::cout << "# Command line arguments:" << std::endl;
+    std::cout << "#   - n_threads      = " << n_threads << std::endl;
+    std::cout << "#   - n_stages       = " << n_stages << std::endl;
+    std::cout << "#   - n_exec         = " << n_exec << std::endl;
+    std::cout << "#   - n_frames       = " << n_frames << std::endl;
+    std::cout << "#   - data_length    = " << data_length << std::endl;
+    std::cout << "#   - dot_filepath   = " << (dot_filepath.empty() ? "[empty]" : dot_filepath.c_str()) << std::endl;
+    std::cout << "#   - no_copy_mode   = " << (no_copy_mode ? "true" : "false") << std::endl;
+    std::cout << "#" << std::endl;
+
+    // modules creation: a chain of 'n_stages' element-wise tasks, the binary operations read the output of the
+    // initializer or a scalar
+    const int32_t scalar = 3;
+    module::Initializer<int32_t> initializer(data_length);
+    module::Initializer<int32_t> initializer_scalar(1);
+    initializer_scalar.set_init_data(scalar);
+    module::Finalizer<int32_t> finalizer(data_length);
+
+    std::vector<std::shared_ptr<module::Module>> stages(n_stages);
+    std::vector<runtime::Socket*> outs(n_stages);
+    for (size_t s = 0; s < n_stages; s++)
+    {
+        switch (s % 4)
+        {
+            case 0:
+                stages[s].reset(new module::Unaryop_neg<int32_t>(data_length));
+                (*stages[s])["perform::in"] = s ? *outs[s - 1] : initializer["initialize::out"];
+                break;
+            case 1:
+                stages[s].reset(new module::Binaryop_add<int32_t>(data_length));
+                (*stages[s])["perform::in0"] = *outs[s - 1];
+                (*stages[s])["perform::in1"] = initializer["initialize::out"];
+                break;
+            case 2:
+                stages[s].reset(new module::Unaryop_abs<int32_t>(data_length));
+                (*stages[s])["perform::in"] = *outs[s - 1];
+                break;
+            case 3:
+                stages[s].reset(new module::Binaryop_sub<int32_t>(data_length, 1));
+                (*stages[s])["perform::in0"] = *outs[s - 1];
+                (*stages[s])["perform::in1"] = initializer_scalar["initialize::out"];
+                break;
+        }
+        stages[s]->set_custom_name("Stage" + std::to_string(s));
+        outs[s] = &(*stages[s])["perform::out"];
+    }
+    finalizer["finalize::in"] = n_stages ? *outs[n_stages - 1] : initializer["initialize::out"];
+
+    std::vector<runtime::Task*> firsts = { &initializer_scalar("initialize"), &initializer("initialize") };
+    runtime::Sequence sequence(firsts, n_threads);
+    sequence.set_n_frames(n_frames);
+    sequence.set_no_copy_mode(no_copy_mode);
+
+    for (auto& mod : sequence.get_modules<module::Module>(false))
+        for (auto& tsk : mod->tasks)
+        {
+            tsk->reset();
+            tsk->set_stats(false);
+            tsk->set_fast(true);
+        }
+
+    if (!dot_filepath.empty())
+    {
+        std::ofstream file(dot_filepath);
+        sequence.export_dot(file);
+    }
+
+    std::vector<int32_t> in(data_length);
+    for (size_t e = 0; e < data_length; e++)
+        in[e] = (int32_t)(e % 64) - 32;
+    for (auto cur_initializer : sequence.get_cloned_modules<module::Initializer<int32_t>>(initializer))
+        cur_initializer->set_init_data(in);
+
+    const double duration = run(sequence, n_exec);
+    bool tests_passed = check(sequence, finalizer, in, scalar, n_stages);
+
+    // the input data are modified so the results of the fused chains can't be the results of the previous executions
+    for (size_t e = 0; e < data_length; e++)
+        in[e] = (int32_t)(e % 32) - 8;
+    for (auto cur_initializer : sequence.get_cloned_modules<module::Initializer<int32_t>>(initializer))
+        cur_initializer->set_init_data(in);
+
+    // the fused tasks are timed by chain, their statistics and their number of calls have to be updated anyway
+    for (auto& mod : sequence.get_modules<module::Module>(false))
+        for (auto& tsk : mod->tasks)
+        {
+            tsk->reset();
+            tsk->set_stats(true);
+        }
+
+    sequence.set_fusion(true);
+    const double duration_fused = run(sequence, n_exec);
+    tests_passed &= check(sequence, finalizer, in, scalar, n_stages);
+
+    uint32_t n_calls = 0;
+    for (auto cur_initializer : sequence.get_cloned_modules<module::Initializer<int32_t>>(initializer))
+        n_calls += (*cur_initializer)("initialize").get_n_calls();
+    for (size_t s = 0; s < n_stages; s++)
+    {
+        uint32_t n_calls_stage = 0, n_calls_timed_stage = 0;
+        for (auto cur_stage : sequence.get_cloned_modules<module::Module>(*stages[s]))
+        {
+            n_calls_stage += (*cur_stage)("perform").get_n_calls();
+            n_calls_timed_stage += (*cur_stage)("perform").get_n_calls_timed();
+        }
+        tests_passed &= n_calls_stage == n_calls && n_calls_timed_stage == n_calls;
+    }
+
+    const double n_elmts = (double)(n_exec * n_frames * data_length);
+    std::cout << "# Time per element (not fused): " << duration * n_threads / n_elmts << " ns" << std::endl;
+    std::cout << "# Time per element (fused):     " << duration_fused * n_threads / n_elmts << " ns" << std::endl;
+    std::cout << "# Speedup:                      " << duration / duration_fused << std::endl;
+
+    if (tests_passed)
+        std::cout << "# " << rang::style::bold << rang::fg::green << "Tests passed!" << rang::style::reset << std::endl;
+    else
+        std::cout << "# " << rang::style::bold << rang::fg::red << "Tests failed :-(" << rang::style::reset
+                  << std::endl;
+
+    return !tests_passed;
+}
@@ -0,0 +1,251 @@
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <getopt.h>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <streampu.hpp>
+using namespace spu;
+using namespace spu::runtime;
+
+int
+main(int argc, char** argv)
+{
+    tools::Signal_handler::init();
+
+    option longopts[] = { { "n-threads", required_argument, NULL, 't' },
+                          { "n-tasks", required_argument, NULL, 'n' },
+                          { "n-exec", required_argument, NULL, 'e' },
+                          { "n-loop", required_argument, NULL, 'i' },
+                          { "n-exec-calls", required_argument, NULL, 'p' },
+                          { "data-length", required_argument, NULL, 'd' },
+                          { "dot-filepath", required_argument, NULL, 'o' },
+                          { "copy-mode", no_argument, NULL, 'c' },
+                          { "step-by-step", no_argument, NULL, 'b' },
+                          { "rebind", no_argument, NULL, 'r' },
+                          { "help", no_argument, NULL, 'h' },
+                          { 0 } };
+
+    size_t n_threads = 1;
+    size_t n_tasks = 64;
+    size_t n_exec = 100000;
+    size_t n_loop = 0;
+    size_t n_exec_calls = 1;
+    size_t data_length = 1;
+    std::string dot_filepath;
+    bool no_copy_mode = true;
+    bool step_by_step = false;
+    bool rebind = false;
+
+    while (1)
+    {
+        const int opt = getopt_long(argc, argv, "t:n:e:i:p:d:o:cbrh", longopts, 0);
+        if (opt == -1) break;
+        switch (opt)
+        {
+            case 't':
+                n_threads = atoi(optarg);
+                break;
+            case 'n':
+                n_tasks = atoi(optarg);
+                break;
+            case 'e':
+                n_exec = atoi(optarg);
+                break;
+            case 'i':
+                n_loop = atoi(optarg);
+                break;
+            case 'p':
+                n_exec_calls = atoi(optarg);
+                break;
+            case 'd':
+                data_length = atoi(optarg);
+                break;
+            case 'o':
+                dot_filepath = std::string(optarg);
+                break;
+            case 'c':
+                no_copy_mode = false;
+                break;
+            case 'b':
+                step_by_step = true;
+                break;
+            case 'r':
+                rebind = true;
+                break;
+            case 'h':
+                std::cout << "usage: " << argv[0] << " [options]" << std::endl;
+                std::cout << std::endl;
+                std::cout << "  -t, --n-threads       "
+                          << "Number of threads to run in parallel                                  "
+                          << "[" << n_threads << "]" << std::endl;
+                std::cout << "  -n, --n-tasks         "
+                          << "Number of incrementation tasks in the chain                           "
+                          << "[" << n_tasks << "]" << std::endl;
+                std::cout << "  -e, --n-exec          "
+                          << "Number of sequence executions                                         "
+                          << "[" << n_exec << "]" << std::endl;
+                std::cout << "  -i, --n-loop          "
+                          << "Number of iterations of a for loop around the tasks (0 = no loop)     "
+                          << "[" << n_loop << "]" << std::endl;
+                std::cout << "  -p, --n-exec-calls    "
+                          << "Number of calls to 'exec', the executions are split between the calls "
+                          << "[" << n_exec_calls << "]" << std::endl;
+                std::cout << "  -d, --data-length     "
+                          << "Size of data to process in one task (in bytes)                        "
+                          << "[" << data_length << "]" << std::endl;
+                std::cout << "  -o, --dot-filepath    "
+                          << "Path to dot output file                                               "
+                          << "[" << (dot_filepath.empty() ? "empty" : "\"" + dot_filepath + "\"") << "]" << std::endl;
+                std::cout << "  -c, --copy-mode       "
+                          << "Enable to copy data in sequence (performance will be reduced)         "
+                          << "[" << (no_copy_mode ? "false" : "true") << "]" << std::endl;
+                std::cout << "  -b, --step-by-step    "
+                          << "Enable step-by-step sequence execution ('exec_seq')                   "
+                          << "[" << (step_by_step ? "true" : "false") << "]" << std::endl;
+                std::cout << "  -r, --rebind          "
+                          << "Unbind and bind again the finalizer between the calls to 'exec'       "
+                          << "[" << (rebind ? "true" : "false") << "]" << std::endl;
+                std::cout << "  -h, --help            "
+                          << "This help                                                             "
+                          << "[false]" << std::endl;
+                exit(0);
+                break;
+            default:
+                break;
+        }
+    }
+
+    std::cout << "#########################################" << std::endl;
+    std::cout << "# Micro-benchmark: Sequence overhead    #" << std::endl;
+    std::cout << "#########################################" << std::endl;
+    std::cout << "#" << std::endl;
+
+    std::cout << "# Command line arguments:" << std::endl;
+    std::cout << "#   - n_threads      = " << n_threads << std::endl;
+    std::cout << "#   - n_tasks        = " << n_tasks << std::endl;
+    std::cout << "#   - n_exec         = " << n_exec << std::endl;
+    std::cout << "#   - n_loop         = " << n_loop << std::endl;
+    std::cout << "#   - n_exec_calls   = " << n_exec_calls << std::endl;
+    std::cout << "#   - data_length    = " << data_length << std::endl;
+    std::cout << "#   - dot_filepath   = " << (dot_filepath.empty() ? "[empty]" : dot_filepath.c_str()) << std::endl;
+    std::cout << "#   - no_copy_mode   = " << (no_copy_mode ? "true" : "false") << std::endl;
+    std::cout << "#   - step_by_step   = " << (step_by_step ? "true" : "false") << std::endl;
+    std::cout << "#   - rebind         = " << (rebind ? "true" : "false") << std::endl;
+    std::cout << "#" << std::endl;
+
+    // modules creation, the incrementers do not sleep: the duration of a task is a few nanoseconds
+    module::Initializer<uint8_t> initializer(data_length);
+    module::Finalizer<uint8_t> finalizer(data_length);
+    module::Switcher switcher(2, data_length, typeid(uint8_t));
+    module::Iterator iterator(n_loop);
+
+    std::vector<std::shared_ptr<module::Incrementer<uint8_t>>> incs(n_tasks);
+    for (size_t s = 0; s < incs.size(); s++)
+    {
+        incs[s].reset(new module::Incrementer<uint8_t>(data_length, 0));
+        incs[s]->set_custom_name("Inc" + std::to_string(s));
+    }
+
+    // sockets binding
+    if (n_loop)
+    {
+        switcher["select::in_data1"] = initializer["initialize::out"];
+        iterator("iterate") = switcher("select");
+        switcher["commute::in_data"] = switcher["select::out_data"];
+        switcher["commute::in_ctrl"] = iterator["iterate::out"];
+        (*incs[0])["increment::in"] = switcher["commute::out_data0"];
+        switcher["select::in_data0"] = (*incs[incs.size() - 1])["increment::out"];
+        finalizer["finalize::in"] = switcher["commute::out_data1"];
+    }
+    else
+    {
+        (*incs[0])["increment::in"] = initializer["initialize::out"];
+        finalizer["finalize::in"] = (*incs[incs.size() - 1])["increment::out"];
+    }
+    for (size_t s = 0; s < incs.size() - 1; s++)
+        (*incs[s + 1])["increment::in"] = (*incs[s])["increment::out"];
+
+    runtime::Sequence sequence(initializer("initialize"), n_threads);
+    sequence.set_no_copy_mode(no_copy_mode);
+
+    for (auto cur_module : sequence.get_modules<tools::Interface_reset>())
+        cur_module->reset();
+
+    for (auto& mod : sequence.get_modules<module::Module>(false))
+        for (auto& tsk : mod->tasks)
+        {
+            tsk->reset();
+            tsk->set_stats(false);
+            tsk->set_fast(true);
+        }
+
+    if (!dot_filepath.empty())
+    {
+        std::ofstream file(dot_filepath);
+        sequence.export_dot(file);
+    }
+
+    // number of tasks executed per execution of the sequence
+    const size_t n_tasks_per_exec = n_loop ? 2 + 3 * (n_loop + 1) + n_tasks * n_loop : 2 + n_tasks;
+
+    std::atomic<size_t> counter(0);
+    auto t_start = std::chrono::steady_clock::now();
+    if (!step_by_step)
+    {
+        // the cost of the setup of an execution (generation of the processes, wake up of the threads) is amortized
+        // over less executions when there are many calls
+        for (size_t c = 0; c < n_exec_calls; c++)
+        {
+            const size_t n_exec_call = (c + 1) * n_exec / n_exec_calls;
+            sequence.exec([&counter, n_exec_call]() { return ++counter >= n_exec_call; });
+
+            // the bindings are modified between two calls: the no-copy processes have to be generated again
+            if (rebind)
+                for (auto cur_finalizer : sequence.get_cloned_modules<module::Finalizer<uint8_t>>(finalizer))
+                {
+                    auto& sck_in = (*cur_finalizer)["finalize::in"];
+                    auto& sck_out = sck_in.get_bound_socket();
+                    sck_in.unbind(sck_out);
+                    sck_in = sck_out;
+                }
+        }
+    }
+    else
+    {
+        for (size_t e = 0; e < n_exec / n_threads; e++)
+            for (size_t tid = 0; tid < n_threads; tid++)
+            {
+                for (auto cur_module : sequence.get_modules<tools::Interface_reset>())
+                    cur_module->reset();
+                sequence.exec_seq(tid);
+            }
+        counter = (n_exec / n_threads) * n_threads;
+    }
+    std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - t_start;
+
+    const double n_executed_tasks = (double)(counter * n_tasks_per_exec);
+    std::cout << "# Elapsed time:     " << duration.count() / 1e6 << " ms" << std::endl;
+    std::cout << "# Executed tasks:   " << (size_t)n_executed_tasks << std::endl;
+    std::cout << "# Time per task:    " << (double)duration.count() * n_threads / n_executed_tasks << " ns"
+              << std::endl;
+
+    // verification of the sequence execution
+    bool tests_passed = true;
+    const int expected = (int)((n_tasks * (n_loop ? n_loop : 1)) % 256);
+    for (auto cur_finalizer : sequence.get_cloned_modules<module::Finalizer<uint8_t>>(finalizer))
+        for (auto d : cur_finalizer->get_final_data()[0])
+            if (d != expected) tests_passed = false;
+
+    if (tests_passed)
+        std::cout << "# " << rang::style::bold << rang::fg::green << "Tests passed!" << rang::style::reset << std::endl;
+    else
+        std::cout << "# " << rang::style::bold << rang::fg::red << "Tests failed :-(" << rang::style::reset
+                  << std::endl;
+
+    return !tests_passed;
+}
@@ -0,0 +1,241 @@
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <getopt.h>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <streampu.hpp>
+
+#include "Incrementer_chain.hpp"
+
+using namespace spu;
+using namespace spu::runtime;
+
+int
+main(int argc, char** argv)
+{
+    tools::Signal_handler::init();
+
+    option longopts[] = { { "n-threads", required_argument, NULL, 't' },
+                          { "n-incs", required_argument, NULL, 'n' },
+                          { "n-exec", required_argument, NULL, 'e' },
+                          { "n-frames", required_argument, NULL, 'f' },
+                          { "data-length", required_argument, NULL, 'd' },
+                          { "dot-filepath", required_argument, NULL, 'o' },
+                          { "copy-mode", no_argument, NULL, 'c' },
+                          { "help", no_argument, NULL, 'h' },
+                          { 0 } };
+
+    size_t n_threads = 4;
+    size_t n_incs = 16;
+    size_t n_exec = 100;
+    size_t n_frames = 8;
+    size_t data_length = 2048;
+    std::string dot_filepath;
+    bool no_copy_mode = true;
+
+    while (1)
+    {
+        const int opt = getopt_long(argc, argv, "t:n:e:f:d:o:ch", longopts, 0);
+        if (opt == -1) break;
+        switch (opt)
+        {
+            case 't':
+                n_threads = atoi(optarg);
+                break;
+            case 'n':
+                n_incs = atoi(optarg);
+                break;
+            case 'e':
+                n_exec = atoi(optarg);
+                break;
+            case 'f':
+                n_frames = atoi(optarg);
+                break;
+            case 'd':
+                data_length = atoi(optarg);
+                break;
+            case 'o':
+                dot_filepath = std::string(optarg);
+                break;
+            case 'c':
+                no_copy_mode = false;
+                break;
+            case 'h':
+                std::cout << "usage: " << argv[0] << " [options]" << std::endl;
+                std::cout << std::endl;
+                std::cout << "  -t, --n-threads       "
+                          << "Maximal number of threads to run in parallel                          "
+                          << "[" << n_threads << "]" << std::endl;
+                std::cout << "  -n, --n-incs          "
+                          << "Number of incrementers in the chain                                   "
+                          << "[" << n_incs << "]" << std::endl;
+                std::cout << "  -e, --n-exec          "
+                          << "Number of sequence executions after each reconfiguration              "
+                          << "[" << n_exec << "]" << std::endl;
+                std::cout << "  -f, --n-frames        "
+                          << "Maximal number of frames to process in one task                       "
+                          << "[" << n_frames << "]" << std::endl;
+                std::cout << "  -d, --data-length     "
+                          << "Size of data to process in one task (in bytes)                        "
+                          << "[" << data_length << "]" << std::endl;
+                std::cout << "  -o, --dot-filepath    "
+                          << "Path to dot output file                                               "
+                          << "[" << (dot_filepath.empty() ? "empty" : "\"" + dot_filepath + "\"") << "]" << std::endl;
+                std::cout << "  -c, --copy-mode       "
+                          << "Enable to copy data in sequence (performance will be reduced)         "
+                          << "[" << (no_copy_mode ? "false" : "true") << "]" << std::endl;
+                std::cout << "  -h, --help            "
+                          << "This help                                                             "
+                          << "[false]" << std::endl;
+                exit(0);
+                break;
+            default:
+                break;
+        }
+    }
+
+    std::cout << "#########################################" << std::endl;
+    std::cout << "# Micro-benchmark: Reconfiguration      #" << std::endl;
+    std::cout << "#########################################" << std::endl;
+    std::cout << "#" << std::endl;
+
+    std::cout << "# Command line arguments:" << std::endl;
+    std::cout << "#   - n_threads      = " << n_threads << std::endl;
+    std::cout << "#   - n_incs         = " << n_incs << std::endl;
+    std::cout << "#   - n_exec         = " << n_exec << std::endl;
+    std::cout << "#   - n_frames       = " << n_frames << std::endl;
+    std::cout << "#   - data_length    = " << data_length << std::endl;
+    std::cout << "#   - dot_filepath   = " << (dot_filepath.empty() ? "[empty]" : dot_filepath.c_str()) << std::endl;
+    std::cout << "#   - no_copy_mode   = " << (no_copy_mode ? "true" : "false") << std::endl;
+    std::cout << "#" << std::endl;
+
+    // modules creation and sockets binding
+    Incrementer_chain chain(data_length, n_incs);
+    auto& initializer = chain.initializer;
+    auto& finalizer = chain.finalizer;
+    auto& incs = chain.incs;
+
+    runtime::Sequence sequence(initializer("initialize"), 1);
+    sequence.set_no_copy_mode(no_copy_mode);
+    Incrementer_chain::reset_tasks(sequence);
+
+    const int expected = (int)(n_incs % 256);
+    bool tests_passed = true;
+
+    // 1) add and remove replicated sequences
+    sequence.exec_n(n_exec * sequence.get_n_frames());
+    tests_passed &= chain.check(sequence, expected);
+
+    auto t_start = std::chrono::steady_clock::now();
+    sequence.set_n_threads(n_threads);
+    std::chrono::nanoseconds duration_grow = std::chrono::steady_clock::now() - t_start;
+
+    tests_passed &= sequence.get_n_threads() == n_threads;
+    tests_passed &= sequence.get_cloned_modules<module::Finalizer<uint8_t>>(finalizer).size() == n_threads;
+    Incrementer_chain::reset_tasks(sequence);
+    sequence.exec_n(n_exec * sequence.get_n_frames());
+    tests_passed &= chain.check(sequence, expected);
+
+    t_start = std::chrono::steady_clock::now();
+    {
+        runtime::Sequence sequence_rebuilt(initializer("initialize"), n_threads);
+        sequence_rebuilt.set_no_copy_mode(no_copy_mode);
+    }
+    std::chrono::nanoseconds duration_rebuild = std::chrono::steady_clock::now() - t_start;
+
+    sequence.set_n_threads(1);
+    tests_passed &= sequence.get_n_threads() == 1;
+    tests_passed &= sequence.get_cloned_modules<module::Finalizer<uint8_t>>(finalizer).size() == 1;
+    sequence.exec_n(n_exec * sequence.get_n_frames());
+    tests_passed &= chain.check(sequence, expected);
+
+    std::cout << "# Time to add " << n_threads - 1 << " replicated sequence(s): " << duration_grow.count() / 1e3
+              << " us" << std::endl;
+    std::cout << "# Time to rebuild the sequence:    " << duration_rebuild.count() / 1e3 << " us (deletion included)"
+              << std::endl;
+
+    // 2) change the number of frames, the buffers are reused when their capacity is large enough and then the sockets
+    // keep their bindings
+    t_start = std::chrono::steady_clock::now();
+    sequence.set_n_frames(n_frames);
+    std::chrono::nanoseconds duration_realloc = std::chrono::steady_clock::now() - t_start;
+    auto dataptr = (*incs[0])["increment::out"].get_dataptr();
+    t_start = std::chrono::steady_clock::now();
+    sequence.set_n_frames(n_frames > 1 ? n_frames / 2 : 1);
+    std::chrono::nanoseconds duration_in_place = std::chrono::steady_clock::now() - t_start;
+    tests_passed &= (*incs[0])["increment::out"].get_dataptr() == dataptr;
+    tests_passed &= (*incs[1])["increment::in"].get_dataptr() == dataptr;
+    tests_passed &= (*incs[1])["increment::in"].get_databytes() == (*incs[0])["increment::out"].get_databytes();
+    sequence.exec_n(n_exec * sequence.get_n_frames());
+    tests_passed &= chain.check(sequence, expected);
+    sequence.set_n_frames(n_frames);
+    tests_passed &= (*incs[0])["increment::out"].get_dataptr() == dataptr;
+    tests_passed &= (*incs[1])["increment::in"].get_databytes() == (*incs[0])["increment::out"].get_databytes();
+    sequence.exec_n(n_exec * sequence.get_n_frames());
+    tests_passed &= chain.check(sequence, expected);
+
+    std::cout << "# Time to change the number of frames (reallocation): " << duration_realloc.count() / 1e3 << " us"
+              << std::endl;
+    std::cout << "# Time to change the number of frames (in place):     " << duration_in_place.count() / 1e3 << " us"
+              << std::endl;
+
+    // 3) replace a module by a new implementation in all the replicated sequences
+    sequence.set_n_threads(n_threads);
+    Incrementer_chain::reset_tasks(sequence);
+    const size_t mid = n_incs / 2;
+    module::Incrementer<uint8_t> new_inc(data_length, 0);
+    new_inc.set_custom_name("Inc" + std::to_string(mid) + "_new");
+
+    // the configuration of the tasks of the old module is kept by the new one
+    for (auto cur_inc : sequence.get_cloned_modules<module::Incrementer<uint8_t>>(*incs[mid]))
+        (*cur_inc)("increment").set_stats(true);
+    new_inc("increment").set_fast(false);
+
+    t_start = std::chrono::steady_clock::now();
+    sequence.replace_module(*incs[mid], new_inc);
+    std::chrono::nanoseconds duration_replace = std::chrono::steady_clock::now() - t_start;
+
+    for (auto cur_inc : sequence.get_cloned_modules<module::Incrementer<uint8_t>>(new_inc))
+        tests_passed &= (*cur_inc)("increment").is_stats() && (*cur_inc)("increment").is_fast();
+
+    Incrementer_chain::reset_tasks(sequence);
+    sequence.exec_n(n_exec * sequence.get_n_frames());
+    tests_passed &= chain.check(sequence, expected);
+    tests_passed &= (*incs[mid])("increment").get_n_calls() == 0;
+    size_t n_calls = 0;
+    for (auto cur_inc : sequence.get_cloned_modules<module::Incrementer<uint8_t>>(new_inc))
+        n_calls += (*cur_inc)("increment").get_n_calls();
+    tests_passed &= n_calls == n_exec;
+
+    std::cout << "# Time to replace a module:        " << duration_replace.count() / 1e3 << " us" << std::endl;
+
+    // a module with different sockets can't replace the old one
+    module::Incrementer<uint8_t> bad_inc(data_length + 1, 0);
+    try
+    {
+        sequence.replace_module(new_inc, bad_inc);
+        tests_passed = false;
+    }
+    catch (tools::invalid_argument const&)
+    {
+        // do nothing, this is expected
+    }
+
+    if (!dot_filepath.empty())
+    {
+        std::ofstream file(dot_filepath);
+        sequence.export_dot(file);
+    }
+
+    if (tests_passed)
+        std::cout << "# " << rang::style::bold << rang::fg::green << "Tests passed!" << rang::style::reset << std::endl;
+    else
+        std::cout << "# " << rang::style::bold << rang::fg::red << "Tests failed :-(" << rang::style::reset
+                  << std::endl;
+
+    return !tests_passed;
+}
@@ -0,0 +1,183 @@
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <getopt.h>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <streampu.hpp>
+using namespace spu;
+using namespace spu::runtime;
+
+int
+main(int argc, char** argv)
+{
+    tools::Signal_handler::init();
+
+    option longopts[] = { { "n-threads", required_argument, NULL, 't' },
+                          { "n-delayers", required_argument, NULL, 'n' },
+                          { "n-frames", required_argument, NULL, 'f' },
+                          { "data-length", required_argument, NULL, 'd' },
+                          { "n-exec", required_argument, NULL, 'e' },
+                          { "dot-filepath", required_argument, NULL, 'o' },
+                          { "help", no_argument, NULL, 'h' },
+                          { 0 } };
+
+    size_t n_threads = 64;
+    size_t n_delayers = 4;
+    size_t n_frames = 4;
+    size_t data_length = 1 << 20;
+    size_t n_exec = 1;
+    std::string dot_filepath;
+
+    while (1)
+    {
+        const int opt = getopt_long(argc, argv, "t:n:f:d:e:o:h", longopts, 0);
+        if (opt == -1) break;
+        switch (opt)
+        {
+            case 't':
+                n_threads = atoi(optarg);
+                break;
+            case 'n':
+                n_delayers = atoi(optarg);
+                break;
+            case 'f':
+                n_frames = atoi(optarg);
+                break;
+            case 'd':
+                data_length = atoi(optarg);
+                break;
+            case 'e':
+                n_exec = atoi(optarg);
+                break;
+            case 'o':
+                dot_filepath = std::string(optarg);
+                break;
+            case 'h':
+                std::cout << "usage: " << argv[0] << " [options]" << std::endl;
+                std::cout << std::endl;
+                std::cout << "  -t, --n-threads       "
+                          << "Number of threads to run in parallel                                  "
+                          << "[" << n_threads << "]" << std::endl;
+                std::cout << "  -n, --n-delayers      "
+                          << "Number of delayers in the chain                                       "
+                          << "[" << n_delayers << "]" << std::endl;
+                std::cout << "  -f, --n-frames        "
+                          << "Number of frames to process in one task                               "
+                          << "[" << n_frames << "]" << std::endl;
+                std::cout << "  -d, --data-length     "
+                          << "Size of data to process in one task (in bytes)                        "
+                          << "[" << data_length << "]" << std::endl;
+                std::cout << "  -e, --n-exec          "
+                          << "Number of sequence executions                                         "
+                          << "[" << n_exec << "]" << std::endl;
+                std::cout << "  -o, --dot-filepath    "
+                          << "Path to dot output file                                               "
+                          << "[" << (dot_filepath.empty() ? "empty" : "\"" + dot_filepath + "\"") << "]" << std::endl;
+                std::cout << "  -h, --help            "
+                          << "This help                                                             "
+                          << "[false]" << std::endl;
+                exit(0);
+                break;
+            default:
+                break;
+        }
+    }
+
+    std::cout << "#########################################" << std::endl;
+    std::cout << "# Micro-benchmark: Replication          #" << std::endl;
+    std::cout << "#########################################" << std::endl;
+    std::cout << "#" << std::endl;
+
+    std::cout << "# Command line arguments:" << std::endl;
+    std::cout << "#   - n_threads      = " << n_threads << std::endl;
+    std::cout << "#   - n_delayers     = " << n_delayers << std::endl;
+    std::cout << "#   - n_frames       = " << n_frames << std::endl;
+    std::cout << "#   - data_length    = " << data_length << std::endl;
+    std::cout << "#   - n_exec         = " << n_exec << std::endl;
+    std::cout << "#   - dot_filepath   = " << (dot_filepath.empty() ? "[empty]" : dot_filepath.c_str()) << std::endl;
+    std::cout << "#" << std::endl;
+
+    // modules creation, the initial data of the initializer and the data of the delayers are large
+    module::Initializer<uint8_t> initializer(data_length);
+    initializer.set_n_frames(n_frames);
+    initializer.set_init_data(42);
+    module::Finalizer<uint8_t> finalizer(data_length);
+    finalizer.set_n_frames(n_frames);
+    std::vector<std::shared_ptr<module::Delayer<uint8_t>>> delayers(n_delayers);
+    for (size_t s = 0; s < delayers.size(); s++)
+    {
+        delayers[s].reset(new module::Delayer<uint8_t>(data_length, 0));
+        delayers[s]->set_n_frames(n_frames);
+        delayers[s]->set_custom_name("Dly" + std::to_string(s));
+    }
+
+    // sockets binding, the delayers produce the data they just memorized
+    (*delayers[0])["memorize::in"] = initializer["initialize::out"];
+    for (size_t s = 0; s < delayers.size(); s++)
+    {
+        (*delayers[s])("produce") = (*delayers[s])["memorize::status"];
+        if (s < delayers.size() - 1) (*delayers[s + 1])["memorize::in"] = (*delayers[s])["produce::out"];
+    }
+    finalizer["finalize::in"] = (*delayers[delayers.size() - 1])["produce::out"];
+
+    auto t_start = std::chrono::steady_clock::now();
+    runtime::Sequence sequence(initializer("initialize"), n_threads);
+    std::chrono::nanoseconds duration_build = std::chrono::steady_clock::now() - t_start;
+
+    for (auto& mod : sequence.get_modules<module::Module>(false))
+        for (auto& tsk : mod->tasks)
+        {
+            tsk->reset();
+            tsk->set_stats(false);
+            tsk->set_fast(true);
+        }
+
+    if (!dot_filepath.empty())
+    {
+        std::ofstream file(dot_filepath);
+        sequence.export_dot(file);
+    }
+
+    // the first execution copies the data of the delayers (first 'memorize' on each thread), each thread executes its
+    // replicated sequence once
+    t_start = std::chrono::steady_clock::now();
+    sequence.exec([]() { return true; });
+    std::chrono::nanoseconds duration_first = std::chrono::steady_clock::now() - t_start;
+
+    t_start = std::chrono::steady_clock::now();
+    sequence.exec_n(n_exec * n_threads * sequence.get_n_frames());
+    std::chrono::nanoseconds duration_exec = std::chrono::steady_clock::now() - t_start;
+
+    const size_t replicated_bytes = data_length * n_frames * (n_delayers + 1) * (n_threads - 1);
+    std::cout << "# Replicated module data:   " << replicated_bytes / (1024. * 1024.) << " MB" << std::endl;
+    std::cout << "# Sequence construction:    " << duration_build.count() / 1e6 << " ms" << std::endl;
+    std::cout << "# First execution:          " << duration_first.count() / 1e6 << " ms" << std::endl;
+    std::cout << "# Next executions:          " << duration_exec.count() / 1e6 << " ms" << std::endl;
+
+    bool tests_passed = true;
+    for (auto cur_finalizer : sequence.get_cloned_modules<module::Finalizer<uint8_t>>(finalizer))
+    {
+        tests_passed &= (*cur_finalizer)("finalize").get_n_calls() > 0;
+        for (auto& f : cur_finalizer->get_final_data())
+            for (auto d : f)
+                if (d != 42) tests_passed = false;
+    }
+
+    // the initial data of each clone can still be set independently
+    auto initializers = sequence.get_cloned_modules<module::Initializer<uint8_t>>(initializer);
+    initializers[n_threads - 1]->set_init_data(7);
+    tests_passed &= initializers[n_threads - 1]->get_init_data()[0][0] == 7;
+    tests_passed &= initializers[0]->get_init_data()[0][0] == 42;
+
+    if (tests_passed)
+        std::cout << "# " << rang::style::bold << rang::fg::green << "Tests passed!" << rang::style::reset << std::endl;
+    else
+        std::cout << "# " << rang::style::bold << rang::fg::red << "Tests failed :-(" << rang::style::reset
+                  << std::endl;
+
+    return !tests_passed;
+}
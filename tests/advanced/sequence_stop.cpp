@@ -0,0 +1,213 @@
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <getopt.h>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <streampu.hpp>
+
+#include "Incrementer_chain.hpp"
+
+using namespace spu;
+using namespace spu::runtime;
+
+int
+main(int argc, char** argv)
+{
+    tools::Signal_handler::init();
+
+    option longopts[] = { { "n-threads", required_argument, NULL, 't' },
+                          { "n-tasks", required_argument, NULL, 'n' },
+                          { "n-exec", required_argument, NULL, 'e' },
+                          { "exec-time", required_argument, NULL, 'x' },
+                          { "data-length", required_argument, NULL, 'd' },
+                          { "input-filepath", required_argument, NULL, 'i' },
+                          { "copy-mode", no_argument, NULL, 'c' },
+                          { "help", no_argument, NULL, 'h' },
+                          { 0 } };
+
+    size_t n_threads = 1;
+    size_t n_tasks = 8;
+    size_t n_exec = 100000;
+    size_t exec_time_ms = 20;
+    size_t data_length = 1;
+    std::string in_filepath;
+    bool no_copy_mode = true;
+
+    while (1)
+    {
+        const int opt = getopt_long(argc, argv, "t:n:e:x:d:i:ch", longopts, 0);
+        if (opt == -1) break;
+        switch (opt)
+        {
+            case 't':
+                n_threads = atoi(optarg);
+                break;
+            case 'n':
+                n_tasks = atoi(optarg);
+                break;
+            case 'e':
+                n_exec = atoi(optarg);
+                break;
+            case 'x':
+                exec_time_ms = atoi(optarg);
+                break;
+            case 'd':
+                data_length = atoi(optarg);
+                break;
+            case 'i':
+                in_filepath = std::string(optarg);
+                break;
+            case 'c':
+                no_copy_mode = false;
+                break;
+            case 'h':
+                std::cout << "usage: " << argv[0] << " [options]" << std::endl;
+                std::cout << std::endl;
+                std::cout << "  -t, --n-threads       "
+                          << "Number of threads to run in parallel                                  "
+                          << "[" << n_threads << "]" << std::endl;
+                std::cout << "  -n, --n-tasks         "
+                          << "Number of incrementation tasks in the chain                           "
+                          << "[" << n_tasks << "]" << std::endl;
+                std::cout << "  -e, --n-exec          "
+                          << "Number of sequence executions                                         "
+                          << "[" << n_exec << "]" << std::endl;
+                std::cout << "  -x, --exec-time       "
+                          << "Duration of the timed execution (in milliseconds)                     "
+                          << "[" << exec_time_ms << "]" << std::endl;
+                std::cout << "  -d, --data-length     "
+                          << "Size of data to process in one task (in bytes)                        "
+                          << "[" << data_length << "]" << std::endl;
+                std::cout << "  -i, --input-filepath  "
+                          << "Path to the input file of the execution until done (disabled if empty)"
+                          << "[" << (in_filepath.empty() ? "empty" : "\"" + in_filepath + "\"") << "]" << std::endl;
+                std::cout << "  -c, --copy-mode       "
+                          << "Enable to copy data in sequence (performance will be reduced)         "
+                          << "[" << (no_copy_mode ? "false" : "true") << "]" << std::endl;
+                std::cout << "  -h, --help            "
+                          << "This help                                                             "
+                          << "[false]" << std::endl;
+                exit(0);
+                break;
+            default:
+                break;
+        }
+    }
+
+    std::cout << "#########################################" << std::endl;
+    std::cout << "# Micro-benchmark: Stop conditions      #" << std::endl;
+    std::cout << "#########################################" << std::endl;
+    std::cout << "#" << std::endl;
+
+    std::cout << "# Command line arguments:" << std::endl;
+    std::cout << "#   - n_threads      = " << n_threads << std::endl;
+    std::cout << "#   - n_tasks        = " << n_tasks << std::endl;
+    std::cout << "#   - n_exec         = " << n_exec << std::endl;
+    std::cout << "#   - exec_time_ms   = " << exec_time_ms << std::endl;
+    std::cout << "#   - data_length    = " << data_length << std::endl;
+    std::cout << "#   - in_filepath    = " << (in_filepath.empty() ? "[empty]" : in_filepath.c_str()) << std::endl;
+    std::cout << "#   - no_copy_mode   = " << (no_copy_mode ? "true" : "false") << std::endl;
+    std::cout << "#" << std::endl;
+
+    // modules creation and sockets binding, the incrementers do not sleep: the stop condition is a large part of the
+    // execution time
+    Incrementer_chain chain(data_length, n_tasks);
+
+    runtime::Sequence sequence(chain.initializer("initialize"), n_threads);
+    sequence.set_no_copy_mode(no_copy_mode);
+
+    bool tests_passed = true;
+
+    // 1) stop condition function
+    Incrementer_chain::reset_tasks(sequence);
+    std::atomic<size_t> counter(0);
+    auto t_start = std::chrono::steady_clock::now();
+    sequence.exec([&counter, n_exec]() { return ++counter >= n_exec; });
+    std::chrono::nanoseconds duration_func = std::chrono::steady_clock::now() - t_start;
+    const size_t n_execs_func = chain.get_n_execs(sequence);
+    tests_passed &= n_execs_func >= n_exec;
+
+    // 2) shared budget of executions, the number of executions is exact
+    Incrementer_chain::reset_tasks(sequence);
+    t_start = std::chrono::steady_clock::now();
+    sequence.exec_n(n_exec);
+    std::chrono::nanoseconds duration_n = std::chrono::steady_clock::now() - t_start;
+    const size_t n_execs_n = chain.get_n_execs(sequence);
+    tests_passed &= n_execs_n == n_exec;
+
+    std::cout << "# Time per exec ('exec(stop_condition)'): "
+              << (double)duration_func.count() * n_threads / (double)n_execs_func << " ns (" << n_execs_func
+              << " execs)" << std::endl;
+    std::cout << "# Time per exec ('exec_n(n_exec)'):       "
+              << (double)duration_n.count() * n_threads / (double)n_execs_n << " ns (" << n_execs_n << " execs)"
+              << std::endl;
+
+    // the budget is counted in frames, each execution takes 'get_n_frames()' frames from it
+    sequence.set_n_frames(3);
+    Incrementer_chain::reset_tasks(sequence);
+    sequence.exec_n(10);
+    tests_passed &= chain.get_n_execs(sequence) == 4;
+    sequence.set_n_frames(1);
+
+    // 3) timed execution
+    Incrementer_chain::reset_tasks(sequence);
+    t_start = std::chrono::steady_clock::now();
+    sequence.exec_for(std::chrono::milliseconds(exec_time_ms));
+    std::chrono::nanoseconds duration_for = std::chrono::steady_clock::now() - t_start;
+    tests_passed &= duration_for >= std::chrono::milliseconds(exec_time_ms);
+    tests_passed &= chain.get_n_execs(sequence) > 0;
+
+    std::cout << "# Timed execution:                        " << duration_for.count() / 1e6 << " ms ("
+              << chain.get_n_execs(sequence) << " execs)" << std::endl;
+
+    // the sequence can still be executed after the timer stopped it
+    Incrementer_chain::reset_tasks(sequence);
+    sequence.exec_n(n_threads);
+    tests_passed &= chain.get_n_execs(sequence) == n_threads;
+
+    // 4) execution until done, not possible without a module that implements 'tools::Interface_is_done'
+    try
+    {
+        sequence.exec_until_done();
+        tests_passed = false;
+    }
+    catch (tools::runtime_error const&)
+    {
+        // do nothing, this is expected
+    }
+
+    tests_passed &= chain.check(sequence, (int)(n_tasks % 256));
+
+    if (!in_filepath.empty())
+    {
+        module::Source_user_binary<uint8_t> source(data_length, in_filepath, false);
+        module::Incrementer<uint8_t> inc(data_length, 0);
+        inc["increment::in"] = source["generate::out_data"];
+
+        // the source is not replicable, the sequence is executed by a single thread
+        runtime::Sequence sequence_source(source("generate"), 1);
+        sequence_source.set_no_copy_mode(no_copy_mode);
+        sequence_source.exec_until_done();
+
+        bool done = false;
+        for (auto cur_source : sequence_source.get_cloned_modules<module::Source_user_binary<uint8_t>>(source))
+            done |= cur_source->is_done();
+        tests_passed &= done;
+
+        std::cout << "# Execution until done:                   " << (*inc.tasks[0]).get_n_calls()
+                  << " execs" << std::endl;
+    }
+
+    if (tests_passed)
+        std::cout << "# " << rang::style::bold << rang::fg::green << "Tests passed!" << rang::style::reset << std::endl;
+    else
+        std::cout << "# " << rang::style::bold << rang::fg::red << "Tests failed :-(" << rang::style::reset
+                  << std::endl;
+
+    return !tests_passed;
+}
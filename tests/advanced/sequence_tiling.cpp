@@ -0,0 +1,228 @@
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <getopt.h>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <streampu.hpp>
+
+#include "Incrementer_chain.hpp"
+
+using namespace spu;
+using namespace spu::runtime;
+
+// execute the sequence 'n_exec' times and return the elapsed time in nanoseconds
+static double
+run(runtime::Sequence& sequence, const size_t n_exec)
+{
+    std::atomic<size_t> counter(0);
+    auto t_start = std::chrono::steady_clock::now();
+    sequence.exec([&counter, n_exec]() { return ++counter >= n_exec; });
+    std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - t_start;
+    return (double)duration.count();
+}
+
+// stateless module that forwards its data and returns 'FAILURE_STOP' from the frame '*stop_frame' (never when negative)
+static module::Stateless*
+create_stopper(const size_t data_length, const int* stop_frame)
+{
+    auto stopper = new module::Stateless();
+    stopper->set_name("Stopper");
+    stopper->set_short_name("Stopper");
+    auto& tsk = stopper->create_task("stop");
+    stopper->create_socket_fwd<uint8_t>(tsk, "fwd", data_length);
+    stopper->create_codelet(tsk,
+                            [stop_frame](module::Module& m, runtime::Task& t, const size_t frame_id) -> int
+                            {
+                                return *stop_frame >= 0 && frame_id >= (size_t)*stop_frame
+                                         ? runtime::status_t::FAILURE_STOP
+                                         : runtime::status_t::SUCCESS;
+                            });
+    return stopper;
+}
+
+// execute the sequence until a task returns 'FAILURE_STOP' (once per thread), return the number of executions and the
+// statuses of the stoppers
+static size_t
+run_until_stop(runtime::Sequence& sequence, module::Stateless& stopper, std::vector<std::vector<int>>& statuses)
+{
+    std::atomic<size_t> counter(0);
+    const size_t n_waves = stopper.get_n_waves();
+    sequence.exec(
+      [&counter, n_waves](const std::vector<const int*>& statuses)
+      {
+          counter++;
+          for (auto status : statuses)
+              if (status != nullptr)
+                  for (size_t w = 0; w < n_waves; w++)
+                      if (status[w] == runtime::status_t::FAILURE_STOP) return true;
+          return counter >= 10;
+      });
+    statuses.clear();
+    for (auto cur_stopper : sequence.get_cloned_modules<module::Stateless>(stopper))
+        statuses.push_back((*cur_stopper)("stop").get_status());
+    return counter;
+}
+
+int
+main(int argc, char** argv)
+{
+    tools::Signal_handler::init();
+
+    option longopts[] = { { "n-threads", required_argument, NULL, 't' },
+                          { "n-tasks", required_argument, NULL, 'n' },
+                          { "n-exec", required_argument, NULL, 'e' },
+                          { "n-frames", required_argument, NULL, 'f' },
+                          { "data-length", required_argument, NULL, 'd' },
+                          { "dot-filepath", required_argument, NULL, 'o' },
+                          { "copy-mode", no_argument, NULL, 'c' },
+                          { "help", no_argument, NULL, 'h' },
+                          { 0 } };
+
+    size_t n_threads = 1;
+    size_t n_tasks = 8;
+    size_t n_exec = 100;
+    size_t n_frames = 64;
+    size_t data_length = 65536;
+    std::string dot_filepath;
+    bool no_copy_mode = true;
+
+    while (1)
+    {
+        const int opt = getopt_long(argc, argv, "t:n:e:f:d:o:ch", longopts, 0);
+        if (opt == -1) break;
+        switch (opt)
+        {
+            case 't':
+                n_threads = atoi(optarg);
+                break;
+            case 'n':
+                n_tasks = atoi(optarg);
+                break;
+            case 'e':
+                n_exec = atoi(optarg);
+                break;
+            case 'f':
+                n_frames = atoi(optarg);
+                break;
+            case 'd':
+                data_length = atoi(optarg);
+                break;
+            case 'o':
+                dot_filepath = std::string(optarg);
+                break;
+            case 'c':
+                no_copy_mode = false;
+                break;
+            case 'h':
+                std::cout << "usage: " << argv[0] << " [options]" << std::endl;
+                std::cout << std::endl;
+                std::cout << "  -t, --n-threads       "
+                          << "Number of threads to run in parallel                                  "
+                          << "[" << n_threads << "]" << std::endl;
+                std::cout << "  -n, --n-tasks         "
+                          << "Number of incrementation tasks in the chain                           "
+                          << "[" << n_tasks << "]" << std::endl;
+                std::cout << "  -e, --n-exec          "
+                          << "Number of sequence executions                                         "
+                          << "[" << n_exec << "]" << std::endl;
+                std::cout << "  -f, --n-frames        "
+                          << "Number of frames processed in one execution of the sequence           "
+                          << "[" << n_frames << "]" << std::endl;
+                std::cout << "  -d, --data-length     "
+                          << "Size of data to process in one task (in bytes)                        "
+                          << "[" << data_length << "]" << std::endl;
+                std::cout << "  -o, --dot-filepath    "
+                          << "Path to dot output file                                               "
+                          << "[" << (dot_filepath.empty() ? "empty" : "\"" + dot_filepath + "\"") << "]" << std::endl;
+                std::cout << "  -c, --copy-mode       "
+                          << "Enable to copy data in sequence (performance will be reduced)         "
+                          << "[" << (no_copy_mode ? "false" : "true") << "]" << std::endl;
+                std::cout << "  -h, --help            "
+                          << "This help                                                             "
+                          << "[false]" << std::endl;
+                exit(0);
+                break;
+            default:
+                break;
+        }
+    }
+
+    std::cout << "#########################################" << std::endl;
+    std::cout << "# Micro-benchmark: Frames tiling        #" << std::endl;
+    std::cout << "#########################################" << std::endl;
+    std::cout << "#" << std::endl;
+
+    std::cout << "# Command line arguments:" << std::endl;
+    std::cout << "#   - n_threads      = " << n_threads << std::endl;
+    std::cout << "#   - n_tasks        = " << n_tasks << std::endl;
+    std::cout << "#   - n_exec         = " << n_exec << std::endl;
+    std::cout << "#   - n_frames       = " << n_frames << std::endl;
+    std::cout << "#   - data_length    = " << data_length << std::endl;
+    std::cout << "#   - dot_filepath   = " << (dot_filepath.empty() ? "[empty]" : dot_filepath.c_str()) << std::endl;
+    std::cout << "#   - no_copy_mode   = " << (no_copy_mode ? "true" : "false") << std::endl;
+    std::cout << "#" << std::endl;
+    std::cout << "# L2 cache size: " << tools::get_cache_size(2) << " bytes" << std::endl;
+    std::cout << "#" << std::endl;
+
+    // modules creation, the stopper is inserted before the finalizer
+    Incrementer_chain chain(data_length, n_tasks, 0, false);
+    auto& initializer = chain.initializer;
+    auto& finalizer = chain.finalizer;
+
+    int stop_frame = -1;
+    std::unique_ptr<module::Stateless> stopper(create_stopper(data_length, &stop_frame));
+
+    // sockets binding
+    (*stopper)["stop::fwd"] = chain.get_out();
+    finalizer["finalize::in"] = (*stopper)["stop::fwd"];
+
+    runtime::Sequence sequence(initializer("initialize"), n_threads);
+    sequence.set_n_frames(n_frames);
+    sequence.set_no_copy_mode(no_copy_mode);
+
+    Incrementer_chain::reset_tasks(sequence);
+
+    if (!dot_filepath.empty())
+    {
+        std::ofstream file(dot_filepath);
+        sequence.export_dot(file);
+    }
+
+    const double duration = run(sequence, n_exec);
+    bool tests_passed = chain.check(sequence, (int)(n_tasks % 256));
+
+    // the initial data are modified so the results of the tiled execution can't be the results of the previous one
+    for (auto cur_initializer : sequence.get_cloned_modules<module::Initializer<uint8_t>>(initializer))
+        cur_initializer->set_init_data(1);
+
+    sequence.set_frames_tiling(true);
+    const double duration_tiled = run(sequence, n_exec);
+    tests_passed &= chain.check(sequence, (int)((n_tasks + 1) % 256));
+
+    // a stop in the middle of the frames has to be seen by the stop condition and the next waves of the stopper are
+    // not executed, like without the tiling
+    stop_frame = (int)(n_frames / 2);
+    std::vector<std::vector<int>> statuses_tiled, statuses;
+    const size_t n_exec_tiled = run_until_stop(sequence, *stopper, statuses_tiled);
+    sequence.set_frames_tiling(false);
+    const size_t n_exec_stop = run_until_stop(sequence, *stopper, statuses);
+    tests_passed &= n_exec_tiled == n_threads && n_exec_stop == n_threads && statuses_tiled == statuses;
+
+    const double n_bytes = (double)(n_exec * n_frames * data_length);
+    std::cout << "# Time per byte (not tiled): " << duration * n_threads / n_bytes << " ns" << std::endl;
+    std::cout << "# Time per byte (tiled):     " << duration_tiled * n_threads / n_bytes << " ns" << std::endl;
+    std::cout << "# Speedup:                   " << duration / duration_tiled << std::endl;
+
+    if (tests_passed)
+        std::cout << "# " << rang::style::bold << rang::fg::green << "Tests passed!" << rang::style::reset << std::endl;
+    else
+        std::cout << "# " << rang::style::bold << rang::fg::red << "Tests failed :-(" << rang::style::reset
+                  << std::endl;
+
+    return !tests_passed;
+}
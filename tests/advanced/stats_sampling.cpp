@@ -0,0 +1,158 @@
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <getopt.h>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <streampu.hpp>
+using namespace spu;
+using namespace spu::runtime;
+
+// stateless module with a task that spins for 'n_iters' iterations
+static module::Stateless*
+create_spinner(const size_t n_iters)
+{
+    auto spinner = new module::Stateless();
+    spinner->set_name("Spinner");
+    spinner->set_short_name("Spinner");
+    auto& tsk = spinner->create_task("spin");
+    spinner->create_codelet(tsk,
+                            [n_iters](module::Module& m, runtime::Task& t, const size_t frame_id) -> int
+                            {
+                                volatile size_t sink = 0;
+                                for (size_t i = 0; i < n_iters; i++)
+                                    sink = sink + i;
+                                return 0;
+                            });
+    return spinner;
+}
+
+int
+main(int argc, char** argv)
+{
+    tools::Signal_handler::init();
+
+    option longopts[] = { { "n-exec", required_argument, NULL, 'e' },
+                          { "period", required_argument, NULL, 'p' },
+                          { "n-iters", required_argument, NULL, 'i' },
+                          { "help", no_argument, NULL, 'h' },
+                          { 0 } };
+
+    size_t n_exec = 1000000;
+    size_t period = 64;
+    size_t n_iters = 16;
+
+    while (1)
+    {
+        const int opt = getopt_long(argc, argv, "e:p:i:h", longopts, 0);
+        if (opt == -1) break;
+        switch (opt)
+        {
+            case 'e':
+                n_exec = atoi(optarg);
+                break;
+            case 'p':
+                period = atoi(optarg);
+                break;
+            case 'i':
+                n_iters = atoi(optarg);
+                break;
+            case 'h':
+                std::cout << "usage: " << argv[0] << " [options]" << std::endl;
+                std::cout << std::endl;
+                std::cout << "  -e, --n-exec          "
+                          << "Number of task executions                                             "
+                          << "[" << n_exec << "]" << std::endl;
+                std::cout << "  -p, --period          "
+                          << "One call in 'period' is timed when the stats are sampled              "
+                          << "[" << period << "]" << std::endl;
+                std::cout << "  -i, --n-iters         "
+                          << "Number of iterations of the loop in the task                          "
+                          << "[" << n_iters << "]" << std::endl;
+                std::cout << "  -h, --help            "
+                          << "This help                                                             "
+                          << "[false]" << std::endl;
+                exit(0);
+                break;
+            default:
+                break;
+        }
+    }
+
+    std::cout << "#########################################" << std::endl;
+    std::cout << "# Micro-benchmark: Stats sampling       #" << std::endl;
+    std::cout << "#########################################" << std::endl;
+    std::cout << "#" << std::endl;
+
+    std::cout << "# Command line arguments:" << std::endl;
+    std::cout << "#   - n_exec         = " << n_exec << std::endl;
+    std::cout << "#   - period         = " << period << std::endl;
+    std::cout << "#   - n_iters        = " << n_iters << std::endl;
+    std::cout << "#" << std::endl;
+
+    bool tests_passed = true;
+
+    std::unique_ptr<module::Stateless> spinner(create_spinner(n_iters));
+    auto& tsk = (*spinner)("spin");
+    tsk.set_fast(true);
+
+    std::cout << "# ---------------|-------------|-------------|-------------|-------------" << std::endl;
+    std::cout << "#  mode          | timed calls | exec (ns)   | est. avg    | est. total  " << std::endl;
+    std::cout << "#                |             |             | (ns)        | (ms)        " << std::endl;
+    std::cout << "# ---------------|-------------|-------------|-------------|-------------" << std::endl;
+
+    // 0: stats disabled, 1: all the calls are timed, 2: periodic sampling, 3: random sampling
+    const std::string modes[4] = { "no stats", "all calls", "periodic", "random" };
+    for (size_t mode = 0; mode < 4; mode++)
+    {
+        tsk.reset();
+        tsk.set_stats(mode != 0);
+        tsk.set_stats_sampling(mode >= 2 ? period : 1, mode == 3);
+
+        auto t_start = std::chrono::steady_clock::now();
+        for (size_t e = 0; e < n_exec; e++)
+            tsk.exec();
+        std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - t_start;
+
+        const double total = (double)tsk.get_duration_total().count();
+        tests_passed &= tsk.get_n_calls() == n_exec;
+        if (mode == 0) tests_passed &= tsk.get_n_calls_timed() == 0 && total == 0.;
+        if (mode == 1) tests_passed &= tsk.get_n_calls_timed() == n_exec;
+        if (mode == 2) tests_passed &= tsk.get_n_calls_timed() == (n_exec + period - 1) / period;
+        if (mode == 3)
+        {
+            const double expected = (double)n_exec / period;
+            tests_passed &= std::abs((double)tsk.get_n_calls_timed() - expected) <= 0.1 * expected + 10;
+        }
+        tests_passed &= tsk.get_duration_histogram().get_n_values() == tsk.get_n_calls_timed();
+        // the total duration is extrapolated from the timed calls to all the calls
+        const double expected_total = (double)tsk.get_duration_avg().count() * n_exec;
+        if (mode != 0) tests_passed &= std::abs(total - expected_total) <= (double)n_exec;
+
+        std::cout << "#  " << std::setw(13) << modes[mode] << " | " << std::setw(11) << tsk.get_n_calls_timed()
+                  << " | " << std::setw(11) << (double)duration.count() / n_exec << " | " << std::setw(11)
+                  << tsk.get_duration_avg().count() << " | " << std::setw(11) << total / 1e6 << std::endl;
+    }
+
+    // the period can't be zero
+    try
+    {
+        tsk.set_stats_sampling(0);
+        tests_passed = false;
+    }
+    catch (tools::invalid_argument const&)
+    {
+        // do nothing, this is expected
+    }
+
+    if (tests_passed)
+        std::cout << "# " << rang::style::bold << rang::fg::green << "Tests passed!" << rang::style::reset << std::endl;
+    else
+        std::cout << "# " << rang::style::bold << rang::fg::red << "Tests failed :-(" << rang::style::reset
+                  << std::endl;
+
+    return !tests_passed;
+}
@@ -0,0 +1,201 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <getopt.h>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <streampu.hpp>
+using namespace spu;
+using namespace spu::runtime;
+
+// stateless module with a task that does nothing (the measured time is the overhead of the task execution)
+static module::Stateless*
+create_nop()
+{
+    auto nop = new module::Stateless();
+    nop->set_name("Nop");
+    nop->set_short_name("Nop");
+    auto& tsk = nop->create_task("nop");
+    nop->create_codelet(tsk, [](module::Module& m, runtime::Task& t, const size_t frame_id) -> int { return 0; });
+    return nop;
+}
+
+// average duration of one task execution (in ns)
+static double
+measure_exec(runtime::Task& tsk, const size_t n_exec)
+{
+    auto t_start = std::chrono::steady_clock::now();
+    for (size_t e = 0; e < n_exec; e++)
+        tsk.exec();
+    std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - t_start;
+    return (double)duration.count() / n_exec;
+}
+
+int
+main(int argc, char** argv)
+{
+    tools::Signal_handler::init();
+
+    option longopts[] = { { "n-threads", required_argument, NULL, 't' },
+                          { "n-values", required_argument, NULL, 'v' },
+                          { "n-exec", required_argument, NULL, 'e' },
+                          { "verbose", no_argument, NULL, 'V' },
+                          { "help", no_argument, NULL, 'h' },
+                          { 0 } };
+
+    size_t n_threads = 4;
+    size_t n_values = 1000000;
+    size_t n_exec = 1000000;
+    bool verbose = false;
+
+    while (1)
+    {
+        const int opt = getopt_long(argc, argv, "t:v:e:Vh", longopts, 0);
+        if (opt == -1) break;
+        switch (opt)
+        {
+            case 't':
+                n_threads = atoi(optarg);
+                break;
+            case 'v':
+                n_values = atoi(optarg);
+                break;
+            case 'e':
+                n_exec = atoi(optarg);
+                break;
+            case 'V':
+                verbose = true;
+                break;
+            case 'h':
+                std::cout << "usage: " << argv[0] << " [options]" << std::endl;
+                std::cout << std::endl;
+                std::cout << "  -t, --n-threads       "
+                          << "Number of threads to run in parallel                                  "
+                          << "[" << n_threads << "]" << std::endl;
+                std::cout << "  -v, --n-values        "
+                          << "Number of random values recorded in the histogram                     "
+                          << "[" << n_values << "]" << std::endl;
+                std::cout << "  -e, --n-exec          "
+                          << "Number of task executions                                             "
+                          << "[" << n_exec << "]" << std::endl;
+                std::cout << "  -V, --verbose         "
+                          << "Print the statistics of the sequence                                  "
+                          << "[" << (verbose ? "true" : "false") << "]" << std::endl;
+                std::cout << "  -h, --help            "
+                          << "This help                                                             "
+                          << "[false]" << std::endl;
+                exit(0);
+                break;
+            default:
+                break;
+        }
+    }
+
+    std::cout << "#########################################" << std::endl;
+    std::cout << "# Micro-benchmark: Latency histograms   #" << std::endl;
+    std::cout << "#########################################" << std::endl;
+    std::cout << "#" << std::endl;
+
+    std::cout << "# Command line arguments:" << std::endl;
+    std::cout << "#   - n_threads      = " << n_threads << std::endl;
+    std::cout << "#   - n_values       = " << n_values << std::endl;
+    std::cout << "#   - n_exec         = " << n_exec << std::endl;
+    std::cout << "#   - verbose        = " << (verbose ? "true" : "false") << std::endl;
+    std::cout << "#" << std::endl;
+
+    bool tests_passed = true;
+
+    // 1) accuracy of the percentiles on a long-tailed distribution (log-normal, in ns)
+    std::mt19937 gen(42);
+    std::lognormal_distribution<double> dist(8.0, 1.5);
+    std::vector<uint64_t> values(n_values);
+    for (auto& v : values)
+        v = (uint64_t)dist(gen);
+
+    tools::Histogram hist;
+    hist.allocate();
+    auto t_start = std::chrono::steady_clock::now();
+    for (auto v : values)
+        hist.record(v);
+    std::chrono::nanoseconds duration_record = std::chrono::steady_clock::now() - t_start;
+    tests_passed &= hist.get_n_values() == n_values;
+
+    std::sort(values.begin(), values.end());
+    const float percentiles[4] = { 50.f, 90.f, 99.f, 99.9f };
+    for (auto p : percentiles)
+    {
+        const size_t rank = std::max((size_t)1, (size_t)std::ceil((double)p / 100. * n_values));
+        const double exact = (double)values[rank - 1];
+        const double approx = (double)hist.get_percentile(p);
+        const double error = exact ? std::abs(approx - exact) / exact : approx;
+        std::cout << "# P" << p << ": exact = " << exact << " ns, histogram = " << approx
+                  << " ns (relative error = " << error * 100. << "%)" << std::endl;
+        tests_passed &= error <= 1. / tools::Histogram::n_sub_buckets;
+    }
+    std::cout << "# Time to record a value:   " << (double)duration_record.count() / n_values << " ns" << std::endl;
+
+    // 2) overhead of the statistics on a task that does nothing
+    std::unique_ptr<module::Stateless> nop(create_nop());
+    auto& tsk = (*nop)("nop");
+    tsk.set_stats(false);
+    tsk.set_fast(true);
+    const double duration_fast = measure_exec(tsk, n_exec);
+    tsk.set_fast(false);
+    tsk.set_stats(true);
+    const double duration_stats = measure_exec(tsk, n_exec);
+    tests_passed &= tsk.get_n_calls() == 2 * n_exec;
+    tests_passed &= tsk.get_duration_histogram().get_n_values() == n_exec;
+    tests_passed &= tsk.get_duration_percentile(50.f) <= tsk.get_duration_max();
+    tsk.reset();
+    tests_passed &= tsk.get_duration_histogram().get_n_values() == 0;
+
+    std::cout << "# Task execution (fast):    " << duration_fast << " ns" << std::endl;
+    std::cout << "# Task execution (stats):   " << duration_stats << " ns" << std::endl;
+
+    // 3) the replicated tasks record in their own histograms, they are merged by the statistics display
+    module::Initializer<uint8_t> initializer(16);
+    module::Incrementer<uint8_t> incrementer(16);
+    module::Finalizer<uint8_t> finalizer(16);
+    incrementer["increment::in"] = initializer["initialize::out"];
+    finalizer["finalize::in"] = incrementer["increment::out"];
+
+    runtime::Sequence sequence(initializer("initialize"), n_threads);
+    for (auto& mod : sequence.get_modules<module::Module>(false))
+        for (auto& t : mod->tasks)
+        {
+            t->reset();
+            t->set_stats(true);
+        }
+    sequence.exec_n(n_exec / 100 + 1);
+
+    tools::Histogram merged_hist;
+    size_t n_calls = 0;
+    for (auto cur_inc : sequence.get_cloned_modules<module::Incrementer<uint8_t>>(incrementer))
+    {
+        auto& cur_tsk = (*cur_inc)("increment");
+        tests_passed &= cur_tsk.get_duration_histogram().get_n_values() == cur_tsk.get_n_calls();
+        merged_hist.merge(cur_tsk.get_duration_histogram());
+        n_calls += cur_tsk.get_n_calls();
+    }
+    tests_passed &= merged_hist.get_n_values() == n_calls;
+    tests_passed &= n_calls == n_exec / 100 + 1;
+
+    std::stringstream stats;
+    tools::Stats::show(sequence.get_modules_per_types(), true, false, stats);
+    tests_passed &= stats.str().find("P99.9") != std::string::npos;
+    if (verbose) std::cout << stats.str();
+
+    if (tests_passed)
+        std::cout << "# " << rang::style::bold << rang::fg::green << "Tests passed!" << rang::style::reset << std::endl;
+    else
+        std::cout << "# " << rang::style::bold << rang::fg::red << "Tests failed :-(" << rang::style::reset
+                  << std::endl;
+
+    return !tests_passed;
+}
@@ -0,0 +1,125 @@
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <getopt.h>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <streampu.hpp>
+using namespace spu;
+
+int
+main(int argc, char** argv)
+{
+    tools::Signal_handler::init();
+
+    option longopts[] = { { "n-threads", required_argument, NULL, 't' },
+                          { "n-rounds", required_argument, NULL, 'e' },
+                          { "spin-budget", required_argument, NULL, 's' },
+                          { "help", no_argument, NULL, 'h' },
+                          { 0 } };
+
+    size_t n_threads = 4;
+    size_t n_rounds = 10000;
+    size_t spin_budget = tools::Thread_barrier_standard::default_spin_budget();
+
+    while (1)
+    {
+        const int opt = getopt_long(argc, argv, "t:e:s:h", longopts, 0);
+        if (opt == -1) break;
+        switch (opt)
+        {
+            case 't':
+                n_threads = atoi(optarg);
+                break;
+            case 'e':
+                n_rounds = atoi(optarg);
+                break;
+            case 's':
+                spin_budget = atoi(optarg);
+                break;
+            case 'h':
+                std::cout << "usage: " << argv[0] << " [options]" << std::endl;
+                std::cout << std::endl;
+                std::cout << "  -t, --n-threads       "
+                          << "Number of threads that arrive at the barrier                          "
+                          << "[" << n_threads << "]" << std::endl;
+                std::cout << "  -e, --n-rounds        "
+                          << "Number of times the threads arrive and the barrier is waited          "
+                          << "[" << n_rounds << "]" << std::endl;
+                std::cout << "  -s, --spin-budget     "
+                          << "Number of spins of the waiting thread before to park (0 = no spin)    "
+                          << "[" << spin_budget << "]" << std::endl;
+                std::cout << "  -h, --help            "
+                          << "This help                                                             "
+                          << "[false]" << std::endl;
+                exit(0);
+                break;
+            default:
+                break;
+        }
+    }
+
+    std::cout << "#########################################" << std::endl;
+    std::cout << "# Stress test: Thread barrier           #" << std::endl;
+    std::cout << "#########################################" << std::endl;
+    std::cout << "#" << std::endl;
+
+    std::cout << "# Command line arguments:" << std::endl;
+    std::cout << "#   - n_threads      = " << n_threads << std::endl;
+    std::cout << "#   - n_rounds       = " << n_rounds << std::endl;
+    std::cout << "#   - spin_budget    = " << spin_budget << std::endl;
+    std::cout << "#" << std::endl;
+
+    tools::Thread_barrier_standard barrier((uint32_t)n_threads, spin_budget);
+    std::atomic<size_t> go(0);
+    std::atomic<size_t> n_arrivals(0);
+
+    // each thread waits for the main thread to start the round 'r', then it arrives at the barrier: it cannot arrive
+    // again before the main thread has been released from the barrier and has started the next round
+    std::vector<std::thread> threads;
+    for (size_t tid = 0; tid < n_threads; tid++)
+        threads.push_back(std::thread(
+          [&barrier, &go, &n_arrivals, n_rounds]()
+          {
+              for (size_t r = 0; r < n_rounds; r++)
+              {
+                  while (go.load(std::memory_order_acquire) <= r)
+                      std::this_thread::yield();
+                  n_arrivals.fetch_add(1, std::memory_order_relaxed);
+                  barrier.arrive();
+              }
+          }));
+
+    // the barrier has to release the main thread only when all the threads have arrived in the current round
+    bool tests_passed = true;
+    size_t n_early_releases = 0;
+    auto t_start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < n_rounds; r++)
+    {
+        go.store(r + 1, std::memory_order_release);
+        barrier.wait();
+        if (n_arrivals.load(std::memory_order_relaxed) != n_threads * (r + 1)) n_early_releases++;
+    }
+    std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - t_start;
+
+    for (auto& t : threads)
+        t.join();
+
+    tests_passed &= n_early_releases == 0;
+    tests_passed &= n_arrivals == n_threads * n_rounds;
+
+    std::cout << "# Early releases:   " << n_early_releases << std::endl;
+    std::cout << "# Time per round:   " << (double)duration.count() / (double)(n_rounds ? n_rounds : 1) << " ns"
+              << std::endl;
+
+    if (tests_passed)
+        std::cout << "# " << rang::style::bold << rang::fg::green << "Tests passed!" << rang::style::reset << std::endl;
+    else
+        std::cout << "# " << rang::style::bold << rang::fg::red << "Tests failed :-(" << rang::style::reset
+                  << std::endl;
+
+    return !tests_passed;
+}
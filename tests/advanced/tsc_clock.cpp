@@ -0,0 +1,176 @@
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <getopt.h>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <streampu.hpp>
+using namespace spu;
+using namespace spu::runtime;
+
+// average duration of one read of the clock (in ns)
+template<class CLOCK>
+static double
+measure_now(const size_t n_reads)
+{
+    auto t_start = std::chrono::steady_clock::now();
+    int64_t sum = 0; // prevents the compiler from removing the reads
+    for (size_t r = 0; r < n_reads; r++)
+        sum += (int64_t)CLOCK::now().time_since_epoch().count();
+    std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - t_start;
+    if (sum == 42) std::cout << "#" << std::endl;
+    return (double)duration.count() / n_reads;
+}
+
+// stateless module with a task that does nothing (the measured time is the overhead of the task execution)
+static module::Stateless*
+create_nop()
+{
+    auto nop = new module::Stateless();
+    nop->set_name("Nop");
+    nop->set_short_name("Nop");
+    auto& tsk = nop->create_task("nop");
+    nop->create_codelet(tsk, [](module::Module& m, runtime::Task& t, const size_t frame_id) -> int { return 0; });
+    return nop;
+}
+
+// average duration of one task execution with the statistics enabled (in ns)
+static double
+measure_exec(runtime::Task& tsk, const size_t n_exec)
+{
+    tsk.reset();
+    auto t_start = std::chrono::steady_clock::now();
+    for (size_t e = 0; e < n_exec; e++)
+        tsk.exec();
+    std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - t_start;
+    return (double)duration.count() / n_exec;
+}
+
+int
+main(int argc, char** argv)
+{
+    tools::Signal_handler::init();
+
+    option longopts[] = { { "n-reads", required_argument, NULL, 'r' },
+                          { "sleep-ms", required_argument, NULL, 's' },
+                          { "help", no_argument, NULL, 'h' },
+                          { 0 } };
+
+    size_t n_reads = 1000000;
+    size_t sleep_ms = 20;
+
+    while (1)
+    {
+        const int opt = getopt_long(argc, argv, "r:s:h", longopts, 0);
+        if (opt == -1) break;
+        switch (opt)
+        {
+            case 'r':
+                n_reads = atoi(optarg);
+                break;
+            case 's':
+                sleep_ms = atoi(optarg);
+                break;
+            case 'h':
+                std::cout << "usage: " << argv[0] << " [options]" << std::endl;
+                std::cout << std::endl;
+                std::cout << "  -r, --n-reads         "
+                          << "Number of reads of the clocks (and of task executions)                "
+                          << "[" << n_reads << "]" << std::endl;
+                std::cout << "  -s, --sleep-ms        "
+                          << "Duration measured by the two backends (in ms)                         "
+                          << "[" << sleep_ms << "]" << std::endl;
+                std::cout << "  -h, --help            "
+                          << "This help                                                             "
+                          << "[false]" << std::endl;
+                exit(0);
+                break;
+            default:
+                break;
+        }
+    }
+
+    std::cout << "#########################################" << std::endl;
+    std::cout << "# Micro-benchmark: TSC clock            #" << std::endl;
+    std::cout << "#########################################" << std::endl;
+    std::cout << "#" << std::endl;
+
+    std::cout << "# Command line arguments:" << std::endl;
+    std::cout << "#   - n_reads        = " << n_reads << std::endl;
+    std::cout << "#   - sleep_ms       = " << sleep_ms << std::endl;
+    std::cout << "#" << std::endl;
+
+    bool tests_passed = true;
+
+    const auto prev_backend = tools::Clock::get_backend();
+    if (!tools::Clock::is_tsc_available())
+    {
+        std::cout << "# The time-stamp counter is not available, only the steady clock is tested." << std::endl;
+        try
+        {
+            tools::Clock::set_backend(tools::clock_backend_t::TSC);
+            tests_passed = false;
+        }
+        catch (tools::runtime_error const&)
+        {
+            // do nothing, this is expected
+        }
+    }
+
+    std::unique_ptr<module::Stateless> nop(create_nop());
+    auto& tsk = (*nop)("nop");
+    tsk.set_fast(true);
+    tsk.set_stats(true);
+
+    double durations_now[2], durations_exec[2];
+    for (auto backend : { tools::clock_backend_t::STEADY, tools::clock_backend_t::TSC })
+    {
+        if (backend == tools::clock_backend_t::TSC && !tools::Clock::is_tsc_available()) continue;
+        tools::Clock::set_backend(backend);
+        const size_t b = backend == tools::clock_backend_t::TSC ? 1 : 0;
+
+        // the clock is monotonic and it measures the same durations as the steady clock
+        auto t_prev = tools::Clock::now();
+        for (size_t r = 0; r < 1000; r++)
+        {
+            auto t_cur = tools::Clock::now();
+            if (t_cur < t_prev) tests_passed = false;
+            t_prev = t_cur;
+        }
+
+        auto s_start = std::chrono::steady_clock::now();
+        auto c_start = tools::Clock::now();
+        std::this_thread::sleep_for(std::chrono::milliseconds(sleep_ms));
+        auto c_stop = tools::Clock::now();
+        auto s_stop = std::chrono::steady_clock::now();
+        std::chrono::nanoseconds s_duration = s_stop - s_start;
+        std::chrono::nanoseconds c_duration = c_stop - c_start;
+        tests_passed &= std::abs((double)(c_duration - s_duration).count()) / (double)s_duration.count() < 0.01;
+
+        durations_now[b] = measure_now<tools::Clock>(n_reads);
+        durations_exec[b] = measure_exec(tsk, n_reads);
+        tests_passed &= tsk.get_n_calls() == n_reads;
+        tests_passed &= tsk.get_duration_total().count() > 0;
+    }
+    tools::Clock::set_backend(prev_backend);
+
+    std::cout << "# Read of the steady clock:      " << durations_now[0] << " ns" << std::endl;
+    std::cout << "# Task execution (steady clock): " << durations_exec[0] << " ns" << std::endl;
+    if (tools::Clock::is_tsc_available())
+    {
+        std::cout << "# TSC frequency:                 " << tools::Clock::get_tsc_frequency() << " GHz" << std::endl;
+        std::cout << "# Read of the TSC:               " << durations_now[1] << " ns" << std::endl;
+        std::cout << "# Task execution (TSC):          " << durations_exec[1] << " ns" << std::endl;
+    }
+
+    if (tests_passed)
+        std::cout << "# " << rang::style::bold << rang::fg::green << "Tests passed!" << rang::style::reset << std::endl;
+    else
+        std::cout << "# " << rang::style::bold << rang::fg::red << "Tests failed :-(" << rang::style::reset
+                  << std::endl;
+
+    return !tests_passed;
+}
@@ -27,6 +27,7 @@ main(int argc, char** argv)
                           { "step-by-step", no_argument, NULL, 'b' },
                           { "debug", no_argument, NULL, 'g' },
                           { "cyclic-path", no_argument, NULL, 'y' },
+                          { "frame-meta", no_argument, NULL, 'M' },
                           { "help", no_argument, NULL, 'h' },
                           { 0 } };
 
@@ -42,10 +43,11 @@ main(int argc, char** argv)
     bool step_by_step = false;
     bool debug = false;
     bool cyclic_path = false;
+    bool frame_meta = false;
 
     while (1)
     {
-        const int opt = getopt_long(argc, argv, "t:f:s:d:e:a:o:cpbgyh", longopts, 0);
+        const int opt = getopt_long(argc, argv, "t:f:s:d:e:a:o:cpbgyMh", longopts, 0);
         if (opt == -1) break;
         switch (opt)
         {
@@ -85,6 +87,9 @@ main(int argc, char** argv)
             case 'y':
                 cyclic_path = true;
                 break;
+            case 'M':
+                frame_meta = true;
+                break;
             case 'h':
                 std::cout << "usage: " << argv[0] << " [options]" << std::endl;
                 std::cout << std::endl;
@@ -124,6 +129,9 @@ main(int argc, char** argv)
                 std::cout << "  -y, --cyclic-path     "
                           << "Enable cyclic selection of the path (with this `--path` is ignored)   "
                           << "[" << (cyclic_path ? "true" : "false") << "]" << std::endl;
+                std::cout << "  -M, --frame-meta      "
+                          << "Enable the frame metadata and check them at the end of the paths      "
+                          << "[" << (frame_meta ? "true" : "false") << "]" << std::endl;
                 std::cout << "  -h, --help            "
                           << "This help                                                             "
                           << "[false]" << std::endl;
@@ -152,6 +160,7 @@ main(int argc, char** argv)
     std::cout << "#   - step_by_step   = " << (step_by_step ? "true" : "false") << std::endl;
     std::cout << "#   - debug          = " << (debug ? "true" : "false") << std::endl;
     std::cout << "#   - cyclic_path    = " << (cyclic_path ? "true" : "false") << std::endl;
+    std::cout << "#   - frame_meta     = " << (frame_meta ? "true" : "false") << std::endl;
     std::cout << "#" << std::endl;
 
     if (path >= 3)
@@ -235,6 +244,7 @@ main(int argc, char** argv)
             tsk->set_debug_limit(16);    // display only the 16 first bits if the debug mode is enabled
             tsk->set_stats(print_stats); // enable the statistics
             tsk->set_fast(true);         // enable the fast mode (= disable the useless verifs in the tasks)
+            tsk->set_frame_meta(frame_meta); // attach a sequence number and a timestamp to the frames
         }
 
     std::atomic<unsigned int> counter(0);
@@ -292,6 +302,26 @@ main(int argc, char** argv)
         tid++;
     }
 
+    // the frames reaching the finalizer have to be the last frames ingested by the initializer of the same thread,
+    // whatever the path taken
+    if (frame_meta)
+    {
+        auto initializers = sequence_exclusive_paths.get_cloned_modules<module::Initializer<uint8_t>>(initializer);
+        auto finalizers = sequence_exclusive_paths.get_cloned_modules<module::Finalizer<uint8_t>>(finalizer);
+        for (size_t t = 0; t < finalizers.size(); t++)
+        {
+            const auto meta_in = (*initializers[t])[module::ini::tsk::initialize].get_frame_meta();
+            const auto meta_out = (*finalizers[t])[module::fin::sck::finalize::in].get_frame_meta();
+            for (size_t f = 0; f < n_inter_frames; f++)
+                if (meta_out[f].seq != meta_in[f].seq || meta_out[f].ts != meta_in[f].ts)
+                {
+                    std::cout << "# expected seq = " << meta_in[f].seq << " - obtained seq = " << meta_out[f].seq
+                              << " (f = " << f << ", tid = " << t << ")" << std::endl;
+                    tests_passed = false;
+                }
+        }
+    }
+
     if (tests_passed)
         std::cout << "# " << rang::style::bold << rang::fg::green << "Tests passed!" << rang::style::reset << std::endl;
     else
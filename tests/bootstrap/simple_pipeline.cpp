@@ -56,6 +56,13 @@ main(int argc, char** argv)
                           { "debug", no_argument, NULL, 'g' },
                           { "force-sequence", no_argument, NULL, 'q' },
                           { "active-waiting", no_argument, NULL, 'w' },
+                          { "lock-free", no_argument, NULL, 'l' },
+                          { "spin-budget", required_argument, NULL, 'k' },
+                          { "batch-size", required_argument, NULL, 'n' },
+                          { "buffer-size-max", required_argument, NULL, 'x' },
+                          { "work-stealing", no_argument, NULL, 'W' },
+                          { "reorder-window", required_argument, NULL, 'r' },
+                          { "frame-meta", no_argument, NULL, 'M' },
                           { "help", no_argument, NULL, 'h' },
                           { 0 } };
 
@@ -73,10 +80,17 @@ main(int argc, char** argv)
     bool debug = false;
     bool force_sequence = false;
     bool active_waiting = false;
+    bool lock_free = false;
+    size_t spin_budget = 0;
+    size_t batch_size = 1;
+    size_t buffer_size_max = 0;
+    bool work_stealing = false;
+    size_t reorder_window = 0;
+    bool frame_meta = false;
 
     while (1)
     {
-        const int opt = getopt_long(argc, argv, "t:f:s:d:u:o:i:j:cpbgqwh", longopts, 0);
+        const int opt = getopt_long(argc, argv, "t:f:s:d:u:o:i:j:k:n:x:r:cpbgqwlWMh", longopts, 0);
         if (opt == -1) break;
         switch (opt)
         {
@@ -119,6 +133,27 @@ main(int argc, char** argv)
             case 'w':
                 active_waiting = true;
                 break;
+            case 'l':
+                lock_free = true;
+                break;
+            case 'k':
+                spin_budget = atoi(optarg);
+                break;
+            case 'n':
+                batch_size = atoi(optarg);
+                break;
+            case 'x':
+                buffer_size_max = atoi(optarg);
+                break;
+            case 'W':
+                work_stealing = true;
+                break;
+            case 'r':
+                reorder_window = atoi(optarg);
+                break;
+            case 'M':
+                frame_meta = true;
+                break;
             case 'q':
                 force_sequence = true;
                 break;
@@ -167,6 +202,27 @@ main(int argc, char** argv)
                 std::cout << "  -w, --active-waiting  "
                           << "Enable active waiting in the pipeline synchronizations                "
                           << "[" << (active_waiting ? "true" : "false") << "]" << std::endl;
+                std::cout << "  -l, --lock-free       "
+                          << "Enable the lock-free rings in the pipeline synchronizations           "
+                          << "[" << (lock_free ? "true" : "false") << "]" << std::endl;
+                std::cout << "  -k, --spin-budget     "
+                          << "Spinning iterations before parking in the passive synchronizations    "
+                          << "[" << spin_budget << "]" << std::endl;
+                std::cout << "  -n, --batch-size      "
+                          << "Number of slots claimed at once in the pipeline synchronizations      "
+                          << "[" << batch_size << "]" << std::endl;
+                std::cout << "  -x, --buffer-size-max "
+                          << "Maximum adaptive depth of the synchronizations (0 = fixed depth)      "
+                          << "[" << buffer_size_max << "]" << std::endl;
+                std::cout << "  -W, --work-stealing   "
+                          << "Enable the work stealing between the threads of the middle stage      "
+                          << "[" << (work_stealing ? "true" : "false") << "]" << std::endl;
+                std::cout << "  -r, --reorder-window  "
+                          << "Size of the window restoring the frames order after the middle stage  "
+                          << "[" << reorder_window << "]" << std::endl;
+                std::cout << "  -M, --frame-meta      "
+                          << "Enable the frame metadata and check the frames sequence numbers       "
+                          << "[" << (frame_meta ? "true" : "false") << "]" << std::endl;
                 std::cout << "  -h, --help            "
                           << "This help                                                             "
                           << "[false]" << std::endl;
@@ -197,6 +253,13 @@ main(int argc, char** argv)
     std::cout << "#   - debug          = " << (debug ? "true" : "false") << std::endl;
     std::cout << "#   - force_sequence = " << (force_sequence ? "true" : "false") << std::endl;
     std::cout << "#   - active_waiting = " << (active_waiting ? "true" : "false") << std::endl;
+    std::cout << "#   - lock_free      = " << (lock_free ? "true" : "false") << std::endl;
+    std::cout << "#   - spin_budget    = " << spin_budget << std::endl;
+    std::cout << "#   - batch_size     = " << batch_size << std::endl;
+    std::cout << "#   - buffer_size_max = " << buffer_size_max << std::endl;
+    std::cout << "#   - work_stealing  = " << (work_stealing ? "true" : "false") << std::endl;
+    std::cout << "#   - reorder_window = " << reorder_window << std::endl;
+    std::cout << "#   - frame_meta     = " << (frame_meta ? "true" : "false") << std::endl;
     std::cout << "#" << std::endl;
 
     if (!force_sequence && !no_copy_mode)
@@ -228,6 +291,39 @@ main(int argc, char** argv)
     sink["send_count::in_data"] = (*rlys[rlys.size() - 1])["relay::out"];
     sink["send_count::in_count"] = source["generate::out_count"];
 
+    // create an on-the-fly stateless module at the end of the chain to check the sequence numbers of the frames and to
+    // measure their end-to-end latency (from the 'generate' task that ingests them)
+    uint64_t n_meta_frames = 0;
+    uint64_t n_meta_unordered = 0;
+    int64_t meta_max_latency = 0;
+    std::unique_ptr<module::Stateless> checker;
+    if (frame_meta)
+    {
+        checker.reset(new module::Stateless());
+        checker->set_name("Meta_checker");
+        checker->set_short_name("Meta_checker");
+        auto& tsk = checker->create_task("check");
+        checker->create_codelet(
+          tsk,
+          [&n_meta_frames, &n_meta_unordered, &meta_max_latency](
+            module::Module& m, runtime::Task& t, const size_t frame_id) -> int
+          {
+              const int64_t now = (int64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    std::chrono::steady_clock::now().time_since_epoch())
+                                    .count();
+              const auto meta = t.get_frame_meta();
+              const size_t f_stop = std::min(frame_id + m.get_n_frames_per_wave(), m.get_n_frames());
+              for (size_t f = frame_id; f < f_stop; f++)
+              {
+                  if (meta[f].seq != n_meta_frames) n_meta_unordered++;
+                  meta_max_latency = std::max(meta_max_latency, now - meta[f].ts);
+                  n_meta_frames++;
+              }
+              return runtime::status_t::SUCCESS;
+          });
+        (*checker)("check") = sink("send_count");
+    }
+
     std::unique_ptr<runtime::Sequence> sequence_chain;
     std::unique_ptr<runtime::Pipeline> pipeline_chain;
     if (force_sequence)
@@ -251,6 +347,7 @@ main(int argc, char** argv)
                 tsk->set_debug_limit(16);    // display only the 16 first bits if the debug mode is enabled
                 tsk->set_stats(print_stats); // enable the statistics
                 tsk->set_fast(true);         // enable the fast mode (= disable the useless verifs in the tasks)
+                tsk->set_frame_meta(frame_meta); // attach a sequence number and a timestamp to the frames
             }
 
         auto t_start = std::chrono::steady_clock::now();
@@ -300,6 +397,32 @@ main(int argc, char** argv)
           {
             active_waiting, // type of waiting between stages 0 and 1 (true = active, false = passive)
             active_waiting, // type of waiting between stages 1 and 2 (true = active, false = passive)
+          },
+          {}, // thread pinning
+          "", // pinning policy
+          {
+            lock_free, // lock-free ring between stages 0 and 1
+            lock_free, // lock-free ring between stages 1 and 2
+          },
+          {
+            spin_budget, // spinning iterations before parking between stages 0 and 1 (passive waiting only)
+            spin_budget, // spinning iterations before parking between stages 1 and 2 (passive waiting only)
+          },
+          {
+            batch_size, // number of slots claimed at once between stages 0 and 1
+            batch_size, // number of slots claimed at once between stages 1 and 2
+          },
+          {
+            { buffer_size, buffer_size_max }, // adaptive depth bounds between stages 0 and 1 (max = 0: fixed depth)
+            { buffer_size, buffer_size_max }, // adaptive depth bounds between stages 1 and 2 (max = 0: fixed depth)
+          },
+          {
+            work_stealing, // the threads of the stage 1 pull the frames from any sub-buffer
+            work_stealing, // the thread of the stage 2 pulls the frames from any sub-buffer
+          },
+          {
+            0,              // no reordering between stages 0 and 1
+            reorder_window, // frames order restored between stages 1 and 2 (0 = disabled)
           }));
         pipeline_chain->set_n_frames(n_inter_frames);
 
@@ -318,12 +441,18 @@ main(int argc, char** argv)
                 tsk->set_debug_limit(16);    // display only the 16 first bits if the debug mode is enabled
                 tsk->set_stats(print_stats); // enable the statistics
                 tsk->set_fast(true);         // enable the fast mode (= disable the useless verifs in the tasks)
+                tsk->set_frame_meta(frame_meta); // attach a sequence number and a timestamp to the frames
             }
 
         auto t_start = std::chrono::steady_clock::now();
         pipeline_chain->exec();
         std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - t_start;
 
+        // the frames that could not be reordered in the window (the output file is then not in order)
+        for (auto adp : pipeline_chain->get_modules<module::Adaptor_m_to_n>(false))
+            if (adp->get_reorder_window())
+                std::cout << "Reorder window late frames: " << adp->get_n_late_frames() << std::endl;
+
         auto elapsed_time = duration.count() / 1000.f / 1000.f;
         std::cout << "Sequence elapsed time: " << elapsed_time << " ms" << std::endl;
     }
@@ -343,6 +472,14 @@ main(int argc, char** argv)
                   << std::endl;
     unsigned int test_results = !tests_passed;
 
+    // the frames are not in order after a work-stealing stage without reorder window
+    if (frame_meta)
+    {
+        std::cout << "# Frame metadata: " << n_meta_frames << " frames, " << n_meta_unordered
+                  << " unordered, max. end-to-end latency = " << meta_max_latency / 1000.f << " us" << std::endl;
+        if (n_meta_frames == 0 || (n_meta_unordered && (!work_stealing || reorder_window))) test_results = 1;
+    }
+
     // display the statistics of the tasks (if enabled)
     if (print_stats)
     {
@@ -375,6 +512,7 @@ main(int argc, char** argv)
         (*rlys[s + 1])[module::rly::sck::relay::in].unbind((*rlys[s])[module::rly::sck::relay::out]);
     sink[module::snk::sck::send_count::in_data].unbind((*rlys[rlys.size() - 1])[module::rly::sck::relay::out]);
     sink[module::snk::sck::send_count::in_count].unbind(source[module::src::sck::generate::out_count]);
+    if (frame_meta) (*checker)("check").unbind(sink("send_count"));
 
     return test_results;
 }